@@ -0,0 +1,56 @@
+#include "geodesic/spherical_tesselation.hh"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+
+using namespace Spectrum;
+
+/*!
+\brief Generate one tesselation, save it, and check that the saved copy loads back
+\author Swati Sharma
+\date 10/17/2026
+\param[in] dir Output directory
+*/
+template <PolyType poly_type, int max_division>
+void GenerateOne(const std::string& dir)
+{
+   std::string fname = dir + "/" + SphericalTesselation<poly_type, max_division>::CacheFileName();
+
+   auto t1 = std::chrono::steady_clock::now();
+   SphericalTesselation<poly_type, max_division> tess;
+   auto t2 = std::chrono::steady_clock::now();
+
+   if(!tess.WriteCache(fname)) {
+      std::cerr << "Could not write " << fname << std::endl;
+      return;
+   };
+
+   auto t3 = std::chrono::steady_clock::now();
+   SphericalTesselation<poly_type, max_division> tess_cached(fname);
+   auto t4 = std::chrono::steady_clock::now();
+
+   std::cerr << std::setw(40) << std::left << fname << std::right
+             << "  generate " << std::setw(10) << std::chrono::duration<double, std::milli>(t2 - t1).count() << " ms"
+             << "  load " << std::setw(10) << std::chrono::duration<double, std::milli>(t4 - t3).count() << " ms"
+             << (tess_cached.FromCache() ? "" : "  (LOAD FAILED)") << std::endl;
+};
+
+int main(int argc, char** argv)
+{
+   std::string dir = (argc > 1 ? argv[1] : ".");
+
+   GenerateOne<POLY_TETRAHEDRON, 3>(dir);
+   GenerateOne<POLY_HEXAHEDRON, 3>(dir);
+   GenerateOne<POLY_OCTAHEDRON, 3>(dir);
+   GenerateOne<POLY_DODECAHEDRON, 3>(dir);
+   GenerateOne<POLY_ICOSAHEDRON, 3>(dir);
+
+   GenerateOne<POLY_HEXAHEDRON, 4>(dir);
+   GenerateOne<POLY_HEXAHEDRON, 5>(dir);
+   GenerateOne<POLY_HEXAHEDRON, 6>(dir);
+   GenerateOne<POLY_ICOSAHEDRON, 4>(dir);
+   GenerateOne<POLY_ICOSAHEDRON, 5>(dir);
+   GenerateOne<POLY_ICOSAHEDRON, 6>(dir);
+
+   return 0;
+};
@@ -0,0 +1,122 @@
+#include "src/server_config.hh"
+#include "src/background_solarwind.hh"
+#include "src/fieldline_map.hh"
+#include "common/mpi_config.hh"
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+
+using namespace Spectrum;
+
+int main(int argc, char** argv)
+{
+   int rank = 0, n_ranks = 1;
+
+#ifdef USE_MPI
+   MPI_Init(&argc, &argv);
+   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+   MPI_Comm_size(MPI_COMM_WORLD, &n_ranks);
+#endif
+
+   DataContainer container;
+   container.Clear();
+
+// Initial time
+   double t0 = 0.0;
+   container.Insert(t0);
+
+// Origin
+   container.Insert(gv_zeros);
+
+// Velocity
+   double umag = 4.0e7 / unit_velocity_fluid;
+   GeoVector u0(umag, 0.0, 0.0);
+   container.Insert(u0);
+
+// Magnetic field
+   double RS = 6.957e10 / unit_length_fluid;
+   double r_ref = 3.0 * RS;
+   double BmagE = 5.0e-5 / unit_magnetic_fluid;
+   double Bmag_ref = BmagE * Sqr((GSL_CONST_CGSM_ASTRONOMICAL_UNIT / unit_length_fluid) / r_ref);
+   GeoVector B0(Bmag_ref, 0.0, 0.0);
+   container.Insert(B0);
+
+// Effective "mesh" resolution
+   double dmax_fraction = 0.1;
+   double dmax = dmax_fraction * GSL_CONST_CGSM_ASTRONOMICAL_UNIT / unit_length_fluid;
+   container.Insert(dmax);
+
+// Solar rotation vector
+   double w0 = 2.7e-6 * unit_time_fluid;
+   GeoVector Omega(0.0, 0.0, w0);
+   container.Insert(Omega);
+
+// Reference equatorial distance
+   container.Insert(r_ref);
+
+// dmax fraction for distances closer to the dipole
+   container.Insert(dmax_fraction);
+
+   FieldlineMap fieldline_map(BackgroundSolarWind(), container);
+
+// Seeds on a sphere at 1 AU, footpoints at the reference sphere, open lines end at 10 AU
+   int n_theta = 90;
+   int n_phi = 180;
+   double r_seed = GSL_CONST_CGSM_ASTRONOMICAL_UNIT / unit_length_fluid;
+   double r_out = 10.0 * GSL_CONST_CGSM_ASTRONOMICAL_UNIT / unit_length_fluid;
+   fieldline_map.SetSeedsSphere(gv_zeros, r_seed, n_theta, n_phi);
+   fieldline_map.SetLimits(gv_zeros, r_ref, r_out, 100.0 * r_out, 100000);
+
+   std::string map_file = "output_data/main_map_fieldline_connectivity";
+   auto time_start = std::chrono::system_clock::now();
+   fieldline_map.Trace(map_file, false, t0, rank, n_ranks);
+
+#ifdef USE_MPI
+   MPI_Barrier(MPI_COMM_WORLD);
+   if(!rank && n_ranks > 1) FieldlineMap::MergeParts(map_file, n_ranks);
+#endif
+   auto time_end = std::chrono::system_clock::now();
+
+// Summary of the termination codes from the merged map
+   if(!rank) {
+      int d, code;
+      FieldlineMapHeader header;
+      std::ifstream infile(map_file + ".flm", std::ifstream::binary);
+      infile.read((char*)&header, sizeof(header));
+      std::vector<FieldlineMapRecord> records(header.n_records);
+      infile.read((char*)records.data(), records.size() * sizeof(FieldlineMapRecord));
+      infile.close();
+
+      int count[2][5] = {{0}};
+      double length_avg[2] = {0.0, 0.0};
+      for(auto& record : records) {
+         for(d = 0; d < 2; d++) {
+            count[d][record.code[d]]++;
+            if(record.code[d] == FIELDLINE_END_INNER) length_avg[d] += record.length[d];
+         };
+      };
+      for(d = 0; d < 2; d++) length_avg[d] /= fmax(count[d][FIELDLINE_END_INNER], 1);
+
+      std::cout << std::endl;
+      std::cout << "PARKER SPIRAL CONNECTIVITY MAP" << std::endl;
+      std::cout << "=========================================================" << std::endl;
+      std::cout << "Seeds: " << n_theta << " x " << n_phi << " at " << r_seed << " AU" << std::endl;
+      std::cout << "Processes: " << n_ranks << std::endl;
+      std::cout << "Time elapsed (wall) = " << std::chrono::duration<double>(time_end - time_start).count() << " s" << std::endl;
+      for(d = 0; d < 2; d++) {
+         std::cout << (d ? "Along B:   " : "Against B: ");
+         for(code = 0; code < 5; code++) std::cout << std::setw(8) << count[d][code];
+         std::cout << "   mean footpoint length = " << length_avg[d] << " AU" << std::endl;
+      };
+      std::cout << "=========================================================" << std::endl;
+      std::cout << "Map outputed to " << map_file << ".flm" << std::endl;
+      std::cout << std::endl;
+   };
+
+#ifdef USE_MPI
+   MPI_Finalize();
+#endif
+
+   return 0;
+};
@@ -0,0 +1,99 @@
+#include "src/distribution_export.hh"
+#include <iostream>
+#include <cstdlib>
+#include <chrono>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+using namespace Spectrum;
+
+// Print the usage message
+void PrintUsage(const char* prog_name)
+{
+   std::cerr << "Usage: " << prog_name << " sum <output> <input1> [<input2> ...]" << std::endl;
+   std::cerr << "       " << prog_name << " slice <output> <input> <dim> <first> <last>" << std::endl;
+   std::cerr << "       " << prog_name << " rebin <output> <input> <factor0> <factor1> <factor2>" << std::endl;
+   std::cerr << "       " << prog_name << " project <output> <input> <dim>" << std::endl;
+   std::cerr << "       " << prog_name << " normalize <output> <input> counts|events|width|total" << std::endl;
+   std::cerr << "       " << prog_name << " text <input1> [<input2> ...]" << std::endl;
+};
+
+int main(int argc, char** argv)
+{
+   DistroExport distro_in, distro_out;
+
+   if(argc < 3) {
+      PrintUsage(argv[0]);
+      return 1;
+   };
+   std::string command = argv[1];
+   auto time_start = std::chrono::system_clock::now();
+
+// Convert many files to text, one file per thread
+   if(command == "text") {
+      int n_failed = 0;
+#pragma omp parallel for schedule(dynamic) reduction(+:n_failed)
+      for(int file = 2; file < argc; file++) {
+         DistroExport distro;
+         if(distro.Read(argv[file])) distro.PrintText(std::string(argv[file]) + ".txt");
+         else n_failed++;
+      };
+      if(n_failed) std::cerr << n_failed << " file(s) could not be read" << std::endl;
+   }
+
+// Add many files
+   else if(command == "sum") {
+      if(argc < 4) {
+         PrintUsage(argv[0]);
+         return 1;
+      };
+      std::vector<std::string> file_names(argv + 3, argv + argc);
+      if(!DistroExport::SumFiles(file_names, distro_out)) {
+         std::cerr << "Some files could not be read or have different bins" << std::endl;
+         return 1;
+      };
+      distro_out.Write(argv[2]);
+      std::cout << "Added " << file_names.size() << " files with a total of " << distro_out.header.n_events << " events" << std::endl;
+   }
+
+// Operations on a single file
+   else {
+      if((argc < 5) || !distro_in.Read(argv[3])) {
+         PrintUsage(argv[0]);
+         return 1;
+      };
+
+      if(command == "slice" && (argc == 7)) {
+         distro_out = distro_in.Slice(atoi(argv[4]), atoi(argv[5]), atoi(argv[6]));
+      }
+      else if(command == "rebin" && (argc == 7)) {
+         int factor[3] = {atoi(argv[4]), atoi(argv[5]), atoi(argv[6])};
+         distro_out = distro_in.Rebin(factor);
+      }
+      else if(command == "project" && (argc == 5)) {
+         distro_out = distro_in.Project(atoi(argv[4]));
+      }
+      else if(command == "normalize" && (argc == 5)) {
+         std::string mode = argv[4];
+         distro_out = distro_in;
+         if(mode == "counts") distro_out.Normalize(DISTRO_NORM_COUNTS);
+         else if(mode == "events") distro_out.Normalize(DISTRO_NORM_EVENTS);
+         else if(mode == "width") distro_out.Normalize(DISTRO_NORM_WIDTH);
+         else if(mode == "total") distro_out.Normalize(DISTRO_NORM_TOTAL);
+         else {
+            PrintUsage(argv[0]);
+            return 1;
+         };
+      }
+      else {
+         PrintUsage(argv[0]);
+         return 1;
+      };
+      distro_out.Write(argv[2]);
+   };
+
+   auto time_end = std::chrono::system_clock::now();
+   std::cout << "Elapsed time: " << std::chrono::duration<double>(time_end - time_start).count() << " s" << std::endl;
+   return 0;
+};
@@ -0,0 +1,117 @@
+#include "geodesic/requestable_tesselation.hh"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <vector>
+
+using namespace Spectrum;
+
+/*!
+\brief Time one point location method over a set of directions and count disagreements with a reference answer
+\author Swati Sharma
+\date 10/17/2026
+\param[in] label     Name of the method
+\param[in] n         Number of directions
+\param[in] reference Faces found by tree descent (nullptr to skip the comparison)
+\param[in] faces     Faces found by this method
+\param[in] t1        Start time
+\param[in] t2        End time
+*/
+void Report(const std::string& label, int n, const int* reference, const int* faces,
+            std::chrono::steady_clock::time_point t1, std::chrono::steady_clock::time_point t2)
+{
+   int mismatch = 0;
+   if(reference) {
+      for(auto i = 0; i < n; i++) if(faces[i] != reference[i]) mismatch++;
+   };
+
+   std::cerr << "   " << std::setw(28) << std::left << label << std::right
+             << std::setw(10) << std::chrono::duration<double, std::nano>(t2 - t1).count() / n << " ns/point";
+   if(reference) std::cerr << "   mismatches: " << mismatch;
+   std::cerr << std::endl;
+};
+
+/*!
+\brief Compare tree descent with the lookup table and the walk for random and coherent directions
+\author Swati Sharma
+\date 10/17/2026
+\param[in] name Tesselation name for the report
+\param[in] n    Number of directions
+*/
+template <PolyType poly_type, int max_division>
+void BenchmarkOne(const std::string& name, int n)
+{
+   RequestableTesselation<poly_type, max_division> tess;
+   std::vector<GeoVector> random_dirs(n), track_dirs(n);
+   std::vector<int> reference(n), faces(n);
+   std::mt19937_64 gen(12345);
+   std::normal_distribution<double> normal(0.0, 1.0);
+   int i;
+
+// Isotropic random directions
+   for(i = 0; i < n; i++) random_dirs[i] = GeoVector(normal(gen), normal(gen), normal(gen)).Normalize();
+
+// A random walk on the sphere with steps much smaller than a face, as a particle trajectory would produce
+   double step = 0.1 * sqrt(4.0 * M_PI / tess.NFaces(max_division));
+   track_dirs[0] = random_dirs[0];
+   for(i = 1; i < n; i++) {
+      track_dirs[i] = track_dirs[i - 1] + step * GeoVector(normal(gen), normal(gen), normal(gen));
+      track_dirs[i].Normalize();
+   };
+
+   auto t1 = std::chrono::steady_clock::now();
+   tess.BuildLocator(max_division);
+   auto t2 = std::chrono::steady_clock::now();
+   std::cerr << name << ", division " << max_division << ", " << tess.NFaces(max_division) << " faces, lookup table built in "
+             << std::chrono::duration<double, std::milli>(t2 - t1).count() << " ms" << std::endl;
+
+   std::cerr << "  Random directions" << std::endl;
+
+   t1 = std::chrono::steady_clock::now();
+   for(i = 0; i < n; i++) reference[i] = tess.Locate(max_division, random_dirs[i]);
+   t2 = std::chrono::steady_clock::now();
+   Report("Locate (tree descent)", n, nullptr, reference.data(), t1, t2);
+
+   t1 = std::chrono::steady_clock::now();
+   for(i = 0; i < n; i++) faces[i] = tess.LocateFast(max_division, random_dirs[i]);
+   t2 = std::chrono::steady_clock::now();
+   Report("LocateFast (lookup + walk)", n, reference.data(), faces.data(), t1, t2);
+
+   t1 = std::chrono::steady_clock::now();
+   tess.Locate(max_division, n, random_dirs.data(), faces.data());
+   t2 = std::chrono::steady_clock::now();
+   Report("Locate (batch)", n, reference.data(), faces.data(), t1, t2);
+
+   std::cerr << "  Coherent directions" << std::endl;
+
+   t1 = std::chrono::steady_clock::now();
+   for(i = 0; i < n; i++) reference[i] = tess.Locate(max_division, track_dirs[i]);
+   t2 = std::chrono::steady_clock::now();
+   Report("Locate (tree descent)", n, nullptr, reference.data(), t1, t2);
+
+   t1 = std::chrono::steady_clock::now();
+   faces[0] = tess.Locate(max_division, track_dirs[0]);
+   for(i = 1; i < n; i++) faces[i] = tess.LocateFrom(max_division, faces[i - 1], track_dirs[i]);
+   t2 = std::chrono::steady_clock::now();
+   Report("LocateFrom (walk)", n, reference.data(), faces.data(), t1, t2);
+
+   t1 = std::chrono::steady_clock::now();
+   tess.Locate(max_division, n, track_dirs.data(), faces.data());
+   t2 = std::chrono::steady_clock::now();
+   Report("Locate (batch)", n, reference.data(), faces.data(), t1, t2);
+
+   std::cerr << std::endl;
+};
+
+int main(int argc, char** argv)
+{
+   int n = (argc > 1 ? atoi(argv[1]) : 1000000);
+
+   BenchmarkOne<POLY_HEXAHEDRON, 4>("Hexahedron", n);
+   BenchmarkOne<POLY_HEXAHEDRON, 6>("Hexahedron", n);
+   BenchmarkOne<POLY_ICOSAHEDRON, 4>("Icosahedron", n);
+   BenchmarkOne<POLY_ICOSAHEDRON, 6>("Icosahedron", n);
+
+   return 0;
+};
@@ -259,6 +259,34 @@ int main(int argc, char** argv)
 
    simulation->AddDistribution(DistributionSpectrumKineticEnergyPowerLaw(), container);
 
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// Distribution 2 (several source spectra from the same trajectories)
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Parameters for distribution
+   container.Clear();
+
+   container.Insert(n_bins);
+   container.Insert(minval);
+   container.Insert(maxval);
+   container.Insert(log_bins);
+   container.Insert(bin_outside);
+   container.Insert(unit_distro);
+   container.Insert(unit_val);
+   container.Insert(keep_records);
+
+// Normalizations, characteristic energies, and power laws for each spectrum
+   std::vector<double> J0_multi = {J0, J0, J0};
+   container.Insert(J0_multi);
+   std::vector<double> T0_multi = {T0, T0, T0};
+   container.Insert(T0_multi);
+   std::vector<double> pow_law_multi = {-1.6, -1.8, -2.0};
+   container.Insert(pow_law_multi);
+
+   container.Insert(val_cold);
+
+   simulation->AddDistribution(DistributionSpectrumKineticEnergyPowerLawMulti(), container);
+
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 // Run the simulation
 //----------------------------------------------------------------------------------------------------------------------------------------------------
@@ -275,6 +303,7 @@ int main(int argc, char** argv)
    simulation->SetTasks(n_traj, batch_size);
    simulation->MainLoop();
    simulation->PrintDistro1D(0, 0, simulation_files_prefix + "spectrum.dat", true);
+   simulation->PrintDistro1D(1, 0, simulation_files_prefix + "spectrum_multi.dat", true);
 
    if(simulation->IsMaster()) {
       std::cout << std::endl;
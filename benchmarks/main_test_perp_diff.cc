@@ -1,5 +1,6 @@
 #include "src/simulation.hh"
 #include "src/distribution_other.hh"
+#include "src/distribution_moments.hh"
 #include "src/background_uniform.hh"
 #include "src/diffusion_other.hh"
 #include "src/boundary_time.hh"
@@ -121,6 +122,7 @@ int main(int argc, char** argv)
    std::vector<int> actions_time;
    actions_time.push_back(0);
    actions_time.push_back(0);
+   actions_time.push_back(-1);
    container.Insert(actions_time);
    
 // Spacing between dumps
@@ -143,6 +145,7 @@ int main(int argc, char** argv)
    actions_time.clear();
    actions_time.push_back(-1);
    actions_time.push_back(-1);
+   actions_time.push_back(0);
    container.Insert(actions_time);
    
 // Duration of the trajectory
@@ -226,6 +229,35 @@ int main(int argc, char** argv)
 
    simulation->AddDistribution(DistributionPositionCumulativeOrder2(), container);
 
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// Distribution 3 (moments at the end of the trajectory)
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Parameters for distribution
+   container.Clear();
+
+// Quantities and their powers
+   std::vector<int> quantities3 = {MOMENT_DISP_X, MOMENT_DISP_Y, MOMENT_DISP_X, MOMENT_DISP_Y, MOMENT_DISP_Z};
+   std::vector<int> powers3 = {1, 1, 2, 2, 2};
+   container.Insert(quantities3);
+   container.Insert(powers3);
+
+// No directional harmonics
+   int l_max3 = -1;
+   container.Insert(l_max3);
+
+// Use the final coordinates
+   int val_time3 = 1;
+   container.Insert(val_time3);
+
+// Weights
+   double val_hot3 = 1.0;
+   container.Insert(val_hot3);
+   double val_cold3 = 0.0;
+   container.Insert(val_cold3);
+
+   simulation->AddDistribution(DistributionMoments(), container);
+
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 // Run the simulation
 //----------------------------------------------------------------------------------------------------------------------------------------------------
@@ -243,6 +275,9 @@ int main(int argc, char** argv)
    simulation->MainLoop();
    simulation->PrintDistro1D(0, 0, simulation_files_prefix + "cumulative_distro1.dat", true);
    simulation->PrintDistro1D(1, 0, simulation_files_prefix + "cumulative_distro2.dat", true);
+   simulation->ExportDistro(0, simulation_files_prefix + "cumulative_distro1.bin", true);
+   simulation->ExportDistro(1, simulation_files_prefix + "cumulative_distro2.bin", true);
+   simulation->PrintDistro1D(2, 0, simulation_files_prefix + "moments.dat", true);
 
    if(simulation->IsMaster()) {
       std::cout << std::endl;
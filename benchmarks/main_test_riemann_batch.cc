@@ -0,0 +1,121 @@
+#include "fluid/riemann_solver_batch.hh"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <vector>
+
+using namespace Spectrum;
+
+/*!
+\brief Fill the left and right states with random subsonic and supersonic flows
+\author Swati Sharma
+\date 10/17/2026
+\param[in]  n    Number of interfaces
+\param[out] left Left primitive states, [var][face]
+\param[out] rght Right primitive states, [var][face]
+*/
+template <typename cl_prim>
+void RandomStates(int n, std::vector<double>& left, std::vector<double>& rght)
+{
+   constexpr int n_vars = sizeof(cl_prim) / sizeof(double);
+   std::mt19937_64 gen(12345);
+   std::uniform_real_distribution<double> positive(0.2, 2.0);
+   std::uniform_real_distribution<double> signed_unit(-1.0, 1.0);
+   cl_prim state(0.0);
+
+   left.resize(n_vars * n);
+   rght.resize(n_vars * n);
+   for(auto side = 0; side < 2; side++) {
+      double* states = (side ? rght.data() : left.data());
+      for(auto face = 0; face < n; face++) {
+         for(auto var = 0; var < n_vars; var++) state[var] = signed_unit(gen);
+         state.den() = positive(gen);
+         state.pre() = positive(gen);
+         state.vel() *= 2.0;
+         for(auto var = 0; var < n_vars; var++) states[var * n + face] = state[var];
+      };
+   };
+};
+
+/*!
+\brief Time the virtual single-interface solver and the batched solver on the same states
+\author Swati Sharma
+\date 10/17/2026
+\param[in] name Label for the report
+\param[in] n    Number of interfaces
+\param[in] reps Number of repetitions
+*/
+template <template <typename, typename, typename> class solver_scalar, template <typename, typename, typename> class solver_batch,
+          typename cl_prim, typename cl_cons, typename cl_flux>
+void BenchmarkOne(const std::string& name, int n, int reps)
+{
+   constexpr int n_vars = sizeof(cl_prim) / sizeof(double);
+   std::vector<double> left, rght, flux_scalar(n_vars * n), flux_batch(n_vars * n);
+   cl_prim left_prim, rght_prim;
+   cl_flux resv_flux;
+   int face, var, rep;
+
+   RandomStates<cl_prim>(n, left, rght);
+
+// Single interface at a time through the base class, as the existing code would call it
+   solver_scalar<cl_prim, cl_cons, cl_flux> solver_obj;
+   RiemannSolverBase<cl_prim, cl_cons, cl_flux>& solver = solver_obj;
+
+   auto t1 = std::chrono::steady_clock::now();
+   for(rep = 0; rep < reps; rep++) {
+      for(face = 0; face < n; face++) {
+         for(var = 0; var < n_vars; var++) {
+            left_prim[var] = left[var * n + face];
+            rght_prim[var] = rght[var * n + face];
+         };
+         solver.Solve(left_prim, rght_prim);
+         resv_flux = solver.GetResolvedFlux();
+         for(var = 0; var < n_vars; var++) flux_scalar[var * n + face] = resv_flux[var];
+      };
+   };
+   auto t2 = std::chrono::steady_clock::now();
+
+   for(rep = 0; rep < reps; rep++) solver_batch<cl_prim, cl_cons, cl_flux>::Solve(n, n, left.data(), rght.data(), flux_batch.data());
+   auto t3 = std::chrono::steady_clock::now();
+
+// Largest difference relative to the magnitude of the flux component
+   double max_err = 0.0;
+   for(var = 0; var < n_vars; var++) {
+      for(face = 0; face < n; face++) {
+         double a = flux_scalar[var * n + face];
+         double b = flux_batch[var * n + face];
+         max_err = std::max(max_err, std::abs(a - b) / (std::abs(a) + std::abs(b) + 1.0));
+      };
+   };
+
+   double rate_scalar = (double)n * reps / std::chrono::duration<double>(t2 - t1).count();
+   double rate_batch = (double)n * reps / std::chrono::duration<double>(t3 - t2).count();
+   std::cerr << std::setw(18) << std::left << name << std::right
+             << "  virtual " << std::setw(10) << std::setprecision(4) << rate_scalar / 1.0e6 << " Mfaces/s"
+             << "  batch " << std::setw(10) << std::setprecision(4) << rate_batch / 1.0e6 << " Mfaces/s"
+             << "  speedup " << std::setw(6) << std::setprecision(3) << rate_batch / rate_scalar
+             << "  max rel diff " << std::setprecision(3) << max_err << std::endl;
+};
+
+int main(int argc, char** argv)
+{
+   int n = (argc > 1 ? atoi(argv[1]) : 100000);
+   int reps = (argc > 2 ? atoi(argv[2]) : 10);
+
+   using GasPrim = PrimitiveStateGasdyn<0, 0>;
+   using GasCons = ConservedStateGasdyn<0, 0>;
+   using GasFlux = FluxFunctionGasdyn<0, 0>;
+   using MHDPrim = PrimitiveStateMHD<0, 0>;
+   using MHDCons = ConservedStateMHD<0, 0>;
+   using MHDFlux = FluxFunctionMHD<0, 0>;
+
+   BenchmarkOne<RiemannSolverRusanov, RiemannBatchRusanov, GasPrim, GasCons, GasFlux>("Gasdyn Rusanov", n, reps);
+   BenchmarkOne<RiemannSolverHLLE, RiemannBatchHLLE, GasPrim, GasCons, GasFlux>("Gasdyn HLLE", n, reps);
+   BenchmarkOne<RiemannSolverHLLC, RiemannBatchHLLC, GasPrim, GasCons, GasFlux>("Gasdyn HLLC", n, reps);
+   BenchmarkOne<RiemannSolverRusanov, RiemannBatchRusanov, MHDPrim, MHDCons, MHDFlux>("MHD Rusanov", n, reps);
+   BenchmarkOne<RiemannSolverHLLE, RiemannBatchHLLE, MHDPrim, MHDCons, MHDFlux>("MHD HLLE", n, reps);
+   BenchmarkOne<RiemannSolverHLLC, RiemannBatchHLLC, MHDPrim, MHDCons, MHDFlux>("MHD HLLC", n, reps);
+
+   return 0;
+};
@@ -0,0 +1,301 @@
+/*!
+\file flat_table.hh
+\brief Declares and defines a contiguous two-dimensional table with a compile-time row stride
+\author Swati Sharma
+
+This file is part of the SPECTRUM suite of scientific numerical simulation codes. SPECTRUM stands for Space Plasma and Energetic Charged particle TRansport on Unstructured Meshes. The code simulates plasma or neutral particle flows using MHD equations on a grid, transport of cosmic rays using stochastic or grid based methods. The "unstructured" part refers to the use of a geodesic mesh providing a uniform coverage of the surface of a sphere.
+*/
+
+#ifndef SPECTRUM_FLAT_TABLE_HH
+#define SPECTRUM_FLAT_TABLE_HH
+
+#include <cstddef>
+#include "common/definitions.hh"
+
+namespace Spectrum {
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// TableRow class declaration
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\brief A non-owning view of a single row of a table
+\author Swati Sharma
+*/
+template <typename T>
+struct TableRow
+{
+//! First element of the row
+   T* ptr;
+
+//! Number of meaningful elements in the row
+   int len;
+
+//! Return the number of elements
+   SPECTRUM_DEVICE_FUNC int size(void) const {return len;};
+
+//! Iterator to the first element
+   SPECTRUM_DEVICE_FUNC T* begin(void) const {return ptr;};
+
+//! Iterator past the last element
+   SPECTRUM_DEVICE_FUNC T* end(void) const {return ptr + len;};
+
+//! Access to an element
+   SPECTRUM_DEVICE_FUNC T& operator [](int i) const {return ptr[i];};
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// FlatTable class declaration
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\brief A two-dimensional table stored as a single contiguous block with a compile-time row length
+\author Swati Sharma
+
+Rows shorter than "stride" (e.g., singular vertices of a tesselation) are padded by the caller. The storage can be either owned by the object or mapped from an external buffer, such as a memory-mapped file. "operator[]" returns a pointer to the beginning of a row, so that "table[row][col]" costs a single multiply-add.
+*/
+template <typename T, int stride>
+class FlatTable
+{
+   static_assert(stride > 0, "FlatTable stride must be positive");
+
+protected:
+
+//! Number of rows
+   int n_rows = 0;
+
+//! Storage
+   T* data = nullptr;
+
+//! Whether the storage was allocated by this object
+   bool owner = false;
+
+public:
+
+//! Default constructor
+   SPECTRUM_DEVICE_FUNC FlatTable(void) = default;
+
+//! Copy constructor - deleted because the storage may be owned
+   FlatTable(const FlatTable& other) = delete;
+
+//! Assignment operator - deleted because the storage may be owned
+   FlatTable& operator =(const FlatTable& other) = delete;
+
+//! Destructor
+   SPECTRUM_DEVICE_FUNC ~FlatTable();
+
+//! Allocate storage for a given number of rows
+   SPECTRUM_DEVICE_FUNC void Allocate(int rows);
+
+//! Use an external buffer as storage
+   SPECTRUM_DEVICE_FUNC void Map(int rows, T* start);
+
+//! Release the storage
+   SPECTRUM_DEVICE_FUNC void Free(void);
+
+//! Set all elements to the same value
+   SPECTRUM_DEVICE_FUNC void Fill(T val);
+
+//! Return the number of rows
+   SPECTRUM_DEVICE_FUNC int Rows(void) const;
+
+//! Return the row length
+   SPECTRUM_DEVICE_FUNC static constexpr int Stride(void);
+
+//! Return the total number of elements
+   SPECTRUM_DEVICE_FUNC size_t Size(void) const;
+
+//! Access to the storage for reading
+   SPECTRUM_DEVICE_FUNC const T* Data(void) const;
+
+//! Access to the storage for writing
+   SPECTRUM_DEVICE_FUNC T* Data(void);
+
+//! Access to a row for reading
+   SPECTRUM_DEVICE_FUNC const T* operator [](int row) const;
+
+//! Access to a row for writing
+   SPECTRUM_DEVICE_FUNC T* operator [](int row);
+
+//! Return a view of the first "length" elements of a row for reading
+   SPECTRUM_DEVICE_FUNC TableRow<const T> Row(int row, int length = stride) const;
+
+//! Return a view of the first "length" elements of a row for writing
+   SPECTRUM_DEVICE_FUNC TableRow<T> Row(int row, int length = stride);
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// FlatTable inline methods
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+template <typename T, int stride>
+SPECTRUM_DEVICE_FUNC inline FlatTable<T, stride>::~FlatTable()
+{
+   Free();
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] rows Number of rows
+*/
+template <typename T, int stride>
+SPECTRUM_DEVICE_FUNC inline void FlatTable<T, stride>::Allocate(int rows)
+{
+   Free();
+   n_rows = rows;
+   data = new T[n_rows * stride];
+   owner = true;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] rows  Number of rows
+\param[in] start Beginning of the external buffer, which must hold at least "rows * stride" elements and outlive this object
+*/
+template <typename T, int stride>
+SPECTRUM_DEVICE_FUNC inline void FlatTable<T, stride>::Map(int rows, T* start)
+{
+   Free();
+   n_rows = rows;
+   data = start;
+   owner = false;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+template <typename T, int stride>
+SPECTRUM_DEVICE_FUNC inline void FlatTable<T, stride>::Free(void)
+{
+   if(owner) delete[] data;
+   data = nullptr;
+   n_rows = 0;
+   owner = false;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] val Value to assign to each element
+*/
+template <typename T, int stride>
+SPECTRUM_DEVICE_FUNC inline void FlatTable<T, stride>::Fill(T val)
+{
+   for(size_t i = 0; i < Size(); i++) data[i] = val;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return Number of rows
+*/
+template <typename T, int stride>
+SPECTRUM_DEVICE_FUNC inline int FlatTable<T, stride>::Rows(void) const
+{
+   return n_rows;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return Number of elements per row
+*/
+template <typename T, int stride>
+SPECTRUM_DEVICE_FUNC constexpr inline int FlatTable<T, stride>::Stride(void)
+{
+   return stride;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return Number of elements in the table
+*/
+template <typename T, int stride>
+SPECTRUM_DEVICE_FUNC inline size_t FlatTable<T, stride>::Size(void) const
+{
+   return static_cast<size_t>(n_rows) * stride;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return Pointer to the storage
+*/
+template <typename T, int stride>
+SPECTRUM_DEVICE_FUNC inline const T* FlatTable<T, stride>::Data(void) const
+{
+   return data;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return Pointer to the storage
+*/
+template <typename T, int stride>
+SPECTRUM_DEVICE_FUNC inline T* FlatTable<T, stride>::Data(void)
+{
+   return data;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] row Row index
+\return Pointer to the first element of the row
+*/
+template <typename T, int stride>
+SPECTRUM_DEVICE_FUNC inline const T* FlatTable<T, stride>::operator [](int row) const
+{
+   return data + row * stride;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] row Row index
+\return Pointer to the first element of the row
+*/
+template <typename T, int stride>
+SPECTRUM_DEVICE_FUNC inline T* FlatTable<T, stride>::operator [](int row)
+{
+   return data + row * stride;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] row    Row index
+\param[in] length Number of meaningful elements in the row
+\return A view of the row
+*/
+template <typename T, int stride>
+SPECTRUM_DEVICE_FUNC inline TableRow<const T> FlatTable<T, stride>::Row(int row, int length) const
+{
+   return TableRow<const T>{data + row * stride, length};
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] row    Row index
+\param[in] length Number of meaningful elements in the row
+\return A view of the row
+*/
+template <typename T, int stride>
+SPECTRUM_DEVICE_FUNC inline TableRow<T> FlatTable<T, stride>::Row(int row, int length)
+{
+   return TableRow<T>{data + row * stride, length};
+};
+
+};
+
+#endif
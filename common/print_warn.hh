@@ -114,9 +114,10 @@ inline unsigned long CountRecords(std::ifstream& inpfile)
 \param[in] n_nodes Total nodes
 \param[in] n_nbrs  Number of neighbors per node
 \param[in] n_sing  Number of singular nodes
-\param[in] conn    Connectivity list
+\param[in] conn    Connectivity list (any type indexable as "conn[node][i]")
 */
-inline void PrintConnectivity(int n_nodes, int n_nbrs, int n_sing, const int* const* conn)
+template <typename conn_type>
+inline void PrintConnectivity(int n_nodes, int n_nbrs, int n_sing, const conn_type& conn)
 {
    int n_nbrs_actual;
 
@@ -11,9 +11,16 @@ This file is part of the SPECTRUM suite of scientific numerical simulation codes
 
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_randist.h>
+#include <algorithm>
 
 namespace Spectrum {
 
+//! Method to generate normal variates (0: Box-Muller, 1: ziggurat)
+#define RNG_NORMAL_METHOD 1
+
+//! Number of normal variates generated at once
+const int rng_normal_buffer_size = 256;
+
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 // RNG class declaration
 //----------------------------------------------------------------------------------------------------------------------------------------------------
@@ -21,6 +28,8 @@ namespace Spectrum {
 /*!
 \brief A simple wrapper for the GSL random number generator
 \author Vladimir Florinski
+
+Normal variates are generated in blocks of "rng_normal_buffer_size" and handed out from a buffer, so that the cost of a call is mostly a copy.
 */
 class RNG {
 
@@ -29,6 +38,15 @@ private:
 //! An RNG from the GSL library
    gsl_rng* rng_internal = nullptr;
 
+//! Buffer of normal variates
+   mutable double normal_buffer[rng_normal_buffer_size];
+
+//! Index of the next unused variate in "normal_buffer"
+   mutable int normal_next = rng_normal_buffer_size;
+
+//! Refill the buffer of normal variates
+   void FillNormalBuffer(void) const;
+
 public:
 
 //! Default constructor
@@ -46,6 +64,9 @@ public:
 //! Return normally distributed number with variance 1
    double GetNormal(void) const;
 
+//! Return several normally distributed numbers with variance 1
+   void GetNormals(double* out, int n) const;
+
 //! Return a normally distributed radius in polar coordinates with variance 1
    double GetRayleigh(void) const;
 };
@@ -93,6 +114,22 @@ inline double RNG::GetUniform(void) const
    return gsl_rng_uniform(rng_internal);
 };
 
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+inline void RNG::FillNormalBuffer(void) const
+{
+   for(int i = 0; i < rng_normal_buffer_size; i++) {
+#if RNG_NORMAL_METHOD == 1
+      normal_buffer[i] = gsl_ran_gaussian_ziggurat(rng_internal, 1.0);
+#else
+      normal_buffer[i] = gsl_ran_ugaussian(rng_internal);
+#endif
+   };
+   normal_next = 0;
+};
+
 /*!
 \author Vladimir Florinski
 \date 03/04/2022
@@ -100,7 +137,28 @@ inline double RNG::GetUniform(void) const
 */
 inline double RNG::GetNormal(void) const
 {
-   return gsl_ran_ugaussian(rng_internal);
+   if(normal_next == rng_normal_buffer_size) FillNormalBuffer();
+   return normal_buffer[normal_next++];
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[out] out Array of random numbers normally distributed with mean 0 and variance 1
+\param[in]  n   Number of random numbers to generate
+*/
+inline void RNG::GetNormals(double* out, int n) const
+{
+   int n_copy;
+
+   while(n > 0) {
+      if(normal_next == rng_normal_buffer_size) FillNormalBuffer();
+      n_copy = std::min(n, rng_normal_buffer_size - normal_next);
+      std::copy_n(normal_buffer + normal_next, n_copy, out);
+      normal_next += n_copy;
+      out += n_copy;
+      n -= n_copy;
+   };
 };
 
 /*!
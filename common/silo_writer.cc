@@ -0,0 +1,185 @@
+/*!
+\file silo_writer.cc
+\brief Implements a class that writes SILO databases from a background thread
+\author Swati Sharma
+
+This file is part of the SPECTRUM suite of scientific numerical simulation codes. SPECTRUM stands for Space Plasma and Energetic Charged particle TRansport on Unstructured Meshes. The code simulates plasma or neutral particle flows using MHD equations on a grid, transport of cosmic rays using stochastic or grid based methods. The "unstructured" part refers to the use of a geodesic mesh providing a uniform coverage of the surface of a sphere.
+*/
+
+#include "silo_writer.hh"
+
+#ifdef USE_SILO
+
+#include <iostream>
+
+namespace Spectrum {
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// SiloWriter methods
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+SiloWriter::SiloWriter(void)
+{
+   io_thread = std::thread(&SiloWriter::Serve, this);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+SiloWriter::~SiloWriter(void)
+{
+   Finish();
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+void SiloWriter::Serve(void)
+{
+   std::function<int(DBfile*&)> job;
+
+   while(true) {
+      {
+         std::unique_lock<std::mutex> lock(queue_mutex);
+         queue_cond.wait(lock, [this] {return !jobs.empty() || !accepting;});
+         if(jobs.empty()) break;
+         job = std::move(jobs.front());
+         jobs.pop_front();
+      }
+
+// The lock is released while the job is running so that other threads can keep submitting
+      if(job(silofile)) n_errors++;
+   };
+
+// A file left open by the caller is closed here
+   if(silofile) DBClose(silofile);
+   silofile = nullptr;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] job Job to add
+*/
+void SiloWriter::Enqueue(std::function<int(DBfile*&)> job)
+{
+   {
+      std::lock_guard<std::mutex> lock(queue_mutex);
+      if(!accepting) return;
+      jobs.push_back(std::move(job));
+   }
+   queue_cond.notify_one();
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] fname Name of the SILO file
+*/
+void SiloWriter::CreateFile(const std::string& fname)
+{
+   Enqueue([fname](DBfile*& silofile) {
+      if(silofile) DBClose(silofile);
+      silofile = DBCreate(fname.c_str(), DB_CLOBBER, DB_LOCAL, NULL, DB_PDB);
+      if(silofile) return 0;
+      std::cerr << "SiloWriter Error: Could not create " << fname << std::endl;
+      return 1;
+   });
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] job Job to execute on the current database
+
+\note The job is skipped if there is no open database
+*/
+void SiloWriter::Submit(Job job)
+{
+   Enqueue([job = std::move(job)](DBfile*& silofile) {
+      return (silofile ? job(silofile) : 1);
+   });
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+void SiloWriter::CloseFile(void)
+{
+   Enqueue([](DBfile*& silofile) {
+      int err = (silofile ? DBClose(silofile) : 0);
+      silofile = nullptr;
+      return err;
+   });
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return Number of jobs that failed since the writer was created
+*/
+int SiloWriter::Finish(void)
+{
+   {
+      std::lock_guard<std::mutex> lock(queue_mutex);
+      accepting = false;
+   }
+   queue_cond.notify_one();
+   if(io_thread.joinable()) io_thread.join();
+   return n_errors;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// Global functions
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] silofile    SILO database of the root file
+\param[in] mesh_name   Name of the multi-block mesh; each block mesh is "<path><mesh_name>_<block>"
+\param[in] mesh_type   SILO type of the block meshes
+\param[in] block_paths For each block, the file name followed by ":" (or empty if the block is in the root file)
+\param[in] var_names   Names of variables defined on every block
+\param[in] var_type    SILO type of the block variables
+\return Error code from SILO file I/O (zero if no error)
+*/
+int WriteSiloMultiBlock(DBfile* silofile, const std::string& mesh_name, int mesh_type, const std::vector<std::string>& block_paths,
+                        const std::vector<std::string>& var_names, int var_type)
+{
+   int err, block, n_blocks = block_paths.size();
+   std::vector<std::string> names(n_blocks);
+   std::vector<const char*> name_ptrs(n_blocks);
+   std::vector<int> types(n_blocks);
+
+// Meshes
+   for(block = 0; block < n_blocks; block++) {
+      names[block] = block_paths[block] + mesh_name + "_" + std::to_string(block);
+      name_ptrs[block] = names[block].c_str();
+      types[block] = mesh_type;
+   };
+   err = DBPutMultimesh(silofile, mesh_name.c_str(), n_blocks, name_ptrs.data(), types.data(), NULL);
+
+// Variables
+   for(auto& var_name : var_names) {
+      for(block = 0; block < n_blocks; block++) {
+         names[block] = block_paths[block] + var_name + "_" + std::to_string(block);
+         name_ptrs[block] = names[block].c_str();
+         types[block] = var_type;
+      };
+      err |= DBPutMultivar(silofile, var_name.c_str(), n_blocks, name_ptrs.data(), types.data(), NULL);
+   };
+
+   return err;
+};
+
+};
+
+#endif
@@ -0,0 +1,102 @@
+/*!
+\file silo_writer.hh
+\brief Declares a class that writes SILO databases from a background thread
+\author Swati Sharma
+
+This file is part of the SPECTRUM suite of scientific numerical simulation codes. SPECTRUM stands for Space Plasma and Energetic Charged particle TRansport on Unstructured Meshes. The code simulates plasma or neutral particle flows using MHD equations on a grid, transport of cosmic rays using stochastic or grid based methods. The "unstructured" part refers to the use of a geodesic mesh providing a uniform coverage of the surface of a sphere.
+*/
+
+#ifndef SPECTRUM_SILO_WRITER_HH
+#define SPECTRUM_SILO_WRITER_HH
+
+#include "config.h"
+
+#ifdef USE_SILO
+
+#include <silo.h>
+#include <string>
+#include <vector>
+#include <deque>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace Spectrum {
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// SiloWriter class declaration
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\brief Queue of SILO output operations executed by a dedicated I/O thread
+\author Swati Sharma
+
+The SILO library is not thread safe, so every library call is made from the single I/O thread owned by this object, in the order in which the jobs were submitted. A job is a callable that receives the currently open database and returns a SILO error code. Jobs should own (capture by value) the data they write, so that the submitting thread can immediately move on to computing the next output. The calling thread must not make SILO calls of its own until "Finish()" returns.
+*/
+class SiloWriter {
+
+public:
+
+//! Type of an output job
+   using Job = std::function<int(DBfile*)>;
+
+protected:
+
+//! I/O thread
+   std::thread io_thread;
+
+//! Lock for the job queue
+   std::mutex queue_mutex;
+
+//! Signals new jobs or the end of input
+   std::condition_variable queue_cond;
+
+//! Pending jobs
+   std::deque<std::function<int(DBfile*&)>> jobs;
+
+//! Whether more jobs could be submitted
+   bool accepting = true;
+
+//! Number of jobs that returned an error
+   int n_errors = 0;
+
+//! Database currently open (only accessed by the I/O thread)
+   DBfile* silofile = nullptr;
+
+//! Execute jobs until the queue is closed and empty
+   void Serve(void);
+
+//! Add a job to the queue
+   void Enqueue(std::function<int(DBfile*&)> job);
+
+public:
+
+//! Default constructor, starts the I/O thread
+   SiloWriter(void);
+
+//! Destructor, waits for the I/O thread to complete all jobs
+   ~SiloWriter(void);
+
+//! Create a new database, closing the previous one
+   void CreateFile(const std::string& fname);
+
+//! Submit a job writing to the current database
+   void Submit(Job job);
+
+//! Close the current database
+   void CloseFile(void);
+
+//! Wait for all jobs to finish and stop the I/O thread
+   int Finish(void);
+};
+
+//! Write multi-block mesh and variable objects pointing to blocks stored in other files
+int WriteSiloMultiBlock(DBfile* silofile, const std::string& mesh_name, int mesh_type, const std::vector<std::string>& block_paths,
+                        const std::vector<std::string>& var_names, int var_type);
+
+};
+
+#endif
+
+#endif
@@ -68,6 +68,9 @@ struct PrimitiveStateGasdyn : public SimpleArray<double, CL_GASDYN_TOTAL>
 //! Constructor from the base class
    SPECTRUM_DEVICE_FUNC PrimitiveStateGasdyn(const SimpleArray<double, CL_GASDYN_TOTAL>& other);
 
+//! Constructor from a single value
+   SPECTRUM_DEVICE_FUNC explicit PrimitiveStateGasdyn(double a);
+
 //! Calculate the fastest wave speed
    SPECTRUM_DEVICE_FUNC double FastestWave(void) const;
 
@@ -132,6 +135,9 @@ struct ConservedStateGasdyn : public SimpleArray<double, CL_GASDYN_TOTAL>
 //! Constructor from the base class
    SPECTRUM_DEVICE_FUNC ConservedStateGasdyn(const SimpleArray<double, CL_GASDYN_TOTAL>& other);
 
+//! Constructor from a single value
+   SPECTRUM_DEVICE_FUNC explicit ConservedStateGasdyn(double a);
+
 //! Calculate the fastest wave speed
    SPECTRUM_DEVICE_FUNC double FastestWave(void) const;
 
@@ -148,10 +154,10 @@ struct ConservedStateGasdyn : public SimpleArray<double, CL_GASDYN_TOTAL>
    SPECTRUM_DEVICE_FUNC double GetPressure(void) const;
 
 //! Calculate y and z components of momentum from the externally provided flux in a moving frame
-   SPECTRUM_DEVICE_FUNC void FixMomentum(FluxFunctionGasdyn<fluid, n_ind>& flux, double S1, double S2);
+   SPECTRUM_DEVICE_FUNC void FixMomentum(const FluxFunctionGasdyn<fluid, n_ind>& flux, double S1, double S2);
 
 //! Calculate energy from the externally provided flux in a moving frame
-   SPECTRUM_DEVICE_FUNC void FixEnergy(FluxFunctionGasdyn<fluid, n_ind>& flux, double S1, double S2);
+   SPECTRUM_DEVICE_FUNC void FixEnergy(const FluxFunctionGasdyn<fluid, n_ind>& flux, double S1, double S2);
 
 //! Invert vector variables
    SPECTRUM_DEVICE_FUNC void Invert(void);
@@ -202,6 +208,9 @@ struct FluxFunctionGasdyn : public SimpleArray<double, CL_GASDYN_TOTAL>
 //! Constructor from the base class
    SPECTRUM_DEVICE_FUNC FluxFunctionGasdyn(const SimpleArray<double, CL_GASDYN_TOTAL>& other);
 
+//! Constructor from a single value
+   SPECTRUM_DEVICE_FUNC explicit FluxFunctionGasdyn(double a);
+
 //! Invert vector variables
    SPECTRUM_DEVICE_FUNC void Invert(void);
 };
@@ -239,6 +248,17 @@ SPECTRUM_DEVICE_FUNC inline PrimitiveStateGasdyn<fluid, n_ind>::PrimitiveStateGa
 {
 };
 
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] a Value to assign to each component
+*/
+template <int fluid, int n_ind>
+SPECTRUM_DEVICE_FUNC inline PrimitiveStateGasdyn<fluid, n_ind>::PrimitiveStateGasdyn(double a)
+   : SimpleArray<double, CL_GASDYN_TOTAL>(a)
+{
+};
+
 /*!
 \author Vladimir Florinski
 \date 03/16/2024
@@ -373,6 +393,17 @@ SPECTRUM_DEVICE_FUNC inline ConservedStateGasdyn<fluid, n_ind>::ConservedStateGa
 {
 };
 
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] a Value to assign to each component
+*/
+template <int fluid, int n_ind>
+SPECTRUM_DEVICE_FUNC inline ConservedStateGasdyn<fluid, n_ind>::ConservedStateGasdyn(double a)
+   : SimpleArray<double, CL_GASDYN_TOTAL>(a)
+{
+};
+
 /*!
 \author Vladimir Florinski
 \date 03/16/2024
@@ -465,10 +496,10 @@ SPECTRUM_DEVICE_FUNC inline double ConservedStateGasdyn<fluid, n_ind>::GetPressu
 \param[in] S2   Second wave speed
 */
 template <int fluid, int n_ind>
-SPECTRUM_DEVICE_FUNC inline void ConservedStateGasdyn<fluid, n_ind>::FixMomentum(FluxFunctionGasdyn<fluid, n_ind>& flux, double S1, double S2)
+SPECTRUM_DEVICE_FUNC inline void ConservedStateGasdyn<fluid, n_ind>::FixMomentum(const FluxFunctionGasdyn<fluid, n_ind>& flux, double S1, double S2)
 {
-   mom()[1] = flux.mom()[1] / (S1 - S2);
-   mom()[2] = flux.mom()[2] / (S1 - S2);
+   mom()[1] = flux.momf()[1] / (S1 - S2);
+   mom()[2] = flux.momf()[2] / (S1 - S2);
 };
 
 /*!
@@ -479,10 +510,10 @@ SPECTRUM_DEVICE_FUNC inline void ConservedStateGasdyn<fluid, n_ind>::FixMomentum
 \param[in] S2   Second wave speed
 */
 template <int fluid, int n_ind>
-SPECTRUM_DEVICE_FUNC inline void ConservedStateGasdyn<fluid, n_ind>::FixEnergy(FluxFunctionGasdyn<fluid, n_ind>& flux, double S1, double S2)
+SPECTRUM_DEVICE_FUNC inline void ConservedStateGasdyn<fluid, n_ind>::FixEnergy(const FluxFunctionGasdyn<fluid, n_ind>& flux, double S1, double S2)
 {
-   double pre_total = S1 * mom()[0] - flux.mom()[0];
-   enr() = (flux.enr() + pre_total * S2) / (S1 - S2);
+   double pre_total = (S1 - S2) * mom()[0] - flux.momf()[0];
+   enr() = (flux.enrf() + pre_total * S2) / (S1 - S2);
 };
 
 /*!
@@ -528,6 +559,17 @@ SPECTRUM_DEVICE_FUNC inline FluxFunctionGasdyn<fluid, n_ind>::FluxFunctionGasdyn
 {
 };
 
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] a Value to assign to each component
+*/
+template <int fluid, int n_ind>
+SPECTRUM_DEVICE_FUNC inline FluxFunctionGasdyn<fluid, n_ind>::FluxFunctionGasdyn(double a)
+   : SimpleArray<double, CL_GASDYN_TOTAL>(a)
+{
+};
+
 /*!
 \author Vladimir Florinski
 \date 04/09/2024
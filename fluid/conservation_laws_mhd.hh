@@ -98,6 +98,9 @@ struct PrimitiveStateMHD : public SimpleArray<double, CL_MHD_TOTAL>
 //! Constructor from the base class
    SPECTRUM_DEVICE_FUNC PrimitiveStateMHD(const SimpleArray<double, CL_MHD_TOTAL>& other);
 
+//! Constructor from a single value
+   SPECTRUM_DEVICE_FUNC explicit PrimitiveStateMHD(double a);
+
 //! Calculate the fastest wave speed
    SPECTRUM_DEVICE_FUNC double FastestWave(void) const;
 
@@ -180,6 +183,9 @@ struct ConservedStateMHD : public SimpleArray<double, CL_MHD_TOTAL>
 //! Constructor from the base class
    SPECTRUM_DEVICE_FUNC ConservedStateMHD(const SimpleArray<double, CL_MHD_TOTAL>& other);
 
+//! Constructor from a single value
+   SPECTRUM_DEVICE_FUNC explicit ConservedStateMHD(double a);
+
 //! Calculate the fastest wave speed
    SPECTRUM_DEVICE_FUNC double FastestWave(void) const;
 
@@ -196,10 +202,10 @@ struct ConservedStateMHD : public SimpleArray<double, CL_MHD_TOTAL>
    SPECTRUM_DEVICE_FUNC double GetPressure(void) const;
 
 //! Calculate y and z components of momentum from the externally provided flux in a moving frame
-   SPECTRUM_DEVICE_FUNC void FixMomentum(FluxFunctionMHD<fluid, n_ind>& flux, double S1, double S2);
+   SPECTRUM_DEVICE_FUNC void FixMomentum(const FluxFunctionMHD<fluid, n_ind>& flux, double S1, double S2);
 
 //! Calculate energy from the externally provided flux in a moving frame
-   SPECTRUM_DEVICE_FUNC void FixEnergy(FluxFunctionMHD<fluid, n_ind>& flux, double S1, double S2);
+   SPECTRUM_DEVICE_FUNC void FixEnergy(const FluxFunctionMHD<fluid, n_ind>& flux, double S1, double S2);
 
 //! Invert vector variables
    SPECTRUM_DEVICE_FUNC void Invert(void);
@@ -271,6 +277,9 @@ struct FluxFunctionMHD : public SimpleArray<double, CL_MHD_TOTAL>
 //! Constructor from the base class
    SPECTRUM_DEVICE_FUNC FluxFunctionMHD(const SimpleArray<double, CL_MHD_TOTAL>& other);
 
+//! Constructor from a single value
+   SPECTRUM_DEVICE_FUNC explicit FluxFunctionMHD(double a);
+
 //! Invert vector variables
    SPECTRUM_DEVICE_FUNC void Invert(void);
 };
@@ -321,6 +330,17 @@ SPECTRUM_DEVICE_FUNC inline PrimitiveStateMHD<fluid, n_ind>::PrimitiveStateMHD(c
 {
 };
 
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] a Value to assign to each component
+*/
+template <int fluid, int n_ind>
+SPECTRUM_DEVICE_FUNC inline PrimitiveStateMHD<fluid, n_ind>::PrimitiveStateMHD(double a)
+   : SimpleArray<double, CL_MHD_TOTAL>(a)
+{
+};
+
 /*!
 \author Vladimir Florinski
 \date 03/16/2024
@@ -392,12 +412,12 @@ template <int fluid, int n_ind>
 SPECTRUM_DEVICE_FUNC inline FluxFunctionMHD<fluid, n_ind> PrimitiveStateMHD<fluid, n_ind>::ToFlux(bool ind_ok) const
 {
    double enr = Energy(den(), vel().Norm2(), mag().Norm2(), pre(), fluid);
-   double pre_tot = pre() + mag().Norm2() / eightpi;
+   double pre_tot = pre() + mag().Norm2() / M_8PI;
    FluxFunctionMHD<fluid, n_ind> flux;
 
    flux.denf() = den() * vel()[0];
-   flux.momf() = den() * vel()[0] * vel() + pre_tot * gv_nx - (mag()[0] / fourpi) * mag();
-   flux.enrf() = (enr + pre_tot) * vel()[0] - (vel() * mag()) * mag()[0] / fourpi;
+   flux.momf() = den() * vel()[0] * vel() + pre_tot * gv_nx - (mag()[0] / M_4PI) * mag();
+   flux.enrf() = (enr + pre_tot) * vel()[0] - (vel() * mag()) * mag()[0] / M_4PI;
    flux.magf() = vel()[0] * mag() - mag()[0] * vel();
 
 #if CL_MHD_GLM != 0
@@ -406,6 +426,7 @@ SPECTRUM_DEVICE_FUNC inline FluxFunctionMHD<fluid, n_ind> PrimitiveStateMHD<flui
 
 // FIXME should this flux be calculated in the RS?
 //   flux.glmf() = Sqr(CL_MHD_GLMSAFETY * FastestWaveNormal()) * mag()[0];
+   flux.glmf() = 0.0;
 #endif
 
 // Optionally convert the indicator variables
@@ -474,6 +495,17 @@ SPECTRUM_DEVICE_FUNC inline ConservedStateMHD<fluid, n_ind>::ConservedStateMHD(c
 {
 };
 
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] a Value to assign to each component
+*/
+template <int fluid, int n_ind>
+SPECTRUM_DEVICE_FUNC inline ConservedStateMHD<fluid, n_ind>::ConservedStateMHD(double a)
+   : SimpleArray<double, CL_MHD_TOTAL>(a)
+{
+};
+
 /*!
 \author Vladimir Florinski
 \date 03/16/2024
@@ -527,7 +559,7 @@ SPECTRUM_DEVICE_FUNC inline PrimitiveStateMHD<fluid, n_ind> ConservedStateMHD<fl
    prim.pre() = Pressure(den(), prim.vel().Norm2(), mag().Norm2(), enr(), fluid);
    prim.mag() = mag();
 
-#if CL_MHD_LAGR != 0
+#if CL_MHD_GLM != 0
    prim.glm() = glm();
 #endif
 
@@ -550,12 +582,12 @@ SPECTRUM_DEVICE_FUNC inline FluxFunctionMHD<fluid, n_ind> ConservedStateMHD<flui
 {
    GeoVector vel = mom() / den();
    double pre = Pressure(den(), vel.Norm2(), mag().Norm2(), enr(), fluid);
-   double pre_tot = pre + mag().Norm2() / eightpi;
+   double pre_tot = pre + mag().Norm2() / M_8PI;
    FluxFunctionMHD<fluid, n_ind> flux;
 
    flux.denf() = mom()[0];
-   flux.momf() = mom()[0] * vel + pre_tot * gv_nx - (mag()[0] / fourpi) * mag();
-   flux.enrf() = (enr() + pre_tot) * vel[0] - (vel * mag()) * mag()[0] / fourpi;
+   flux.momf() = mom()[0] * vel + pre_tot * gv_nx - (mag()[0] / M_4PI) * mag();
+   flux.enrf() = (enr() + pre_tot) * vel[0] - (vel * mag()) * mag()[0] / M_4PI;
    flux.magf() = vel[0] * mag() - mag()[0] * vel;
 
 #if CL_MHD_GLM != 0
@@ -564,6 +596,7 @@ SPECTRUM_DEVICE_FUNC inline FluxFunctionMHD<fluid, n_ind> ConservedStateMHD<flui
 
 // FIXME should this flux be calculated in the RS?
 //   flux.glmf() = Sqr(CL_MHD_GLMSAFETY * FastestWaveNormal()) * mag()[0];
+   flux.glmf() = 0.0;
 #endif
 
 // Optionally convert the indicator variables
@@ -594,10 +627,10 @@ SPECTRUM_DEVICE_FUNC inline double ConservedStateMHD<fluid, n_ind>::GetPressure(
 \param[in] S2   Second wave speed
 */
 template <int fluid, int n_ind>
-SPECTRUM_DEVICE_FUNC inline void ConservedStateMHD<fluid, n_ind>::FixMomentum(FluxFunctionMHD<fluid, n_ind>& flux, double S1, double S2)
+SPECTRUM_DEVICE_FUNC inline void ConservedStateMHD<fluid, n_ind>::FixMomentum(const FluxFunctionMHD<fluid, n_ind>& flux, double S1, double S2)
 {
-   mom()[1] = (flux.mom()[1] - mag()[0] * mag()[1] / fourpi) / (S1 - S2);
-   mom()[2] = (flux.mom()[2] - mag()[0] * mag()[2] / fourpi) / (S1 - S2);
+   mom()[1] = (flux.momf()[1] - mag()[0] * mag()[1] / M_4PI) / (S1 - S2);
+   mom()[2] = (flux.momf()[2] - mag()[0] * mag()[2] / M_4PI) / (S1 - S2);
 };
 
 /*!
@@ -608,10 +641,10 @@ SPECTRUM_DEVICE_FUNC inline void ConservedStateMHD<fluid, n_ind>::FixMomentum(Fl
 \param[in] S2   Second wave speed
 */
 template <int fluid, int n_ind>
-SPECTRUM_DEVICE_FUNC inline void ConservedStateMHD<fluid, n_ind>::FixEnergy(FluxFunctionMHD<fluid, n_ind>& flux, double S1, double S2)
+SPECTRUM_DEVICE_FUNC inline void ConservedStateMHD<fluid, n_ind>::FixEnergy(const FluxFunctionMHD<fluid, n_ind>& flux, double S1, double S2)
 {
-   double pre_total = S1 * mom()[0] + mag()[0] * mag()[0] / fourpi - flux.mom()[0];
-   enr() = (flux.enr() - (mag()[0] * S2 + (mag()[1] * mom()[1] + mag()[2] * mom()[2]) / den()) * mag()[0] + pre_total * S2) / (S1 - S2);
+   double pre_total = (S1 - S2) * mom()[0] + mag()[0] * mag()[0] / M_4PI - flux.momf()[0];
+   enr() = (flux.enrf() - (mag()[0] * S2 + (mag()[1] * mom()[1] + mag()[2] * mom()[2]) / den()) * mag()[0] / M_4PI + pre_total * S2) / (S1 - S2);
 };
 
 /*!
@@ -671,6 +704,17 @@ SPECTRUM_DEVICE_FUNC inline FluxFunctionMHD<fluid, n_ind>::FluxFunctionMHD(const
 {
 };
 
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] a Value to assign to each component
+*/
+template <int fluid, int n_ind>
+SPECTRUM_DEVICE_FUNC inline FluxFunctionMHD<fluid, n_ind>::FluxFunctionMHD(double a)
+   : SimpleArray<double, CL_MHD_TOTAL>(a)
+{
+};
+
 /*!
 \author Vladimir Florinski
 \date 04/09/2024
@@ -39,7 +39,7 @@ protected:
    cl_prim left_prim;
 
 //! Right primitive state
-   cl_cons rght_prim;
+   cl_prim rght_prim;
 
 //! Resolved primitive state
    cl_prim resv_prim;
@@ -166,6 +166,8 @@ SPECTRUM_DEVICE_FUNC inline cl_flux RiemannSolverBase<cl_prim, cl_cons, cl_flux>
 template<typename cl_prim, typename cl_cons, typename cl_flux>
 class RiemannSolverRusanov : public RiemannSolverBase<cl_prim, cl_cons, cl_flux>
 {
+protected:
+
    using RiemannSolverBase<cl_prim, cl_cons, cl_flux>::left_prim;
    using RiemannSolverBase<cl_prim, cl_cons, cl_flux>::rght_prim;
    using RiemannSolverBase<cl_prim, cl_cons, cl_flux>::resv_prim;
@@ -176,8 +178,6 @@ class RiemannSolverRusanov : public RiemannSolverBase<cl_prim, cl_cons, cl_flux>
    using RiemannSolverBase<cl_prim, cl_cons, cl_flux>::rght_flux;
    using RiemannSolverBase<cl_prim, cl_cons, cl_flux>::resv_flux;
 
-protected:
-
 //! Speed of the extremal waves
    double S;
 
@@ -199,11 +199,11 @@ SPECTRUM_DEVICE_FUNC inline void RiemannSolverRusanov<cl_prim, cl_cons, cl_flux>
 {
    double fastest_wave_left = left_prim.FastestWaveNormal();
    double fastest_wave_rght = rght_prim.FastestWaveNormal();
-   S = std::max(std::abs(left_prim.vel[0]) + fastest_wave_left, std::abs(rght_prim.vel[0]) + fastest_wave_rght);
+   S = std::max(std::abs(left_prim.vel()[0]) + fastest_wave_left, std::abs(rght_prim.vel()[0]) + fastest_wave_rght);
 
-   resv_cons = 0.5 * (left_flux - rght_flux + S * (left_cons + rght_cons)) / S;
+   resv_cons = 0.5 * (cl_cons(left_flux - rght_flux) + S * (left_cons + rght_cons)) / S;
    resv_prim = resv_cons.ToPrimitive(false);
-   resv_flux = 0.5 * (left_flux + rght_flux + S * (left_cons - rght_cons));
+   resv_flux = 0.5 * (left_flux + rght_flux + cl_flux(S * (left_cons - rght_cons)));
 };
 
 //----------------------------------------------------------------------------------------------------------------------------------------------------
@@ -217,6 +217,8 @@ SPECTRUM_DEVICE_FUNC inline void RiemannSolverRusanov<cl_prim, cl_cons, cl_flux>
 template<typename cl_prim, typename cl_cons, typename cl_flux>
 class RiemannSolverHLLE : public RiemannSolverBase<cl_prim, cl_cons, cl_flux>
 {
+protected:
+
    using RiemannSolverBase<cl_prim, cl_cons, cl_flux>::left_prim;
    using RiemannSolverBase<cl_prim, cl_cons, cl_flux>::rght_prim;
    using RiemannSolverBase<cl_prim, cl_cons, cl_flux>::resv_prim;
@@ -227,8 +229,6 @@ class RiemannSolverHLLE : public RiemannSolverBase<cl_prim, cl_cons, cl_flux>
    using RiemannSolverBase<cl_prim, cl_cons, cl_flux>::rght_flux;
    using RiemannSolverBase<cl_prim, cl_cons, cl_flux>::resv_flux;
 
-protected:
-
 //! Speed of the left extremal wave
    double SL;
 
@@ -266,12 +266,12 @@ SPECTRUM_DEVICE_FUNC inline void RiemannSolverHLLE<cl_prim, cl_cons, cl_flux>::I
    double SLStar, SRStar, fastest_wave_star;
 
    do {
-      resv_cons = (SR * rght_cons - SL * left_cons - rght_flux + left_flux) / (SR - SL);
+      resv_cons = (SR * rght_cons - SL * left_cons - cl_cons(rght_flux - left_flux)) / (SR - SL);
       resv_prim = resv_cons.ToPrimitive(false);
       fastest_wave_star = resv_prim.FastestWaveNormal();
 
-      SLStar = resv_prim.vel[0] - fastest_wave_star;
-      SRStar = resv_prim.vel[0] + fastest_wave_star;
+      SLStar = resv_prim.vel()[0] - fastest_wave_star;
+      SRStar = resv_prim.vel()[0] + fastest_wave_star;
 
       if((SLStar - SL >= 0.0) && (SR - SRStar >= 0.0)) break;
       SL = std::min(SL, SLStar);
@@ -321,11 +321,11 @@ SPECTRUM_DEVICE_FUNC inline void RiemannSolverHLLE<cl_prim, cl_cons, cl_flux>::S
 
 // Riemann fan is open - calculate the intermediate state and flux
    else {
-      prime_flux_left = SL * left_cons - left_flux;
-      prime_flux_rght = SR * rght_cons - rght_flux;
-      resv_cons = (prime_flux_rght - prime_flux_left) / (SR - SL);
+      prime_flux_left = cl_flux(SL * left_cons) - left_flux;
+      prime_flux_rght = cl_flux(SR * rght_cons) - rght_flux;
+      resv_cons = cl_cons(prime_flux_rght - prime_flux_left) / (SR - SL);
       resv_prim = resv_cons.ToPrimitive(false);
-      resv_flux = (SR * left_flux - SL * rght_flux + SR * SL * (rght_cons - left_cons)) / (SR - SL);
+      resv_flux = (SR * left_flux - SL * rght_flux + cl_flux(SR * SL * (rght_cons - left_cons))) / (SR - SL);
    };   
 };
 
@@ -340,6 +340,8 @@ SPECTRUM_DEVICE_FUNC inline void RiemannSolverHLLE<cl_prim, cl_cons, cl_flux>::S
 template<typename cl_prim, typename cl_cons, typename cl_flux>
 class RiemannSolverHLLC : public RiemannSolverHLLE<cl_prim, cl_cons, cl_flux>
 {
+protected:
+
    using RiemannSolverBase<cl_prim, cl_cons, cl_flux>::left_prim;
    using RiemannSolverBase<cl_prim, cl_cons, cl_flux>::rght_prim;
    using RiemannSolverBase<cl_prim, cl_cons, cl_flux>::resv_prim;
@@ -356,8 +358,6 @@ class RiemannSolverHLLC : public RiemannSolverHLLE<cl_prim, cl_cons, cl_flux>
    using RiemannSolverHLLE<cl_prim, cl_cons, cl_flux>::prime_flux_rght;
    using RiemannSolverHLLE<cl_prim, cl_cons, cl_flux>::IterateStarState;
 
-protected:
-
 //! Speed of the centeral wave
    double SC;
 
@@ -392,32 +392,32 @@ SPECTRUM_DEVICE_FUNC inline void RiemannSolverHLLC<cl_prim, cl_cons, cl_flux>::S
 
 // Intermediate speed to the right - compute the left intermediate state
    if(SC > 0.0) {
-      resv_prim.den() = prime_flux_left.den() / (SL - SC); // V0
+      resv_prim.den() = prime_flux_left.denf() / (SL - SC); // V0
       resv_cons.mom()[0] = resv_prim.den() * SC; // U1
-      resv_cons.FixEnergy(prime_flux_left, SL, SC); // U4
       resv_cons.den() = resv_prim.den(); // U0
       resv_cons.FixMomentum(prime_flux_left, SL, SC); // U2,U3
+      resv_cons.FixEnergy(prime_flux_left, SL, SC); // U4
       resv_prim.vel()[1] = resv_cons.mom()[1] / resv_prim.den(); // V2
       resv_prim.vel()[2] = resv_cons.mom()[2] / resv_prim.den(); // V3
       resv_prim.pre() = resv_cons.GetPressure(); // V4
-      resv_flux = left_flux - SL * (left_cons - resv_cons);
+      resv_flux = left_flux - cl_flux(SL * (left_cons - resv_cons));
    }
 
 // Intermediate speed to the left - compute the right intermediate state
    else {
-      resv_prim.den() = prime_flux_rght.den() / (SR - SC); // V0
+      resv_prim.den() = prime_flux_rght.denf() / (SR - SC); // V0
       resv_cons.mom()[0] = resv_prim.den() * SC; // U1
-      resv_cons.FixEnergy(prime_flux_rght, SR, SC); // U4
       resv_cons.den() = resv_prim.den(); // U0
       resv_cons.FixMomentum(prime_flux_rght, SR, SC); // U2,U3
+      resv_cons.FixEnergy(prime_flux_rght, SR, SC); // U4
       resv_prim.vel()[1] = resv_cons.mom()[1] / resv_prim.den(); // V2
       resv_prim.vel()[2] = resv_cons.mom()[2] / resv_prim.den(); // V3
       resv_prim.pre() = resv_cons.GetPressure(); // V4
-      resv_flux = rght_flux - SR * (rght_cons - resv_cons);
+      resv_flux = rght_flux - cl_flux(SR * (rght_cons - resv_cons));
    };   
 
 // Test for small pressure and possibly revert to HLLE
-   if(resv_prim.pre() / resv_cons.enr() < tiny) {
+   if(resv_prim.pre() / resv_cons.enr() < sp_tiny) {
       RiemannSolverHLLE<cl_prim, cl_cons, cl_flux>::SolveInternal();
 #ifdef GEO_DEBUG
       PrintMessage(__FILE__, __LINE__, "HLLC solver pressure underflow, reverting to HLLE", true);
@@ -438,6 +438,8 @@ Ref: Pogorelov, N. V., and Semenov, A. Y., Solar Wind Interaction with the Magne
 template<typename cl_prim, typename cl_cons, typename cl_flux>
 class RiemannSolverNoreflect : public RiemannSolverBase<cl_prim, cl_cons, cl_flux>
 {
+protected:
+
    using RiemannSolverBase<cl_prim, cl_cons, cl_flux>::left_prim;
    using RiemannSolverBase<cl_prim, cl_cons, cl_flux>::rght_prim;
    using RiemannSolverBase<cl_prim, cl_cons, cl_flux>::resv_prim;
@@ -448,8 +450,6 @@ class RiemannSolverNoreflect : public RiemannSolverBase<cl_prim, cl_cons, cl_flu
    using RiemannSolverBase<cl_prim, cl_cons, cl_flux>::rght_flux;
    using RiemannSolverBase<cl_prim, cl_cons, cl_flux>::resv_flux;
 
-protected:
-
 //! Direction of the outflow (+1 or -1)
    int dir;
 
@@ -0,0 +1,231 @@
+/*!
+\file riemann_solver_batch.hh
+\brief Declares batched versions of the Riemann solvers that process arrays of interfaces
+\author Swati Sharma
+
+This file is part of the SPECTRUM suite of scientific numerical simulation codes. SPECTRUM stands for Space Plasma and Energetic Charged particle TRansport on Unstructured Meshes. The code simulates plasma or neutral particle flows using MHD equations on a grid, transport of cosmic rays using stochastic or grid based methods. The "unstructured" part refers to the use of a geodesic mesh providing a uniform coverage of the surface of a sphere.
+*/
+
+#ifndef SPECTRUM_RIEMANN_SOLVER_BATCH_HH
+#define SPECTRUM_RIEMANN_SOLVER_BATCH_HH
+
+#include "fluid/riemann_solver.hh"
+
+namespace Spectrum {
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// RiemannBatchBase class declaration
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\brief Base class template for batched Riemann solvers
+\author Swati Sharma
+
+The solver is selected at compile time with the curiously recurring template pattern: the derived class provides a static "Flux()" function that computes the interface flux for one pair of states, and the base class applies it to every interface in a structure of arrays. There are no virtual calls and no member state, so the per-interface code is fully inlined into the loop over faces. States are primitive, with the vectors already rotated into the interface frame (normal component first). All arrays are stored as [var][face].
+*/
+template <typename solver_type, typename cl_prim, typename cl_cons, typename cl_flux>
+class RiemannBatchBase
+{
+public:
+
+//! Number of variables per state
+   static constexpr int n_vars = sizeof(cl_prim) / sizeof(double);
+
+//! Solve the Riemann problems for a range of interfaces
+   SPECTRUM_DEVICE_FUNC static void Solve(int n_faces, int stride, const double* left, const double* rght, double* flux);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in]  n_faces Number of interfaces
+\param[in]  stride  Distance between consecutive variables of one interface in the arrays
+\param[in]  left    Left primitive states, [var][face]
+\param[in]  rght    Right primitive states, [var][face]
+\param[out] flux    Interface fluxes, [var][face]
+*/
+template <typename solver_type, typename cl_prim, typename cl_cons, typename cl_flux>
+SPECTRUM_DEVICE_FUNC inline void RiemannBatchBase<solver_type, cl_prim, cl_cons, cl_flux>::Solve(int n_faces, int stride, const double* left,
+                                                                                                 const double* rght, double* flux)
+{
+#pragma omp simd
+   for(auto face = 0; face < n_faces; face++) {
+      cl_prim left_prim, rght_prim;
+      cl_flux resv_flux;
+
+      for(auto var = 0; var < n_vars; var++) {
+         left_prim[var] = left[var * stride + face];
+         rght_prim[var] = rght[var * stride + face];
+      };
+
+      solver_type::Flux(left_prim, rght_prim, resv_flux);
+
+      for(auto var = 0; var < n_vars; var++) flux[var * stride + face] = resv_flux[var];
+   };
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// RiemannBatchRusanov class declaration
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\brief Batched Rusanov Riemann solver class template
+\author Swati Sharma
+*/
+template <typename cl_prim, typename cl_cons, typename cl_flux>
+class RiemannBatchRusanov : public RiemannBatchBase<RiemannBatchRusanov<cl_prim, cl_cons, cl_flux>, cl_prim, cl_cons, cl_flux>
+{
+public:
+
+//! Compute the flux for one interface
+   SPECTRUM_DEVICE_FUNC static void Flux(const cl_prim& left_prim, const cl_prim& rght_prim, cl_flux& resv_flux);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in]  left_prim Left primitive state
+\param[in]  rght_prim Right primitive state
+\param[out] resv_flux Resolved flux function
+*/
+template <typename cl_prim, typename cl_cons, typename cl_flux>
+SPECTRUM_DEVICE_FUNC inline void RiemannBatchRusanov<cl_prim, cl_cons, cl_flux>::Flux(const cl_prim& left_prim, const cl_prim& rght_prim, cl_flux& resv_flux)
+{
+   double S = std::max(std::abs(left_prim.vel()[0]) + left_prim.FastestWaveNormal(), std::abs(rght_prim.vel()[0]) + rght_prim.FastestWaveNormal());
+
+   resv_flux = 0.5 * (left_prim.ToFlux(false) + rght_prim.ToFlux(false) + cl_flux(S * (left_prim.ToConserved(false) - rght_prim.ToConserved(false))));
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// RiemannBatchHLLE class declaration
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\brief Batched HLLE Riemann solver class template
+\author Swati Sharma
+*/
+template <typename cl_prim, typename cl_cons, typename cl_flux>
+class RiemannBatchHLLE : public RiemannBatchBase<RiemannBatchHLLE<cl_prim, cl_cons, cl_flux>, cl_prim, cl_cons, cl_flux>
+{
+public:
+
+//! Compute the extremal wave speeds
+   SPECTRUM_DEVICE_FUNC static void WaveSpeeds(const cl_prim& left_prim, const cl_prim& rght_prim, double& SL, double& SR);
+
+//! Compute the flux for one interface
+   SPECTRUM_DEVICE_FUNC static void Flux(const cl_prim& left_prim, const cl_prim& rght_prim, cl_flux& resv_flux);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in]  left_prim Left primitive state
+\param[in]  rght_prim Right primitive state
+\param[out] SL        Speed of the left extremal wave
+\param[out] SR        Speed of the right extremal wave
+*/
+template <typename cl_prim, typename cl_cons, typename cl_flux>
+SPECTRUM_DEVICE_FUNC inline void RiemannBatchHLLE<cl_prim, cl_cons, cl_flux>::WaveSpeeds(const cl_prim& left_prim, const cl_prim& rght_prim,
+                                                                                          double& SL, double& SR)
+{
+   double fastest_wave_left = left_prim.FastestWaveNormal();
+   double fastest_wave_rght = rght_prim.FastestWaveNormal();
+
+   SL = std::min(left_prim.vel()[0] - fastest_wave_left, rght_prim.vel()[0] - fastest_wave_rght);
+   SR = std::max(left_prim.vel()[0] + fastest_wave_left, rght_prim.vel()[0] + fastest_wave_rght);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in]  left_prim Left primitive state
+\param[in]  rght_prim Right primitive state
+\param[out] resv_flux Resolved flux function
+\note The supersonic cases are folded into the HLL formula by clipping the wave speeds at zero, which gives the same flux without branches.
+*/
+template <typename cl_prim, typename cl_cons, typename cl_flux>
+SPECTRUM_DEVICE_FUNC inline void RiemannBatchHLLE<cl_prim, cl_cons, cl_flux>::Flux(const cl_prim& left_prim, const cl_prim& rght_prim, cl_flux& resv_flux)
+{
+   double SL, SR;
+   WaveSpeeds(left_prim, rght_prim, SL, SR);
+   SL = std::min(SL, 0.0);
+   SR = std::max(SR, 0.0);
+
+   resv_flux = (SR * left_prim.ToFlux(false) - SL * rght_prim.ToFlux(false)
+             + cl_flux(SR * SL * (rght_prim.ToConserved(false) - left_prim.ToConserved(false)))) / (SR - SL);
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// RiemannBatchHLLC class declaration
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\brief Batched HLLC Riemann solver class template
+\author Swati Sharma
+
+Ref: Li, S., An HLLC Riemann Solver for Magneto-Hydrodynamics, Journal of Computational Physics, v. 203, p. 344 (2005).
+*/
+template <typename cl_prim, typename cl_cons, typename cl_flux>
+class RiemannBatchHLLC : public RiemannBatchBase<RiemannBatchHLLC<cl_prim, cl_cons, cl_flux>, cl_prim, cl_cons, cl_flux>
+{
+public:
+
+//! Compute the flux for one interface
+   SPECTRUM_DEVICE_FUNC static void Flux(const cl_prim& left_prim, const cl_prim& rght_prim, cl_flux& resv_flux);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in]  left_prim Left primitive state
+\param[in]  rght_prim Right primitive state
+\param[out] resv_flux Resolved flux function
+*/
+template <typename cl_prim, typename cl_cons, typename cl_flux>
+SPECTRUM_DEVICE_FUNC inline void RiemannBatchHLLC<cl_prim, cl_cons, cl_flux>::Flux(const cl_prim& left_prim, const cl_prim& rght_prim, cl_flux& resv_flux)
+{
+   double SL, SR, SC, S1;
+   cl_cons left_cons = left_prim.ToConserved(false);
+   cl_cons rght_cons = rght_prim.ToConserved(false);
+   cl_flux left_flux = left_prim.ToFlux(false);
+   cl_flux rght_flux = rght_prim.ToFlux(false);
+
+   RiemannBatchHLLE<cl_prim, cl_cons, cl_flux>::WaveSpeeds(left_prim, rght_prim, SL, SR);
+
+// Supersonic flows
+   if(SR <= 0.0) {
+      resv_flux = rght_flux;
+      return;
+   }
+   else if(SL >= 0.0) {
+      resv_flux = left_flux;
+      return;
+   };
+
+// HLL intermediate state gives the speed of the central wave and the transverse components
+   cl_flux prime_flux_left = cl_flux(SL * left_cons) - left_flux;
+   cl_flux prime_flux_rght = cl_flux(SR * rght_cons) - rght_flux;
+   cl_cons resv_cons = cl_cons(prime_flux_rght - prime_flux_left) / (SR - SL);
+   SC = resv_cons.mom()[0] / resv_cons.den();
+
+// Choose the side of the central wave and build the intermediate state there
+   const cl_flux& prime_flux = (SC > 0.0 ? prime_flux_left : prime_flux_rght);
+   const cl_cons& side_cons = (SC > 0.0 ? left_cons : rght_cons);
+   const cl_flux& side_flux = (SC > 0.0 ? left_flux : rght_flux);
+   S1 = (SC > 0.0 ? SL : SR);
+
+   resv_cons.den() = prime_flux.denf() / (S1 - SC);
+   resv_cons.mom()[0] = resv_cons.den() * SC;
+   resv_cons.FixMomentum(prime_flux, S1, SC);
+   resv_cons.FixEnergy(prime_flux, S1, SC);
+
+// Revert to HLLE for small pressure
+   if(resv_cons.GetPressure() / resv_cons.enr() < sp_tiny) {
+      resv_flux = (SR * left_flux - SL * rght_flux + cl_flux(SR * SL * (rght_cons - left_cons))) / (SR - SL);
+   }
+   else resv_flux = side_flux - cl_flux(S1 * (side_cons - resv_cons));
+};
+
+};
+
+#endif
@@ -47,6 +47,9 @@ public:
 //! Default constructor
    DrawableTesselation(void) = default;
 
+//! Constructor from a cache file
+   explicit DrawableTesselation(const std::string& cache_file);
+
 //! Draw a projection of the grid onto the xz plane.
    void DrawGridArcs(int div, bool opaque, double rot_z, double rot_x, bool smooth) const;
 
@@ -65,6 +68,17 @@ public:
 
 };
 
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] cache_file Name of the tesselation cache file
+*/
+template <PolyType poly_type, int max_division>
+inline DrawableTesselation<poly_type, max_division>::DrawableTesselation(const std::string& cache_file)
+                                                   : SphericalTesselation<poly_type, max_division>(cache_file)
+{
+};
+
 };
 
 #endif
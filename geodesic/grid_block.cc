@@ -74,13 +74,9 @@ SPECTRUM_DEVICE_FUNC void GridBlock<verts_per_face>::SetDimensions(int width, in
    };
 
 // Allocate duplicate element lists (used for singular corners). We use continuous storage so that the corners are stored in sequence and can be addressed as a single array.
-   dup_vert[0] = Create2D<int>(verts_per_face * (ghost_width + 1), 2);
-   dup_edge[0] = Create2D<int>(verts_per_face * ghost_width, 2);
-   for(auto corner = 1; corner < verts_per_face; corner++) {
-      dup_vert[corner] = dup_vert[corner - 1] + ghost_width + 1;
-      dup_edge[corner] = dup_edge[corner - 1] + ghost_width;
-   };
-   missing_faces = Create2D<int>(3, verts_per_face * FaceCount(ghost_width));
+   dup_vert.Allocate(verts_per_face * (ghost_width + 1));
+   dup_edge.Allocate(verts_per_face * ghost_width);
+   missing_faces.Allocate(verts_per_face * FaceCount(ghost_width));
 
 // Allocate coordinates
    block_vert_cart = new GeoVector[n_verts_withghost];
@@ -116,6 +112,7 @@ SPECTRUM_DEVICE_FUNC void GridBlock<verts_per_face>::FreeStorage()
    delete[] r_in;
    delete[] r2_in;
    delete[] r3_in;
+   delete[] rp_in;
    delete[] dr;
    delete[] r_mp;
    delete[] drp;
@@ -134,9 +131,9 @@ SPECTRUM_DEVICE_FUNC void GridBlock<verts_per_face>::FreeStorage()
    delete[] block_vert_cart;
 
 // Free up duplicate element lists
-   Delete2D(dup_vert[0]);
-   Delete2D(dup_edge[0]);
-   Delete2D(missing_faces);
+   dup_vert.Free();
+   dup_edge.Free();
+   missing_faces.Free();
 };
 
 /*!
@@ -174,10 +171,10 @@ SPECTRUM_DEVICE_FUNC void GridBlock<verts_per_face>::AssociateMesh(int index, do
    dist_map = dist_map_in;
    dxi = (ximax - ximin) / n_shells;
 
-// Compute the interface coordinates using the supplied distance map
+// Compute the interface coordinates using the supplied distance map. The map is applied to the whole array in one call.
+   for(k = 0; k <= n_shells_withghost; k++) xi_in[k] = ximin + (k - ghost_height) * dxi;
+   dist_map->GetPhysicalArray(n_shells_withghost + 1, xi_in, r_in);
    for(k = 0; k <= n_shells_withghost; k++) {
-      xi_in[k] = ximin + (k - ghost_height) * dxi;
-      r_in[k] = dist_map->GetPhysical(xi_in[k]);
       r2_in[k] = Sqr(r_in[k]);
       r3_in[k] = Cube(r_in[k]);
    };
@@ -193,7 +190,7 @@ SPECTRUM_DEVICE_FUNC void GridBlock<verts_per_face>::AssociateMesh(int index, do
    Rmax = dist_map->GetPhysical(1.0);
    LogRmax_Rmin = log(Rmax / Rmin);
    for(k = 0; k <= n_shells_withghost; k++) {
-      rp_in[k] = Rmin * pow(Rmax / Rmin, xi_in[k]);
+      rp_in[k] = Rmin * exp(LogRmax_Rmin * xi_in[k]);
    };
 
 // Compute the EC shell widths
@@ -226,11 +223,11 @@ SPECTRUM_DEVICE_FUNC void GridBlock<verts_per_face>::FixSingularCorners(void)
 // Reset the "dup" arrays
    for(corner = 0; corner < verts_per_face; corner++) {
       for(i_rot = 0; i_rot <= ghost_width; i_rot++) {
-         dup_vert[corner][i_rot][0] = -1;
-         dup_vert[corner][i_rot][1] = -1;
+         DupVert(corner, i_rot)[0] = -1;
+         DupVert(corner, i_rot)[1] = -1;
          if(i_rot != ghost_width) {
-            dup_edge[corner][i_rot][0] = -1;
-            dup_edge[corner][i_rot][1] = -1;
+            DupEdge(corner, i_rot)[0] = -1;
+            DupEdge(corner, i_rot)[1] = -1;
          };
       };
    };
@@ -261,16 +258,16 @@ SPECTRUM_DEVICE_FUNC void GridBlock<verts_per_face>::FixSingularCorners(void)
             j = j_origin + rotated_verts[rot][1][0] * i_rot + rotated_verts[rot][1][1] * j_rot;
             vert = vert_index_sector[i][j];
 
-// Check if it is a duplicate vertex (lies on the cut line). In rotated coordinates, the cut line is side "0" and side "verts_per_face-1". The main block corner enters into both "dup_vert[corner][i_rot][0]" and "dup_vert[corner][j_rot][1]".
+// Check if it is a duplicate vertex (lies on the cut line). In rotated coordinates, the cut line is side "0" and side "verts_per_face-1". The main block corner enters into both "DupVert(corner, i_rot)[0]" and "DupVert(corner, j_rot)[1]".
             bl_side = BoundaryVert(base_vert, ghost_width, i_rot, j_rot);
             bl_corner = CornerVert(base_vert, ghost_width, i_rot, j_rot);
             dup_found = false;
             if((bl_side == 0) || (bl_corner == 0) || (bl_corner == 1)) {
-               dup_vert[corner][i_rot][0] = vert;
+               DupVert(corner, i_rot)[0] = vert;
                dup_found = true;
             };
             if((bl_side == verts_per_face - 1) || (bl_corner == verts_per_face - 1) || (bl_corner == 0)) {
-               dup_vert[corner][j_rot][1] = vert;
+               DupVert(corner, j_rot)[1] = vert;
                dup_found = true;
             }; 
 
@@ -300,11 +297,11 @@ SPECTRUM_DEVICE_FUNC void GridBlock<verts_per_face>::FixSingularCorners(void)
                bl_side = BoundaryEdge(base_vert, ghost_width, etype_rot, i_rot, j_rot);
                dup_found = false;
                if(bl_side == 0) {
-                  dup_edge[corner][i_rot][0] = edge;
+                  DupEdge(corner, i_rot)[0] = edge;
                   dup_found = true;
                };
                if(bl_side == verts_per_face - 1) {
-                  dup_edge[corner][j_rot][1] = edge;
+                  DupEdge(corner, j_rot)[1] = edge;
                   dup_found = true;
                };
 
@@ -354,9 +351,9 @@ SPECTRUM_DEVICE_FUNC void GridBlock<verts_per_face>::FixSingularCorners(void)
             for(it = 0; it < verts_per_face; it++) ff_local[face][it] = -1;
 
 // Store the replacement faces. The first replacement face is clock-wise, and the second is counter-clockwise from the mising face.
-            missing_faces[0][n_mf] = face;
-            missing_faces[1][n_mf] = face_index_sector[i1][j1];
-            missing_faces[2][n_mf] = face_index_sector[i2][j2];
+            missing_faces[n_mf][0] = face;
+            missing_faces[n_mf][1] = face_index_sector[i1][j1];
+            missing_faces[n_mf][2] = face_index_sector[i2][j2];
             n_mf++;
 
 // The steps in i and j are different in TAS for odd and even j_rot, but the same in QAS.
@@ -390,8 +387,8 @@ SPECTRUM_DEVICE_FUNC void GridBlock<verts_per_face>::FixSingularCorners(void)
 
 // Fix VV, VE, VF of vertices on the cut line. The limits on this loop are wider by 1 in each direction to acommodate VF.
       for(i_rot = 1; i_rot <= ghost_width; i_rot++) {
-         vert1 = dup_vert[corner][i_rot][0];
-         vert2 = dup_vert[corner][i_rot][1];
+         vert1 = DupVert(corner, i_rot)[0];
+         vert2 = DupVert(corner, i_rot)[1];
 
 // For QAS 1 VV/VE and 2 VF neighbors are replaced and for TAS 2 VV/VE and 3 VF neighbors are replaced. The limits on this loop are wider by 1 in each direction to acommodate VF.
          for(iiv = -1; iiv < edges_per_vert / 2; iiv++) {
@@ -421,14 +418,14 @@ SPECTRUM_DEVICE_FUNC void GridBlock<verts_per_face>::FixSingularCorners(void)
       };
 
 // The corner has one less neighbor. We can eliminate either neighbor "iv1" or "iv2".
-      vert1 = dup_vert[corner][0][0];
+      vert1 = DupVert(corner, 0)[0];
       vv_local[vert1][iv1] = -1;
       ve_local[vert1][iv1] = -1;
       vf_local[vert1][iv1] = -1;
 
 // Determine which edge neighbors to replace. This depends on the edge orientation (inward or outward along the cut), so we test the first edges (right and left) in "dup_edge" to see where "vert1" is located in their EV lists.
-      edge1 = dup_edge[corner][0][0];
-      edge2 = dup_edge[corner][0][1];
+      edge1 = DupEdge(corner, 0)[0];
+      edge2 = DupEdge(corner, 0)[1];
 
 // Right side: replace neighbor 0 if outward, neighbor 1 if inward. Left side: repalce neighbor 1 if outward, neighbor 2 if inward.
       it1 = (vert1 == ev_local[edge1][0] ? 1 : 0);
@@ -436,8 +433,8 @@ SPECTRUM_DEVICE_FUNC void GridBlock<verts_per_face>::FixSingularCorners(void)
 
 // Fix EF, and FF of faces adjacent to the cut line - one element only.
       for(i_rot = 0; i_rot <= ghost_width - 1; i_rot++) {
-         edge1 = dup_edge[corner][i_rot][0];
-         edge2 = dup_edge[corner][i_rot][1];
+         edge1 = DupEdge(corner, i_rot)[0];
+         edge2 = DupEdge(corner, i_rot)[1];
          face1 = ef_local[edge1][it1];
          face2 = ef_local[edge2][it2];
 
@@ -494,7 +491,7 @@ void GridBlock<verts_per_face>::GenerateSiloIndexing(void)
 // The vertex is part of the SILO ghost layer and eligible to be included in the list. If it is a duplicate vertex (lies on the cut line), it must be only included once.
             if(include_ghost) {
                if(BITS_RAISED(vert_mask[vert], GEOELM_CUTL)) {
-                  idx_dup = InList(verts_per_face * (ghost_width + 1) * 2, dup_vert[0][0], vert);
+                  idx_dup = InList(verts_per_face * (ghost_width + 1) * 2, dup_vert.Data(), vert);
                   if(is_odd(idx_dup)) continue;
                };
                vert_to_silo[vert] = n_verts_silo++;
@@ -625,8 +622,8 @@ int GridBlock<verts_per_face>::WriteSiloMesh(DBfile* silofile, bool phys_units)
 
 // Check if the vertex is a duplicate (odd idx_dup), in which case it must be replaced with the primary (idx_dup-1).
                if(vert_mask[vert] & GEOELM_CUTL) {
-                  idx_dup = InList(verts_per_face * (ghost_width + 1) * 2, dup_vert[0][0], vert);
-                  if(is_odd(idx_dup)) vert = dup_vert[0][0][idx_dup - 1];
+                  idx_dup = InList(verts_per_face * (ghost_width + 1) * 2, dup_vert.Data(), vert);
+                  if(is_odd(idx_dup)) vert = dup_vert.Data()[idx_dup - 1];
                };
                znodelist[idx2++] = (k - k1 + zv_silo[ivz][0]) * n_verts_silo + vert_to_silo[vert];
             };
@@ -9,10 +9,13 @@ This file is part of the SPECTRUM suite of scientific numerical simulation codes
 #ifndef SPECTRUM_GRID_BLOCK
 #define SPECTRUM_GRID_BLOCK
 
+#include <algorithm>
+
 #ifdef USE_SILO
 #include <silo.h>
 #endif
 #include "common/vectors.hh"
+#include "common/flat_table.hh"
 #include "geometry/distance_map.hh"
 #include "geodesic/geodesic_sector.hh"
 #include "geodesic/spherical_slab.hh"
@@ -113,14 +116,14 @@ protected:
 //! Flag telling whether corners are singular
    bool corner_type[verts_per_face];
 
-//! List of duplicate vertices at cut lines
-   int** dup_vert[verts_per_face] = {nullptr};
+//! List of duplicate vertices at cut lines (right, left), all corners stored in sequence
+   FlatTable<int, 2> dup_vert;
 
-//! List of duplicate edges at cut lines
-   int** dup_edge[verts_per_face] = {nullptr};
+//! List of duplicate edges at cut lines (right, left), all corners stored in sequence
+   FlatTable<int, 2> dup_edge;
 
-//! Mapping of the existing faces into the missing block at singular corners
-   int** missing_faces = nullptr;
+//! Mapping of the existing faces into the missing block at singular corners (missing, clockwise replacement, counter-clockwise replacement)
+   FlatTable<int, 3> missing_faces;
 
 //! Radial distance of the lower boundary of the entire domain
    double Rmin;
@@ -205,6 +208,12 @@ protected:
 //! Return (i,j) coordinates of a corner vertex
    SPECTRUM_DEVICE_FUNC void CornerCoords(int corner, int& i, int& j) const;
 
+//! Return the pair of duplicate vertices at a given distance from a corner
+   SPECTRUM_DEVICE_FUNC int* DupVert(int corner, int i_rot);
+
+//! Return the pair of duplicate edges at a given distance from a corner
+   SPECTRUM_DEVICE_FUNC int* DupEdge(int corner, int i_rot);
+
 //! Determine whether a vertex belongs to the sector's interior (including boundary) - vert version
    SPECTRUM_DEVICE_FUNC bool IsInteriorVert_Int(int vert) const;
 
@@ -238,6 +247,9 @@ public:
    SPECTRUM_DEVICE_FUNC void AssociateMesh(int index, double ximin, double ximax, const bool* corners, const bool* borders, const GeoVector* vcart,
                                            std::shared_ptr<DistanceBase> dist_map_in);
 
+//! Find the shell containing a given radial distance
+   SPECTRUM_DEVICE_FUNC int ShellIndex(double r) const;
+
 #ifdef USE_SILO
 //! Write the entire block to a SILO database
    int WriteSilo(DBfile* silofile, bool phys_units) const;
@@ -289,6 +301,54 @@ SPECTRUM_DEVICE_FUNC inline void GridBlock<verts_per_face>::CornerCoords(int cor
    };
 };
 
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] corner Corner index
+\param[in] i_rot  Distance from the corner along the cut line
+\return Pointer to the right and left duplicate vertices
+*/
+template <int verts_per_face>
+SPECTRUM_DEVICE_FUNC inline int* GridBlock<verts_per_face>::DupVert(int corner, int i_rot)
+{
+   return dup_vert[corner * (ghost_width + 1) + i_rot];
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] corner Corner index
+\param[in] i_rot  Distance from the corner along the cut line
+\return Pointer to the right and left duplicate edges
+*/
+template <int verts_per_face>
+SPECTRUM_DEVICE_FUNC inline int* GridBlock<verts_per_face>::DupEdge(int corner, int i_rot)
+{
+   return dup_edge[corner * ghost_width + i_rot];
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] r Radial distance
+\return Shell index (including ghost shells), or -1 if "r" is outside the block
+\note The shell is found in constant time from the inverse distance map, followed by a one step correction for roundoff near the interfaces.
+*/
+template <int verts_per_face>
+SPECTRUM_DEVICE_FUNC inline int GridBlock<verts_per_face>::ShellIndex(double r) const
+{
+   double xi;
+   int k;
+
+   if((r < r_in[0]) || (r >= r_in[n_shells_withghost])) return -1;
+
+   dist_map->GetReferenceArray(1, &r, &xi);
+   k = std::clamp((int)((xi - xi_in[0]) / dxi), 0, n_shells_withghost - 1);
+   if(r < r_in[k]) k--;
+   else if(r >= r_in[k + 1]) k++;
+   return k;
+};
+
 /*!
 \author Vladimir Florinski
 \date 05/08/2024
@@ -0,0 +1,573 @@
+/*!
+\file mhd_block.cc
+\brief Implements a grid block that advances the ideal MHD equations with a finite volume method
+\author Swati Sharma
+
+This file is part of the SPECTRUM suite of scientific numerical simulation codes. SPECTRUM stands for Space Plasma and Energetic Charged particle TRansport on Unstructured Meshes. The code simulates plasma or neutral particle flows using MHD equations on a grid, transport of cosmic rays using stochastic or grid based methods. The "unstructured" part refers to the use of a geodesic mesh providing a uniform coverage of the surface of a sphere.
+*/
+
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <limits>
+#include "geodesic/mhd_block.hh"
+
+namespace Spectrum {
+
+//! SSP Runge-Kutta weights of the state at the beginning of the step, [order-1][stage]
+constexpr double ssp_weight_old[mhd_max_ssp_order][mhd_max_ssp_order] = {{0.0, 0.0, 0.0}, {0.0, 0.5, 0.0}, {0.0, 0.75, 1.0 / 3.0}};
+
+//! SSP Runge-Kutta weights of the forward Euler update, [order-1][stage]
+constexpr double ssp_weight_new[mhd_max_ssp_order][mhd_max_ssp_order] = {{1.0, 0.0, 0.0}, {1.0, 0.5, 0.0}, {1.0, 0.25, 2.0 / 3.0}};
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// MHDBlock public methods
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] width  Length of the side, without ghost cells
+\param[in] wghost Width of the ghost cell layer outside the sector
+\param[in] height Hight of the block, without ghost cells
+\param[in] hghost Number of ghost shells outside the slab
+*/
+template <int verts_per_face, template <typename, typename, typename> class riemann_solver>
+MHDBlock<verts_per_face, riemann_solver>::MHDBlock(int width, int wghost, int height, int hghost)
+                                        : StenciledBlock<verts_per_face>(width, wghost, height, hghost)
+{
+   SetDimensions(width, wghost, height, hghost, true);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+template <int verts_per_face, template <typename, typename, typename> class riemann_solver>
+MHDBlock<verts_per_face, riemann_solver>::~MHDBlock()
+{
+   FreeStorage();
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] width     Length of the side, without ghost cells
+\param[in] wghost    Width of the ghost cell layer outside the sector
+\param[in] height    Hight of the block, without ghost cells
+\param[in] hghost    Number of ghost shells outside the slab
+\param[in] construct Set to true when called from a constructor
+*/
+template <int verts_per_face, template <typename, typename, typename> class riemann_solver>
+void MHDBlock<verts_per_face, riemann_solver>::SetDimensions(int width, int wghost, int height, int hghost, bool construct)
+{
+// Call base method.
+   if(!construct) StenciledBlock<verts_per_face>::SetDimensions(width, wghost, height, hghost, false);
+
+   int n_zone_elements = n_vars * n_shells_withghost * n_faces_withghost;
+
+// Solution arrays
+   cons = new double[n_zone_elements];
+   cons_old = new double[n_zone_elements];
+   prim = new double[n_zone_elements];
+   grad = new double[3 * n_zone_elements];
+   rhs = new double[n_zone_elements];
+   memset(cons, 0x0, n_zone_elements * SZDBL);
+   memset(grad, 0x0, 3 * n_zone_elements * SZDBL);
+
+// Flux arrays
+   flux_lat = new double[n_vars * n_shells_withghost * n_edges_withghost];
+   flux_rad = new double[n_vars * n_ifaces_withghost * n_faces_withghost];
+
+// Interface geometry
+   active_edges = new int[n_edges_withghost];
+   active_faces = new int[n_faces_withghost];
+   edge_frame = new GeoVector[3 * n_edges_withghost];
+   edge_mid = new GeoVector[n_edges_withghost];
+   face_frame = new GeoVector[3 * n_faces_withghost];
+   face_varea = new double[n_faces_withghost];
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+template <int verts_per_face, template <typename, typename, typename> class riemann_solver>
+void MHDBlock<verts_per_face, riemann_solver>::FreeStorage(void)
+{
+   delete[] cons;
+   delete[] cons_old;
+   delete[] prim;
+   delete[] grad;
+   delete[] rhs;
+   delete[] flux_lat;
+   delete[] flux_rad;
+
+   delete[] active_edges;
+   delete[] active_faces;
+   delete[] edge_frame;
+   delete[] edge_mid;
+   delete[] face_frame;
+   delete[] face_varea;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] index       Unique ID of this block in the mesh
+\param[in] ximin       Smallest reference distance of the block (without ghost)
+\param[in] ximax       Largest reference distance of the block (without ghost)
+\param[in] corners     Corner type, true for singular corners
+\param[in] borders     Radial boundary type, true for external
+\param[in] vcart       Vertex coordinate array in TAS/QAS
+\param[in] dist_map_in Radial map function
+*/
+template <int verts_per_face, template <typename, typename, typename> class riemann_solver>
+void MHDBlock<verts_per_face, riemann_solver>::AssociateMesh(int index, double ximin, double ximax, const bool* corners, const bool* borders,
+                                                             const GeoVector* vcart, std::shared_ptr<DistanceBase> dist_map_in)
+{
+   StenciledBlock<verts_per_face>::AssociateMesh(index, ximin, ximax, corners, borders, vcart, dist_map_in);
+   ComputeInterfaceGeometry();
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] order Order of the SSP Runge-Kutta method (1 to 3)
+*/
+template <int verts_per_face, template <typename, typename, typename> class riemann_solver>
+void MHDBlock<verts_per_face, riemann_solver>::SetTimeOrder(int order)
+{
+   ssp_order = std::clamp(order, 1, mhd_max_ssp_order);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] k     Shell
+\param[in] face  Face
+\param[in] state Conserved state with Cartesian vectors
+*/
+template <int verts_per_face, template <typename, typename, typename> class riemann_solver>
+void MHDBlock<verts_per_face, riemann_solver>::SetState(int k, int face, const cons_type& state)
+{
+   for(auto var = 0; var < n_vars; var++) cons[ZoneIndex(var, k, face)] = state[var];
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] k    Shell
+\param[in] face Face
+\return Conserved state with Cartesian vectors
+*/
+template <int verts_per_face, template <typename, typename, typename> class riemann_solver>
+typename MHDBlock<verts_per_face, riemann_solver>::cons_type MHDBlock<verts_per_face, riemann_solver>::GetState(int k, int face) const
+{
+   cons_type state;
+   for(auto var = 0; var < n_vars; var++) state[var] = cons[ZoneIndex(var, k, face)];
+   return state;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] cfl Courant number
+\return Largest time step allowed by the fastest wave in the interior zones
+*/
+template <int verts_per_face, template <typename, typename, typename> class riemann_solver>
+double MHDBlock<verts_per_face, riemann_solver>::MaxTimeStep(double cfl)
+{
+   double dt_min = std::numeric_limits<double>::max();
+
+#pragma omp parallel for schedule(static) reduction(min:dt_min)
+   for(auto kt = ghost_height; kt < n_shells_withghost - ghost_height; kt += mhd_shell_tile) {
+      int kmax = std::min(kt + mhd_shell_tile, n_shells_withghost - ghost_height);
+      for(auto k = kt; k < kmax; k++) {
+         for(auto i = 0; i < n_active_faces; i++) {
+            int face = active_faces[i];
+            cons_type state = GetState(k, face);
+            prim_type pstate = state.ToPrimitive(false);
+
+// The sum of the areas of all interfaces of the zone divided by its volume is the inverse of the effective zone size.
+            double perimeter = 0.0;
+            for(auto iv = 0; iv < verts_per_face; iv++) perimeter += edge_length[fe_local[face][iv]];
+            double area = face_varea[face] * (r2_in[k] + r2_in[k + 1]) + 0.5 * perimeter * (r2_in[k + 1] - r2_in[k]);
+            double volume = face_area[face] * (r3_in[k + 1] - r3_in[k]) / 3.0;
+            double speed = pstate.vel().Norm() + pstate.FastestWave();
+            dt_min = std::min(dt_min, volume / (area * speed));
+         };
+      };
+   };
+
+   return cfl * dt_min;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+template <int verts_per_face, template <typename, typename, typename> class riemann_solver>
+void MHDBlock<verts_per_face, riemann_solver>::BeginStep(void)
+{
+   memcpy(cons_old, cons, n_vars * n_shells_withghost * n_faces_withghost * SZDBL);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] stage Stage of the SSP Runge-Kutta method, starting with 0
+\param[in] dt    Time step
+*/
+template <int verts_per_face, template <typename, typename, typename> class riemann_solver>
+void MHDBlock<verts_per_face, riemann_solver>::Stage(int stage, double dt)
+{
+   double a = ssp_weight_old[ssp_order - 1][stage];
+   double b = ssp_weight_new[ssp_order - 1][stage];
+
+   ComputePrimitives();
+   ComputeGradients();
+   ComputeLateralFluxes();
+   ComputeRadialFluxes();
+   ComputeResidual();
+
+// U = a * U0 + b * (U + dt * L(U)) in the interior zones
+#pragma omp parallel for schedule(static)
+   for(auto kt = ghost_height; kt < n_shells_withghost - ghost_height; kt += mhd_shell_tile) {
+      int kmax = std::min(kt + mhd_shell_tile, n_shells_withghost - ghost_height);
+      for(auto var = 0; var < n_vars; var++) {
+         for(auto k = kt; k < kmax; k++) {
+            for(auto i = 0; i < n_active_faces; i++) {
+               int idx = ZoneIndex(var, k, active_faces[i]);
+               cons[idx] = a * cons_old[idx] + b * (cons[idx] + dt * rhs[idx]);
+            };
+         };
+      };
+   };
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] dt Time step
+\note The ghost zones are not updated between the stages, which is only appropriate for a block whose ghost zones hold a steady boundary state.
+*/
+template <int verts_per_face, template <typename, typename, typename> class riemann_solver>
+void MHDBlock<verts_per_face, riemann_solver>::Advance(double dt)
+{
+   BeginStep();
+   for(auto stage = 0; stage < ssp_order; stage++) Stage(stage, dt);
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// MHDBlock protected methods
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+template <int verts_per_face, template <typename, typename, typename> class riemann_solver>
+void MHDBlock<verts_per_face, riemann_solver>::ComputeInterfaceGeometry(void)
+{
+   int face, face0, face1;
+   double sign;
+   GeoVector v0, v1, normal, varea;
+
+   auto face_exists = [this](int face) {return (face >= 0) && (face < n_faces_withghost) && BITS_LOWERED(face_mask[face], GEOELM_NEXI);};
+
+// Lateral interfaces. The normal lies in the plane tangent to the US at the edge midpoint and points from the first to the second face in EF.
+   n_active_edges = 0;
+   for(auto edge = 0; edge < n_edges_withghost; edge++) {
+      if(BITS_RAISED(edge_mask[edge], GEOELM_NEXI)) continue;
+
+      v0 = block_vert_cart[ev_local[edge][0]];
+      v1 = block_vert_cart[ev_local[edge][1]];
+      face0 = ef_local[edge][0];
+      face1 = ef_local[edge][1];
+
+      normal = UnitVec(v0 ^ v1);
+      if(face_exists(face0)) {
+         if(normal * face_cmass[face0] > 0.0) normal = -normal;
+      }
+      else if(face_exists(face1)) {
+         if(normal * face_cmass[face1] < 0.0) normal = -normal;
+      };
+
+      edge_frame[3 * edge] = normal;
+      edge_frame[3 * edge + 1] = UnitVec(v1 - v0);
+      edge_frame[3 * edge + 2] = normal ^ edge_frame[3 * edge + 1];
+      edge_mid[edge] = UnitVec(v0 + v1);
+
+      if(face_exists(face0) && face_exists(face1) && (IsInteriorFace_Int(face0) || IsInteriorFace_Int(face1))) {
+         active_edges[n_active_edges++] = edge;
+      };
+   };
+
+// Radial interfaces. The vector area is computed from the lateral normals so that the interfaces of every zone form a closed surface and a uniform flow remains uniform to round-off.
+   n_active_faces = 0;
+   for(face = 0; face < n_faces_withghost; face++) {
+      if(!face_exists(face)) continue;
+
+      varea = gv_zeros;
+      for(auto iv = 0; iv < verts_per_face; iv++) {
+         auto edge = fe_local[face][iv];
+         if((edge < 0) || BITS_RAISED(edge_mask[edge], GEOELM_NEXI)) {
+            varea = gv_zeros;
+            break;
+         };
+         sign = (ef_local[edge][0] == face ? 1.0 : -1.0);
+         varea -= (0.5 * sign * edge_length[edge]) * edge_frame[3 * edge];
+      };
+
+// Faces on the outside of the ghost layer may have missing edges and do not need a closed surface
+      face_varea[face] = varea.Norm();
+      if(face_varea[face] > 0.0) face_frame[3 * face] = varea / face_varea[face];
+      else {
+         face_varea[face] = face_area[face];
+         face_frame[3 * face] = UnitVec(face_cmass[face]);
+      };
+      face_frame[3 * face + 1] = GetSecondUnitVec(face_frame[3 * face]);
+      face_frame[3 * face + 2] = face_frame[3 * face] ^ face_frame[3 * face + 1];
+
+      if(IsInteriorFace_Int(face)) active_faces[n_active_faces++] = face;
+   };
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+template <int verts_per_face, template <typename, typename, typename> class riemann_solver>
+void MHDBlock<verts_per_face, riemann_solver>::ComputePrimitives(void)
+{
+#pragma omp parallel for schedule(static)
+   for(auto kt = 0; kt < n_shells_withghost; kt += mhd_shell_tile) {
+      int kmax = std::min(kt + mhd_shell_tile, n_shells_withghost);
+      for(auto k = kt; k < kmax; k++) {
+         for(auto face = 0; face < n_faces_withghost; face++) {
+            if(BITS_RAISED(face_mask[face], GEOELM_NEXI)) continue;
+            cons_type state = GetState(k, face);
+
+// Zones that were never filled are skipped, so that the ghost layer may be left partially empty
+            if(state.den() <= 0.0) {
+               for(auto var = 0; var < n_vars; var++) prim[ZoneIndex(var, k, face)] = 0.0;
+               continue;
+            };
+            prim_type pstate = state.ToPrimitive(false);
+            for(auto var = 0; var < n_vars; var++) prim[ZoneIndex(var, k, face)] = pstate[var];
+         };
+      };
+   };
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+template <int verts_per_face, template <typename, typename, typename> class riemann_solver>
+void MHDBlock<verts_per_face, riemann_solver>::ComputeGradients(void)
+{
+// Gradients are only needed in stenciled zones whose radial neighbors exist. Elsewhere they remain zero and the reconstruction is first order.
+#pragma omp parallel for schedule(static)
+   for(auto kt = 1; kt < n_shells_withghost - 1; kt += mhd_shell_tile) {
+      int kmax = std::min(kt + mhd_shell_tile, n_shells_withghost - 1);
+      double diffs[StenciledBlock<verts_per_face>::max_zones_per_stencil], g[3];
+      int zones = zones_per_stencil[0];
+
+      for(auto k = kt; k < kmax; k++) {
+         for(auto pface = 0; pface < n_faces_withghost; pface++) {
+            if(BITS_LOWERED(face_mask[pface], GEOELM_STEN)) continue;
+            const int* zonelist = stencil_zonelist[pface][0];
+
+            for(auto var = 0; var < n_vars; var++) {
+               double uc = prim[ZoneIndex(var, k, pface)];
+               double umin = uc;
+               double umax = uc;
+
+               for(auto zone = 0; zone < zones; zone++) {
+                  double u = prim[ZoneIndex(var, k + zonelist[2 * zone + 1], zonelist[2 * zone])];
+                  diffs[zone] = u - uc;
+                  umin = std::min(umin, u);
+                  umax = std::max(umax, u);
+               };
+               StencilGradient(pface, 0, diffs, g);
+
+// Barth-Jespersen limiter: the values reconstructed halfway to each neighbor must stay within the range of the stencil
+               double phi = 1.0;
+               for(auto zone = 0; zone < zones; zone++) {
+                  int face = zonelist[2 * zone];
+                  GeoVector dx = RadialFactor(zonelist[2 * zone + 1]) * face_cmass[face] - face_cmass[pface];
+                  double du = 0.5 * (g[0] * dx[0] + g[1] * dx[1] + g[2] * dx[2]);
+                  if(du > sp_tiny) phi = std::min(phi, (umax - uc) / du);
+                  else if(du < -sp_tiny) phi = std::min(phi, (umin - uc) / du);
+               };
+
+               for(auto comp = 0; comp < 3; comp++) grad[GradIndex(var, comp, k, pface)] = phi * g[comp];
+            };
+         };
+      };
+   };
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] k    Shell
+\param[in] face Face
+\param[in] dx   Displacement from the zone center in units of the shell radius
+\return Reconstructed primitive state
+*/
+template <int verts_per_face, template <typename, typename, typename> class riemann_solver>
+typename MHDBlock<verts_per_face, riemann_solver>::prim_type MHDBlock<verts_per_face, riemann_solver>::Reconstruct(int k, int face,
+                                                                                                                  const GeoVector& dx) const
+{
+   prim_type pstate;
+
+   for(auto var = 0; var < n_vars; var++) {
+      pstate[var] = prim[ZoneIndex(var, k, face)] + grad[GradIndex(var, 0, k, face)] * dx[0] + grad[GradIndex(var, 1, k, face)] * dx[1]
+                                                  + grad[GradIndex(var, 2, k, face)] * dx[2];
+   };
+
+// Fall back to first order if the linear profile produces an unphysical state
+   if((pstate.den() <= 0.0) || (pstate.pre() <= 0.0)) {
+      for(auto var = 0; var < n_vars; var++) pstate[var] = prim[ZoneIndex(var, k, face)];
+   };
+   return pstate;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in]  left   Reconstructed state on the side opposite to the normal
+\param[in]  rght   Reconstructed state on the side of the normal
+\param[in]  frame  Normal and two tangent vectors of the interface
+\param[in]  area   Area of the interface
+\param[out] flux   First flux component of the interface
+\param[in]  stride Distance between consecutive flux components
+\param[in]  solver Riemann solver object (one per thread)
+*/
+template <int verts_per_face, template <typename, typename, typename> class riemann_solver>
+void MHDBlock<verts_per_face, riemann_solver>::InterfaceFlux(const prim_type& left, const prim_type& rght, const GeoVector* frame, double area,
+                                                             double* flux, int stride, riemann_solver<prim_type, cons_type, flux_type>& solver) const
+{
+   prim_type left_loc = left, rght_loc = rght;
+
+// Rotate the vectors into the interface frame
+   for(auto comp = 0; comp < 3; comp++) {
+      left_loc.vel()[comp] = left.vel() * frame[comp];
+      left_loc.mag()[comp] = left.mag() * frame[comp];
+      rght_loc.vel()[comp] = rght.vel() * frame[comp];
+      rght_loc.mag()[comp] = rght.mag() * frame[comp];
+   };
+
+   solver.Solve(left_loc, rght_loc);
+   flux_type flux_loc = solver.GetResolvedFlux();
+
+// Rotate the vector fluxes back to the Cartesian frame
+   GeoVector momf = flux_loc.momf()[0] * frame[0] + flux_loc.momf()[1] * frame[1] + flux_loc.momf()[2] * frame[2];
+   GeoVector magf = flux_loc.magf()[0] * frame[0] + flux_loc.magf()[1] * frame[1] + flux_loc.magf()[2] * frame[2];
+   flux_loc.momf() = momf;
+   flux_loc.magf() = magf;
+
+   for(auto var = 0; var < n_vars; var++) flux[var * stride] = area * flux_loc[var];
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+template <int verts_per_face, template <typename, typename, typename> class riemann_solver>
+void MHDBlock<verts_per_face, riemann_solver>::ComputeLateralFluxes(void)
+{
+   int stride = n_shells_withghost * n_edges_withghost;
+
+#pragma omp parallel for schedule(static)
+   for(auto kt = ghost_height; kt < n_shells_withghost - ghost_height; kt += mhd_shell_tile) {
+      int kmax = std::min(kt + mhd_shell_tile, n_shells_withghost - ghost_height);
+      riemann_solver<prim_type, cons_type, flux_type> solver;
+
+      for(auto k = kt; k < kmax; k++) {
+         double dr2 = 0.5 * (r2_in[k + 1] - r2_in[k]);
+         for(auto i = 0; i < n_active_edges; i++) {
+            int edge = active_edges[i];
+            int face0 = ef_local[edge][0];
+            int face1 = ef_local[edge][1];
+
+// The reconstruction point is the edge midpoint at the distance of the zone center
+            prim_type left = Reconstruct(k, face0, edge_mid[edge] * face_cmass[face0].Norm() - face_cmass[face0]);
+            prim_type rght = Reconstruct(k, face1, edge_mid[edge] * face_cmass[face1].Norm() - face_cmass[face1]);
+            InterfaceFlux(left, rght, edge_frame + 3 * edge, edge_length[edge] * dr2, flux_lat + LatIndex(0, k, edge), stride, solver);
+         };
+      };
+   };
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+template <int verts_per_face, template <typename, typename, typename> class riemann_solver>
+void MHDBlock<verts_per_face, riemann_solver>::ComputeRadialFluxes(void)
+{
+   int stride = n_ifaces_withghost * n_faces_withghost;
+
+// The interface lies halfway between the zone centers in exponential coordinates
+   double fac_up = sqrt(RadialFactor(1)) - 1.0;
+   double fac_dn = sqrt(RadialFactor(-1)) - 1.0;
+
+#pragma omp parallel for schedule(static)
+   for(auto kt = ghost_height; kt <= n_shells_withghost - ghost_height; kt += mhd_shell_tile) {
+      int kmax = std::min(kt + mhd_shell_tile, n_shells_withghost - ghost_height + 1);
+      riemann_solver<prim_type, cons_type, flux_type> solver;
+
+      for(auto k = kt; k < kmax; k++) {
+         for(auto i = 0; i < n_active_faces; i++) {
+            int face = active_faces[i];
+            prim_type left = Reconstruct(k - 1, face, fac_up * face_cmass[face]);
+            prim_type rght = Reconstruct(k, face, fac_dn * face_cmass[face]);
+            InterfaceFlux(left, rght, face_frame + 3 * face, face_varea[face] * r2_in[k], flux_rad + RadIndex(0, k, face), stride, solver);
+         };
+      };
+   };
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+template <int verts_per_face, template <typename, typename, typename> class riemann_solver>
+void MHDBlock<verts_per_face, riemann_solver>::ComputeResidual(void)
+{
+// Each zone gathers the fluxes of its own interfaces, so the threads never write to the same location.
+#pragma omp parallel for schedule(static)
+   for(auto kt = ghost_height; kt < n_shells_withghost - ghost_height; kt += mhd_shell_tile) {
+      int kmax = std::min(kt + mhd_shell_tile, n_shells_withghost - ghost_height);
+      for(auto k = kt; k < kmax; k++) {
+         double dr3 = (r3_in[k + 1] - r3_in[k]) / 3.0;
+         for(auto i = 0; i < n_active_faces; i++) {
+            int face = active_faces[i];
+            double inv_volume = 1.0 / (face_area[face] * dr3);
+
+            for(auto var = 0; var < n_vars; var++) {
+               double net = flux_rad[RadIndex(var, k, face)] - flux_rad[RadIndex(var, k + 1, face)];
+               for(auto iv = 0; iv < verts_per_face; iv++) {
+                  int edge = fe_local[face][iv];
+                  if(ef_local[edge][0] == face) net -= flux_lat[LatIndex(var, k, edge)];
+                  else net += flux_lat[LatIndex(var, k, edge)];
+               };
+               rhs[ZoneIndex(var, k, face)] = net * inv_volume;
+            };
+         };
+      };
+   };
+};
+
+template class MHDBlock<3, RiemannSolverRusanov>;
+template class MHDBlock<3, RiemannSolverHLLE>;
+template class MHDBlock<3, RiemannSolverHLLC>;
+template class MHDBlock<4, RiemannSolverRusanov>;
+template class MHDBlock<4, RiemannSolverHLLE>;
+template class MHDBlock<4, RiemannSolverHLLC>;
+
+};
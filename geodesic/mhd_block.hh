@@ -0,0 +1,263 @@
+/*!
+\file mhd_block.hh
+\brief Declares a grid block that advances the ideal MHD equations with a finite volume method
+\author Swati Sharma
+
+This file is part of the SPECTRUM suite of scientific numerical simulation codes. SPECTRUM stands for Space Plasma and Energetic Charged particle TRansport on Unstructured Meshes. The code simulates plasma or neutral particle flows using MHD equations on a grid, transport of cosmic rays using stochastic or grid based methods. The "unstructured" part refers to the use of a geodesic mesh providing a uniform coverage of the surface of a sphere.
+*/
+
+#ifndef SPECTRUM_MHD_BLOCK
+#define SPECTRUM_MHD_BLOCK
+
+#include "geodesic/stenciled_block.hh"
+#include "fluid/riemann_solver.hh"
+
+namespace Spectrum {
+
+//! Number of shells processed together by one thread in a sweep
+constexpr int mhd_shell_tile = 4;
+
+//! Largest supported order of the SSP Runge-Kutta method
+constexpr int mhd_max_ssp_order = 3;
+
+/*!
+\brief A grid block that advances the ideal MHD equations in time
+\author Swati Sharma
+
+The conserved variables are stored as a structure of arrays, one contiguous array per variable, with faces varying fastest. Velocity and magnetic field are kept in Cartesian components, so no geometric source terms are needed. Face states are reconstructed with limited linear gradients obtained from the central stencil of "StenciledBlock", the Riemann problem is solved in the frame of each interface, and the solution is advanced with a strong stability preserving Runge-Kutta method. Only interior zones are updated; the ghost zones must be filled by the caller before each stage. Sweeps over zones and interfaces are split into tiles of "mhd_shell_tile" shells that are distributed between OpenMP threads.
+*/
+template <int verts_per_face, template <typename, typename, typename> class riemann_solver>
+class MHDBlock : public StenciledBlock<verts_per_face>
+{
+public:
+
+//! Number of indicator variables
+   static constexpr int n_ind = 0;
+
+//! Number of variables per zone
+   static constexpr int n_vars = CL_MHD_TOTAL;
+
+//! Primitive state type
+   using prim_type = PrimitiveStateMHD<0, n_ind>;
+
+//! Conserved state type
+   using cons_type = ConservedStateMHD<0, n_ind>;
+
+//! Flux function type
+   using flux_type = FluxFunctionMHD<0, n_ind>;
+
+protected:
+
+   using SphericalSlab::ghost_height;
+   using SphericalSlab::n_shells_withghost;
+   using SphericalSlab::n_ifaces_withghost;
+   using GeodesicSector<verts_per_face>::n_edges_withghost;
+   using GeodesicSector<verts_per_face>::n_faces_withghost;
+   using GeodesicSector<verts_per_face>::ev_local;
+   using GeodesicSector<verts_per_face>::ef_local;
+   using GeodesicSector<verts_per_face>::fe_local;
+   using GeodesicSector<verts_per_face>::edge_mask;
+   using GeodesicSector<verts_per_face>::face_mask;
+   using GridBlock<verts_per_face>::r2_in;
+   using GridBlock<verts_per_face>::r3_in;
+   using GridBlock<verts_per_face>::block_vert_cart;
+   using GridBlock<verts_per_face>::IsInteriorFace_Int;
+   using StenciledBlock<verts_per_face>::zones_per_stencil;
+   using StenciledBlock<verts_per_face>::face_area;
+   using StenciledBlock<verts_per_face>::face_cmass;
+   using StenciledBlock<verts_per_face>::edge_length;
+   using StenciledBlock<verts_per_face>::stencil_zonelist;
+   using StenciledBlock<verts_per_face>::RadialFactor;
+   using StenciledBlock<verts_per_face>::StencilGradient;
+
+//! Order of the time integration method
+   int ssp_order = 2;
+
+//! Number of edges that carry a lateral flux
+   int n_active_edges = 0;
+
+//! Number of interior faces
+   int n_active_faces = 0;
+
+//! Edges that carry a lateral flux
+   int* active_edges = nullptr;
+
+//! Interior faces
+   int* active_faces = nullptr;
+
+//! Conserved variables, [var][shell][face]
+   double* cons = nullptr;
+
+//! Conserved variables at the beginning of the step
+   double* cons_old = nullptr;
+
+//! Primitive variables, [var][shell][face]
+   double* prim = nullptr;
+
+//! Limited gradients of the primitive variables, [var][component][shell][face]
+   double* grad = nullptr;
+
+//! Time derivative of the conserved variables, [var][shell][face]
+   double* rhs = nullptr;
+
+//! Lateral fluxes multiplied by the interface area, [var][shell][edge]
+   double* flux_lat = nullptr;
+
+//! Radial fluxes multiplied by the interface area, [var][interface][face]
+   double* flux_rad = nullptr;
+
+//! Unit normal (from the first to the second face in EF) and two tangents for each edge
+   GeoVector* edge_frame = nullptr;
+
+//! Midpoint of each edge on the US
+   GeoVector* edge_mid = nullptr;
+
+//! Unit normal and two tangents for each radial interface
+   GeoVector* face_frame = nullptr;
+
+//! Magnitude of the vector area of each face on the US
+   double* face_varea = nullptr;
+
+//! Position of a zone variable in the SoA arrays
+   SPECTRUM_DEVICE_FUNC int ZoneIndex(int var, int k, int face) const;
+
+//! Position of a gradient component in "grad"
+   SPECTRUM_DEVICE_FUNC int GradIndex(int var, int comp, int k, int face) const;
+
+//! Position of a lateral flux in "flux_lat"
+   SPECTRUM_DEVICE_FUNC int LatIndex(int var, int k, int edge) const;
+
+//! Position of a radial flux in "flux_rad"
+   SPECTRUM_DEVICE_FUNC int RadIndex(int var, int k, int face) const;
+
+//! Compute the interface normals and the lists of active elements
+   void ComputeInterfaceGeometry(void);
+
+//! Convert conserved to primitive variables in all zones
+   void ComputePrimitives(void);
+
+//! Compute limited gradients of the primitive variables
+   void ComputeGradients(void);
+
+//! Reconstruct the primitive state at a point displaced from the zone center
+   prim_type Reconstruct(int k, int face, const GeoVector& dx) const;
+
+//! Solve the Riemann problem at an interface and store the flux multiplied by the area
+   void InterfaceFlux(const prim_type& left, const prim_type& rght, const GeoVector* frame, double area, double* flux, int stride,
+                      riemann_solver<prim_type, cons_type, flux_type>& solver) const;
+
+//! Compute the fluxes through all lateral interfaces
+   void ComputeLateralFluxes(void);
+
+//! Compute the fluxes through all radial interfaces
+   void ComputeRadialFluxes(void);
+
+//! Compute the time derivative in all interior zones
+   void ComputeResidual(void);
+
+public:
+
+//! Default constructor
+   MHDBlock(void) = default;
+
+//! Constructor with arguments
+   MHDBlock(int width, int wghost, int height, int hghost);
+
+//! Destructor
+   ~MHDBlock();
+
+//! Allocate memory
+   void SetDimensions(int width, int wghost, int height, int hghost, bool construct);
+
+//! Free all dynamically allocated memory
+   void FreeStorage(void);
+
+//! Set up the dimensions and geometry of the mesh
+   void AssociateMesh(int index, double ximin, double ximax, const bool* corners, const bool* borders, const GeoVector* vcart,
+                      std::shared_ptr<DistanceBase> dist_map_in);
+
+//! Select the order of the time integration method
+   void SetTimeOrder(int order);
+
+//! Return the number of stages in a step
+   int Stages(void) const {return ssp_order;};
+
+//! Set the state of one zone
+   void SetState(int k, int face, const cons_type& state);
+
+//! Return the state of one zone
+   cons_type GetState(int k, int face) const;
+
+//! Compute the largest stable time step
+   double MaxTimeStep(double cfl);
+
+//! Save the state at the beginning of a step
+   void BeginStep(void);
+
+//! Perform one stage of the time step
+   void Stage(int stage, double dt);
+
+//! Perform a complete time step with fixed ghost zones
+   void Advance(double dt);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] var  Variable
+\param[in] k    Shell
+\param[in] face Face
+\return Index into a zone array
+*/
+template <int verts_per_face, template <typename, typename, typename> class riemann_solver>
+SPECTRUM_DEVICE_FUNC inline int MHDBlock<verts_per_face, riemann_solver>::ZoneIndex(int var, int k, int face) const
+{
+   return (var * n_shells_withghost + k) * n_faces_withghost + face;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] var  Variable
+\param[in] comp Cartesian component of the gradient
+\param[in] k    Shell
+\param[in] face Face
+\return Index into "grad"
+*/
+template <int verts_per_face, template <typename, typename, typename> class riemann_solver>
+SPECTRUM_DEVICE_FUNC inline int MHDBlock<verts_per_face, riemann_solver>::GradIndex(int var, int comp, int k, int face) const
+{
+   return ((var * 3 + comp) * n_shells_withghost + k) * n_faces_withghost + face;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] var  Variable
+\param[in] k    Shell
+\param[in] edge Edge
+\return Index into "flux_lat"
+*/
+template <int verts_per_face, template <typename, typename, typename> class riemann_solver>
+SPECTRUM_DEVICE_FUNC inline int MHDBlock<verts_per_face, riemann_solver>::LatIndex(int var, int k, int edge) const
+{
+   return (var * n_shells_withghost + k) * n_edges_withghost + edge;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] var  Variable
+\param[in] k    Radial interface (between shells "k-1" and "k")
+\param[in] face Face
+\return Index into "flux_rad"
+*/
+template <int verts_per_face, template <typename, typename, typename> class riemann_solver>
+SPECTRUM_DEVICE_FUNC inline int MHDBlock<verts_per_face, riemann_solver>::RadIndex(int var, int k, int face) const
+{
+   return (var * n_ifaces_withghost + k) * n_faces_withghost + face;
+};
+
+};
+
+#endif
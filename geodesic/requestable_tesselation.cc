@@ -231,6 +231,161 @@ int RequestableTesselation<poly_type, max_division>::Locate(int div, const GeoVe
    return face;
 };
 
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] v Vector from the origin to the point (need not be normalized)
+\return Index of the cube map cell the direction of "v" falls into
+*/
+template <PolyType poly_type, int max_division>
+int RequestableTesselation<poly_type, max_division>::CubeCell(const GeoVector& v) const
+{
+   int axis, cube_face, iu, iw;
+   double major, u, w;
+
+// Pick the dominant axis - this selects one of the six cube faces. The remaining two components, divided by the dominant one, are the gnomonic coordinates on that face.
+   if((fabs(v[0]) >= fabs(v[1])) && (fabs(v[0]) >= fabs(v[2]))) axis = 0;
+   else if(fabs(v[1]) >= fabs(v[2])) axis = 1;
+   else axis = 2;
+
+   major = fabs(v[axis]);
+   if(major == 0.0) return 0;
+   cube_face = 2 * axis + (v[axis] < 0.0 ? 1 : 0);
+   u = v[(axis + 1) % 3] / major;
+   w = v[(axis + 2) % 3] / major;
+
+// Map [-1,1] to cell indices, guarding against the edge of the cube face
+   iu = (int)(0.5 * (u + 1.0) * locate_res);
+   iw = (int)(0.5 * (w + 1.0) * locate_res);
+   if(iu == locate_res) iu--;
+   if(iw == locate_res) iw--;
+   return (cube_face * locate_res + iw) * locate_res + iu;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] cell Cube map cell
+\return Unit vector through the center of the cell
+*/
+template <PolyType poly_type, int max_division>
+GeoVector RequestableTesselation<poly_type, max_division>::CubeCellCenter(int cell) const
+{
+   int axis, cube_face, iu, iw;
+   GeoVector v;
+
+   iu = cell % locate_res;
+   iw = (cell / locate_res) % locate_res;
+   cube_face = cell / (locate_res * locate_res);
+   axis = cube_face / 2;
+
+// Inverse of the mapping in "CubeCell()"
+   v[axis] = (cube_face % 2 ? -1.0 : 1.0);
+   v[(axis + 1) % 3] = 2.0 * (iu + 0.5) / locate_res - 1.0;
+   v[(axis + 2) % 3] = 2.0 * (iw + 0.5) / locate_res - 1.0;
+   return v.Normalize();
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] div Division
+\param[in] res Number of cells along each side of a cube face (0 to select automatically)
+\note The default resolution makes the cells at the centers of the cube faces about as wide as a t-face at "div", so that a lookup is followed by a walk of only one or two steps.
+*/
+template <PolyType poly_type, int max_division>
+void RequestableTesselation<poly_type, max_division>::BuildLocator(int div, int res)
+{
+   static const std::string callerID = "BuildLocator";
+   if((div < 0) || (div > max_division) || (res < 0)) throw TessError(callerID, div, TESERR_INPUT, __LINE__);
+   int cell, ncells, face;
+
+   locate_res = (res ? res : (int)ceil(sqrt(nfaces[div] / M_PI)));
+
+// Walking is cheaper than a lookup for points within about two face widths of the previous one
+   locate_cos = cos(2.0 * sqrt(4.0 * M_PI / nfaces[div]));
+   ncells = 6 * locate_res * locate_res;
+   locate_table.resize(ncells);
+
+// Neighboring cells are close together on the sphere, so each cell is located by walking from the face of the previous one.
+   face = -1;
+   for(cell = 0; cell < ncells; cell++) {
+      face = LocateFrom(div, face, CubeCellCenter(cell));
+      locate_table[cell] = face;
+   };
+   locate_div = div;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] div  Division
+\param[in] face Starting face (if invalid, tree descent is used instead)
+\param[in] v    Vector from the origin to the point
+\return Index of the t-face where this point lies
+\note The walk crosses the first edge whose plane has the point on its outer side. If it takes too many steps, the search falls back to "Locate()".
+*/
+template <PolyType poly_type, int max_division>
+int RequestableTesselation<poly_type, max_division>::LocateFrom(int div, int face, const GeoVector& v) const
+{
+   if((face < 0) || (face >= nfaces[div])) return Locate(div, v);
+
+   int iv, step, max_steps = 8 << div;
+   const int* fv;
+   GeoVector edge_norm;
+
+   for(step = 0; step < max_steps; step++) {
+      fv = fv_con[div][face];
+
+// This relies on the edge "iv" of a face connecting vertices "iv" and "iv+1" and being shared with the face "ff_con[div][face][iv]".
+      for(iv = 0; iv < verts_per_face[div]; iv++) {
+         edge_norm = vert_cart[fv[iv]] ^ vert_cart[fv[(iv + 1) % verts_per_face[div]]];
+         if(v * edge_norm < 0.0) break;
+      };
+      if(iv == verts_per_face[div]) return face;
+      face = ff_con[div][face][iv];
+   };
+
+   return Locate(div, v);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] div Division
+\param[in] v   Vector from the origin to the point
+\return Index of the t-face where this point lies
+*/
+template <PolyType poly_type, int max_division>
+int RequestableTesselation<poly_type, max_division>::LocateFast(int div, const GeoVector& v) const
+{
+   if(div != locate_div) return Locate(div, v);
+   return LocateFrom(div, locate_table[CubeCell(v)], v);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in]  div   Division
+\param[in]  n     Number of vectors
+\param[in]  v     Vectors from the origin to the points
+\param[out] faces Indices of the t-faces where the points lie
+\note Points that are close to the previous one (as on a trajectory) are found by walking from the previous face. Otherwise the lookup table is used if it was built for "div", or the walk from the previous face if not.
+*/
+template <PolyType poly_type, int max_division>
+void RequestableTesselation<poly_type, max_division>::Locate(int div, int n, const GeoVector* v, int* faces) const
+{
+   int face = -1;
+   bool near;
+
+   for(auto i = 0; i < n; i++) {
+      near = (i > 0) && (v[i] * v[i - 1] > locate_cos * sqrt(v[i].Norm2() * v[i - 1].Norm2()));
+      if((div == locate_div) && !near) face = LocateFast(div, v[i]);
+      else face = LocateFrom(div, face, v[i]);
+      faces[i] = face;
+   };
+};
+
 /*!
 \author Vladimir Florinski
 \date 08/30/2019
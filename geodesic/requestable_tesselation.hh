@@ -9,6 +9,7 @@ This file is part of the SPECTRUM suite of scientific numerical simulation codes
 #ifndef SPECTRUM_REQUESTABLE_TESSELATION_HH
 #define SPECTRUM_REQUESTABLE_TESSELATION_HH
 
+#include <vector>
 #include "geodesic/spherical_tesselation.hh"
 
 namespace Spectrum {
@@ -38,6 +39,25 @@ protected:
    using SphericalTesselation<poly_type, max_division>::ef_con;
    using SphericalTesselation<poly_type, max_division>::fv_con;
    using SphericalTesselation<poly_type, max_division>::fe_con;
+   using SphericalTesselation<poly_type, max_division>::ff_con;
+
+//! Division for which the direction lookup table was built (-1 if none)
+   int locate_div = -1;
+
+//! Number of cells along each side of a cube face in the direction lookup table
+   int locate_res = 0;
+
+//! Cosine of the angle between consecutive points below which the batch search walks from the previous face instead of using the lookup table
+   double locate_cos = 1.0;
+
+//! Candidate face for each cell of the cube map, stored as [cube face][row][column]
+   std::vector<int> locate_table;
+
+//! Return the cube map cell a direction falls into
+   int CubeCell(const GeoVector& v) const;
+
+//! Return the direction through the center of a cube map cell
+   GeoVector CubeCellCenter(int cell) const;
 
 //! Return the smallest possible division for a given face index.
    SPECTRUM_DEVICE_FUNC int GetMinDivision(int face) const;
@@ -62,6 +82,9 @@ public:
 //! Default constructor
    RequestableTesselation(void) = default;
 
+//! Constructor from a cache file
+   explicit RequestableTesselation(const std::string& cache_file);
+
 //! Return the edges and vertices of a face and their EF and VF tables
    void ExchangeSites(int div, int face, int* edges, int* const* ef, int* vertices, int* const* vf) const;
 
@@ -71,6 +94,18 @@ public:
 //! Find the face where a given vector lies.
    int Locate(int div, const GeoVector& v) const;
 
+//! Build the direction lookup table used by "LocateFast()"
+   void BuildLocator(int div, int res = 0);
+
+//! Find the face where a given vector lies by walking from a nearby face
+   int LocateFrom(int div, int face, const GeoVector& v) const;
+
+//! Find the face where a given vector lies using the direction lookup table
+   int LocateFast(int div, const GeoVector& v) const;
+
+//! Find the faces where a sequence of vectors lie
+   void Locate(int div, int n, const GeoVector* v, int* faces) const;
+
 //! Generate a list of t-faces that lie inside a sector in tree format.
    void GetAllInsideFaceTree(int divs, int sect, int divf, int* list) const;
 
@@ -78,6 +113,17 @@ public:
    void FillVertCoordArrays(int length, const int* list, GeoVector* vcart) const;
 };
 
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] cache_file Name of the tesselation cache file
+*/
+template <PolyType poly_type, int max_division>
+inline RequestableTesselation<poly_type, max_division>::RequestableTesselation(const std::string& cache_file)
+                                                      : SphericalTesselation<poly_type, max_division>(cache_file)
+{
+};
+
 };
 
 #endif
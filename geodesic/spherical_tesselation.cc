@@ -6,10 +6,48 @@
 This file is part of the SPECTRUM suite of scientific numerical simulation codes. SPECTRUM stands for Space Plasma and Energetic Charged particle TRansport on Unstructured Meshes. The code simulates plasma or neutral particle flows using MHD equations on a grid, transport of cosmic rays using stochastic or grid based methods. The "unstructured" part refers to the use of a geodesic mesh providing a uniform coverage of the surface of a sphere.
 */
 
+#include <fstream>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "geodesic/spherical_tesselation.hh"
 
 namespace Spectrum {
 
+//! Number of payload sections in a cache file that do not depend on the division (counts, latitudes, longitudes, Cartesian coordinates)
+#define TESS_CACHE_FIXED_SECTIONS 4
+
+//! Number of connectivity tables per division
+#define TESS_CACHE_TABLES 8
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] data Memory block
+\param[in] size Size of the block in bytes
+\return Checksum
+*/
+uint64_t TessChecksum(const char* data, size_t size)
+{
+   uint64_t hash = 0xCBF29CE484222325, word;
+   size_t i;
+
+// The hash is computed over 8 byte words, which is several times faster than the byte-wise FNV-1a.
+   for(i = 0; i + sizeof(word) <= size; i += sizeof(word)) {
+      memcpy(&word, data + i, sizeof(word));
+      hash ^= word;
+      hash *= 0x100000001B3;
+      hash ^= hash >> 29;
+   };
+   for(; i < size; i++) {
+      hash ^= static_cast<uint8_t>(data[i]);
+      hash *= 0x100000001B3;
+   };
+   return hash;
+};
+
 /*!
 \author Vladimir Florinski
 \date 04/15/2020
@@ -18,17 +56,19 @@ namespace Spectrum {
 \param[in]  n_sing1     Number of singular nodes of type 1
 \param[in]  n_nbrs1s    Number of type 2 neighbors per type 1 singular node
 \param[in]  start_sing1 Starting index of singular nodes of type 1
+\param[in]  stride1     Row length of the forward connectivity list
 \param[in]  conn_12     Forward connectivity list
 \param[in]  n_nodes2    Total nodes of type 2
 \param[in]  n_nbrs2     Number of type 1 neighbors per type 2 node
 \param[in]  n_sing2     Number of singular nodes of type 2
 \param[in]  n_nbrs2s    Number of type 1 neighbors per type 2 singular node
 \param[in]  start_sing2 Starting index of singular nodes of type 2
+\param[in]  stride2     Row length of the reverse connectivity list
 \param[out] conn_21     Reverse connectivity list
 \return Error code described in "tesselate.hh"
 */
-TERR_TYPE BuildReverse(int n_nodes1, int n_nbrs1, int n_sing1, int n_nbrs1s, int start_sing1, const int* const* conn_12,
-                       int n_nodes2, int n_nbrs2, int n_sing2, int n_nbrs2s, int start_sing2,       int* const* conn_21)
+TERR_TYPE BuildReverse(int n_nodes1, int n_nbrs1, int n_sing1, int n_nbrs1s, int start_sing1, int stride1, const int* conn_12,
+                       int n_nodes2, int n_nbrs2, int n_sing2, int n_nbrs2s, int start_sing2, int stride2,       int* conn_21)
 {
    int n_nbrs1_actual, n_nbrs2_actual, node1, node2, nbr;
    TERR_TYPE err = TESERR_NOERR;
@@ -42,7 +82,7 @@ TERR_TYPE BuildReverse(int n_nodes1, int n_nbrs1, int n_sing1, int n_nbrs1s, int
       n_nbrs1_actual = ((node1 >= start_sing1) && (node1 < start_sing1 + n_sing1) ? n_nbrs1s : n_nbrs1);
    
       for(nbr = 0; nbr < n_nbrs1_actual; nbr++) {
-         node2 = conn_12[node1][nbr];
+         node2 = conn_12[node1 * stride1 + nbr];
 
 // Bad entry in the "conn_12" array encountered - skip to the next entry to avoid a memory error.
          if(node2 < 0 || node2 >= n_nodes2) {
@@ -53,7 +93,7 @@ TERR_TYPE BuildReverse(int n_nodes1, int n_nbrs1, int n_sing1, int n_nbrs1s, int
 // Enter node1 and increment the entry point by one. An error flag is raised if some node2 has all its connections filled already.
          n_nbrs2_actual = ((node2 >= start_sing2) && (node2 < start_sing2 + n_sing2) ? n_nbrs2s : n_nbrs2);
          if(entry_point[node2] == n_nbrs2_actual) err |= TESERR_OVERF;
-         else conn_21[node2][entry_point[node2]++] = node1;
+         else conn_21[node2 * stride2 + entry_point[node2]++] = node1;
       };
    };
 
@@ -68,7 +108,7 @@ TERR_TYPE BuildReverse(int n_nodes1, int n_nbrs1, int n_sing1, int n_nbrs1s, int
 
 // Complete the lists for singular "node2".
    for(node2 = start_sing2; node2 < start_sing2 + n_sing2; node2++) {
-      for(nbr = n_nbrs2s; nbr < n_nbrs2; nbr++) conn_21[node2][nbr] = -1;
+      for(nbr = n_nbrs2s; nbr < n_nbrs2; nbr++) conn_21[node2 * stride2 + nbr] = -1;
    };
 
    delete[] entry_point;
@@ -91,6 +131,23 @@ SphericalTesselation<poly_type, max_division>::SphericalTesselation(void)
    ComputeAll();
 };
 
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] cache_file Name of the cache file produced by "WriteCache()"
+
+If the file is missing or does not match this tesselation, it is silently ignored and the mesh is computed from scratch.
+*/
+template <PolyType poly_type, int max_division>
+SphericalTesselation<poly_type, max_division>::SphericalTesselation(const std::string& cache_file)
+                                             : Polyhedron<poly_type>()
+{
+   if(!ReadCache(cache_file)) {
+      AllocateStorage();
+      ComputeAll();
+   };
+};
+
 /*!
 \author Vladimir Florinski
 \date 05/01/2024
@@ -106,7 +163,7 @@ SphericalTesselation<poly_type, max_division>::~SphericalTesselation()
 \date 05/01/2024
 */
 template <PolyType poly_type, int max_division>
-void SphericalTesselation<poly_type, max_division>::AllocateStorage(void)
+void SphericalTesselation<poly_type, max_division>::ComputeCounts(void)
 {
 // Number of elements at division 0
    nverts[0] = Polyhedron<poly_type>::Nv;
@@ -134,24 +191,43 @@ void SphericalTesselation<poly_type, max_division>::AllocateStorage(void)
       if(newverts_at_face[div - 1]) nverts[div] += nfaces[div - 1];
       nedges[div] = nverts[div] + nfaces[div] - 2;
    };
+};
+
+/*!
+\author Vladimir Florinski
+\date 05/01/2024
+*/
+template <PolyType poly_type, int max_division>
+void SphericalTesselation<poly_type, max_division>::AllocateStorage(void)
+{
+   ComputeCounts();
 
 // Allocate memory for vertex coordinates. Vertices at lower divisions are subsets of vertices at higher divisions, so a single array is sufficient.
    vert_lat  = new double[nverts[max_division]];
    vert_lon  = new double[nverts[max_division]];
    vert_cart = new GeoVector[nverts[max_division]];
 
-// Allocate memory for the connectivity arrays
+// Allocate memory for the connectivity arrays. Each table is a single contiguous block with a fixed row length, so rows that are shorter (division 0 and singular vertices) are padded with -1.
    for(auto div = 0; div <= max_division; div++) {
-      vv_con[div] = Create2D<int>(nverts[div], edges_per_vert[div]);
-      ve_con[div] = Create2D<int>(nverts[div], edges_per_vert[div]);
-      vf_con[div] = Create2D<int>(nverts[div], edges_per_vert[div]);
-
-      ev_con[div] = Create2D<int>(nedges[div], 2);
-      ef_con[div] = Create2D<int>(nedges[div], 2);
-
-      fv_con[div] = Create2D<int>(nfaces[div], verts_per_face[div]);
-      fe_con[div] = Create2D<int>(nfaces[div], verts_per_face[div]);
-      ff_con[div] = Create2D<int>(nfaces[div], verts_per_face[div]);
+      vv_con[div].Allocate(nverts[div]);
+      ve_con[div].Allocate(nverts[div]);
+      vf_con[div].Allocate(nverts[div]);
+
+      ev_con[div].Allocate(nedges[div]);
+      ef_con[div].Allocate(nedges[div]);
+
+      fv_con[div].Allocate(nfaces[div]);
+      fe_con[div].Allocate(nfaces[div]);
+      ff_con[div].Allocate(nfaces[div]);
+
+      vv_con[div].Fill(-1);
+      ve_con[div].Fill(-1);
+      vf_con[div].Fill(-1);
+      ev_con[div].Fill(-1);
+      ef_con[div].Fill(-1);
+      fv_con[div].Fill(-1);
+      fe_con[div].Fill(-1);
+      ff_con[div].Fill(-1);
    };
 
 // Copy base polyhedron coordinates
@@ -164,9 +240,13 @@ void SphericalTesselation<poly_type, max_division>::AllocateStorage(void)
       vert_cart[vert].ToCartesian(cos(vert_lat[vert]), sin(vert_lat[vert]), sin(vert_lon[vert]), cos(vert_lon[vert]));
    };
 
-// Copy base polyhedron connectivity
-   memcpy(vv_con[0][0], Polyhedron<poly_type>::vert_vert[0], nverts[0] * edges_per_vert[0] * sizeof(int));
-   memcpy(fv_con[0][0], Polyhedron<poly_type>::face_vert[0], nfaces[0] * verts_per_face[0] * sizeof(int));
+// Copy base polyhedron connectivity row by row because the row lengths may differ
+   for(auto vert = 0; vert < nverts[0]; vert++) {
+      memcpy(vv_con[0][vert], Polyhedron<poly_type>::vert_vert[vert], edges_per_vert[0] * SZINT);
+   };
+   for(auto face = 0; face < nfaces[0]; face++) {
+      memcpy(fv_con[0][face], Polyhedron<poly_type>::face_vert[face], verts_per_face[0] * SZINT);
+   };
 };
 
 /*!
@@ -200,21 +280,31 @@ catch(const TessError& err) {
 template <PolyType poly_type, int max_division>
 void SphericalTesselation<poly_type, max_division>::FreeStorage(void)
 {
-// Free memory used for vertex coordinates
-   delete[] vert_lat;
-   delete[] vert_lon;
-   delete[] vert_cart;
+// Free memory used for vertex coordinates. If the tesselation was loaded from a cache file, the coordinates and the tables only point into the mapped region.
+   if(cache_map) {
+      munmap(cache_map, cache_length);
+      cache_map = nullptr;
+      cache_length = 0;
+   }
+   else {
+      delete[] vert_lat;
+      delete[] vert_lon;
+      delete[] vert_cart;
+   };
+   vert_lat = nullptr;
+   vert_lon = nullptr;
+   vert_cart = nullptr;
 
 // Release connectivity array memory
    for(auto div = 0; div <= max_division; div++) {
-      Delete2D(vv_con[div]);
-      Delete2D(ve_con[div]);
-      Delete2D(vf_con[div]);
-      Delete2D(ev_con[div]);
-      Delete2D(ef_con[div]);
-      Delete2D(fv_con[div]);
-      Delete2D(fe_con[div]);
-      Delete2D(ff_con[div]);
+      vv_con[div].Free();
+      ve_con[div].Free();
+      vf_con[div].Free();
+      ev_con[div].Free();
+      ef_con[div].Free();
+      fv_con[div].Free();
+      fe_con[div].Free();
+      ff_con[div].Free();
    };
 };
 
@@ -555,7 +645,8 @@ void SphericalTesselation<poly_type, max_division>::VertEdgeConn(int div)
       sing_nbrs = edges_per_vert[0];
       offset = 0;
    };
-   err = BuildReverse(nedges[div], 2, 0, 2, 0, ev_con[div], nverts[div], edges_per_vert[div], sing_vert, sing_nbrs, offset, ve_con[div]);
+   err = BuildReverse(nedges[div], 2, 0, 2, 0, edge_stride, ev_con[div].Data(),
+                      nverts[div], edges_per_vert[div], sing_vert, sing_nbrs, offset, vert_stride, ve_con[div].Data());
    if(err != TESERR_NOERR) throw TessError(callerID, div, err, __LINE__);
 
 // Make VE CC-ordered and synchronized with VV.
@@ -620,8 +711,8 @@ void SphericalTesselation<poly_type, max_division>::VertFaceConn(int div)
       sing_nbrs = edges_per_vert[0];
       offset = 0;
    };
-   err = BuildReverse(nfaces[div], verts_per_face[div], 0, verts_per_face[div], 0, fv_con[div],
-                      nverts[div], edges_per_vert[div], sing_vert, sing_nbrs, offset, vf_con[div]);
+   err = BuildReverse(nfaces[div], verts_per_face[div], 0, verts_per_face[div], 0, face_stride, fv_con[div].Data(),
+                      nverts[div], edges_per_vert[div], sing_vert, sing_nbrs, offset, vert_stride, vf_con[div].Data());
    if(err != TESERR_NOERR) throw TessError(callerID, div, err, __LINE__);
 
 // Make VF CC-ordered and synchronized with VV, VE.
@@ -790,6 +881,170 @@ void SphericalTesselation<poly_type, max_division>::FaceFaceConn(int div)
    };
 };
 
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// Cache file SphericalTesselation methods
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[out] offsets Offsets of each section from the start of the payload; the last entry is the size of the payload
+\return Number of sections
+*/
+template <PolyType poly_type, int max_division>
+size_t SphericalTesselation<poly_type, max_division>::CacheLayout(size_t* offsets) const
+{
+   size_t sizes[TESS_CACHE_FIXED_SECTIONS + TESS_CACHE_TABLES * (max_division + 1)];
+   int sect = 0;
+
+   sizes[sect++] = 3 * (max_division + 1) * sizeof(int32_t);
+   sizes[sect++] = nverts[max_division] * sizeof(double);
+   sizes[sect++] = nverts[max_division] * sizeof(double);
+   sizes[sect++] = nverts[max_division] * sizeof(GeoVector);
+
+   for(auto div = 0; div <= max_division; div++) {
+      for(auto tab = 0; tab < 3; tab++) sizes[sect++] = nverts[div] * vert_stride * SZINT;
+      for(auto tab = 0; tab < 2; tab++) sizes[sect++] = nedges[div] * edge_stride * SZINT;
+      for(auto tab = 0; tab < 3; tab++) sizes[sect++] = nfaces[div] * face_stride * SZINT;
+   };
+
+// Every section is aligned on an 8 byte boundary
+   offsets[0] = 0;
+   for(auto i = 0; i < sect; i++) offsets[i + 1] = offsets[i] + ((sizes[i] + 7) & ~size_t(7));
+   return sect;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] cache_file Name of the file to write
+\return True on success
+*/
+template <PolyType poly_type, int max_division>
+bool SphericalTesselation<poly_type, max_division>::WriteCache(const std::string& cache_file) const
+{
+   size_t offsets[TESS_CACHE_FIXED_SECTIONS + TESS_CACHE_TABLES * (max_division + 1) + 1];
+   int sect = 0;
+   size_t n_sect = CacheLayout(offsets);
+
+// Assemble the payload in memory so that the checksum can be placed in the header
+   std::vector<char> payload(offsets[n_sect], 0);
+   int32_t* counts = reinterpret_cast<int32_t*>(payload.data() + offsets[sect++]);
+   for(auto div = 0; div <= max_division; div++) {
+      counts[div] = nverts[div];
+      counts[div + max_division + 1] = nedges[div];
+      counts[div + 2 * (max_division + 1)] = nfaces[div];
+   };
+
+   memcpy(payload.data() + offsets[sect++], vert_lat, nverts[max_division] * sizeof(double));
+   memcpy(payload.data() + offsets[sect++], vert_lon, nverts[max_division] * sizeof(double));
+   memcpy(payload.data() + offsets[sect++], vert_cart, nverts[max_division] * sizeof(GeoVector));
+
+   for(auto div = 0; div <= max_division; div++) {
+      memcpy(payload.data() + offsets[sect++], vv_con[div].Data(), vv_con[div].Size() * SZINT);
+      memcpy(payload.data() + offsets[sect++], ve_con[div].Data(), ve_con[div].Size() * SZINT);
+      memcpy(payload.data() + offsets[sect++], vf_con[div].Data(), vf_con[div].Size() * SZINT);
+      memcpy(payload.data() + offsets[sect++], ev_con[div].Data(), ev_con[div].Size() * SZINT);
+      memcpy(payload.data() + offsets[sect++], ef_con[div].Data(), ef_con[div].Size() * SZINT);
+      memcpy(payload.data() + offsets[sect++], fv_con[div].Data(), fv_con[div].Size() * SZINT);
+      memcpy(payload.data() + offsets[sect++], fe_con[div].Data(), fe_con[div].Size() * SZINT);
+      memcpy(payload.data() + offsets[sect++], ff_con[div].Data(), ff_con[div].Size() * SZINT);
+   };
+
+   TessCacheHeader header;
+   memset(&header, 0, sizeof(header));
+   memcpy(header.magic, tess_cache_magic, sizeof(header.magic));
+   header.version = TESS_CACHE_VERSION;
+   header.poly_type = poly_type;
+   header.max_division = max_division;
+   header.vert_stride = vert_stride;
+   header.edge_stride = edge_stride;
+   header.face_stride = face_stride;
+   header.payload_size = payload.size();
+   header.checksum = TessChecksum(payload.data(), payload.size());
+
+   std::ofstream tessfile(cache_file.c_str(), std::ofstream::binary);
+   if(!tessfile.is_open()) return false;
+   tessfile.write((char*)&header, sizeof(header));
+   tessfile.write(payload.data(), payload.size());
+   return tessfile.good();
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] cache_file Name of the file to read
+\return True on success, false if the file could not be used
+
+The file is mapped read-only and shared, so all processes on a node that load the same file use a single copy of the mesh in the page cache.
+*/
+template <PolyType poly_type, int max_division>
+bool SphericalTesselation<poly_type, max_division>::ReadCache(const std::string& cache_file)
+{
+   int fd = open(cache_file.c_str(), O_RDONLY);
+   if(fd == -1) return false;
+
+   struct stat fileinfo;
+   if((fstat(fd, &fileinfo) == -1) || (fileinfo.st_size < (off_t)sizeof(TessCacheHeader))) {
+      close(fd);
+      return false;
+   };
+
+   size_t length = fileinfo.st_size;
+   void* map = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+   close(fd);
+   if(map == MAP_FAILED) return false;
+
+   char* base = static_cast<char*>(map);
+   const TessCacheHeader* header = reinterpret_cast<const TessCacheHeader*>(base);
+   char* payload = base + sizeof(TessCacheHeader);
+
+// Check that the file was produced for this polyhedron, division, and storage layout
+   bool valid = (memcmp(header->magic, tess_cache_magic, sizeof(header->magic)) == 0)
+             && (header->version == TESS_CACHE_VERSION)
+             && (header->poly_type == poly_type) && (header->max_division == max_division)
+             && (header->vert_stride == vert_stride) && (header->edge_stride == edge_stride) && (header->face_stride == face_stride)
+             && (header->payload_size == length - sizeof(TessCacheHeader));
+
+   ComputeCounts();
+   size_t offsets[TESS_CACHE_FIXED_SECTIONS + TESS_CACHE_TABLES * (max_division + 1) + 1];
+   size_t n_sect = CacheLayout(offsets);
+   if(valid) valid = (header->payload_size == offsets[n_sect]);
+   if(valid) valid = (header->checksum == TessChecksum(payload, header->payload_size));
+
+// Element counts must agree with the ones computed from the template arguments
+   const int32_t* counts = reinterpret_cast<const int32_t*>(payload);
+   for(auto div = 0; valid && (div <= max_division); div++) {
+      valid = (counts[div] == nverts[div]) && (counts[div + max_division + 1] == nedges[div]) && (counts[div + 2 * (max_division + 1)] == nfaces[div]);
+   };
+
+   if(!valid) {
+      munmap(map, length);
+      return false;
+   };
+
+   cache_map = map;
+   cache_length = length;
+
+   int sect = 1;
+   vert_lat  = reinterpret_cast<double*>(payload + offsets[sect++]);
+   vert_lon  = reinterpret_cast<double*>(payload + offsets[sect++]);
+   vert_cart = reinterpret_cast<GeoVector*>(payload + offsets[sect++]);
+
+   for(auto div = 0; div <= max_division; div++) {
+      vv_con[div].Map(nverts[div], reinterpret_cast<int*>(payload + offsets[sect++]));
+      ve_con[div].Map(nverts[div], reinterpret_cast<int*>(payload + offsets[sect++]));
+      vf_con[div].Map(nverts[div], reinterpret_cast<int*>(payload + offsets[sect++]));
+      ev_con[div].Map(nedges[div], reinterpret_cast<int*>(payload + offsets[sect++]));
+      ef_con[div].Map(nedges[div], reinterpret_cast<int*>(payload + offsets[sect++]));
+      fv_con[div].Map(nfaces[div], reinterpret_cast<int*>(payload + offsets[sect++]));
+      fe_con[div].Map(nfaces[div], reinterpret_cast<int*>(payload + offsets[sect++]));
+      ff_con[div].Map(nfaces[div], reinterpret_cast<int*>(payload + offsets[sect++]));
+   };
+
+   return true;
+};
+
 template class SphericalTesselation<POLY_TETRAHEDRON, 3>;
 template class SphericalTesselation<POLY_HEXAHEDRON, 3>;
 template class SphericalTesselation<POLY_OCTAHEDRON, 3>;
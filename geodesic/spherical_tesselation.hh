@@ -10,8 +10,10 @@ This file is part of the SPECTRUM suite of scientific numerical simulation codes
 #define SPECTRUM_SPHERICAL_TESSELATION_HH
 
 #include <iostream>
+#include <string>
 #include <cstdint>
 #include "common/vectors.hh"
+#include "common/flat_table.hh"
 #include "geodesic/polyhedron.hh"
 
 namespace Spectrum {
@@ -50,9 +52,54 @@ const std::string tess_error_msg[] = {"",
                                       "Mismatch between connectivity tables"};
 
 
+//! Version of the tesselation cache file format, to be incremented whenever the layout changes
+#define TESS_CACHE_VERSION 1
+
+//! Identifier at the beginning of every tesselation cache file
+const char tess_cache_magic[8] = {'S', 'P', 'C', 'T', 'E', 'S', 'S', '\0'};
+
+/*!
+\brief Fixed size header of a tesselation cache file
+\author Swati Sharma
+
+The header is followed by the payload: the element counts for each division, vertex latitudes, longitudes, and Cartesian coordinates, and the eight connectivity tables for each division in the order VV, VE, VF, EV, EF, FV, FE, FF. Every section starts on an 8 byte boundary. All data are stored in the native byte order.
+*/
+struct TessCacheHeader
+{
+//! Must be equal to "tess_cache_magic"
+   char magic[8];
+
+//! Must be equal to TESS_CACHE_VERSION
+   uint32_t version;
+
+//! Polyhedron type
+   int32_t poly_type;
+
+//! Largest division
+   int32_t max_division;
+
+//! Row length of the VV, VE, and VF tables
+   int32_t vert_stride;
+
+//! Row length of the EV and EF tables
+   int32_t edge_stride;
+
+//! Row length of the FV, FE, and FF tables
+   int32_t face_stride;
+
+//! Size of the payload in bytes
+   uint64_t payload_size;
+
+//! Checksum of the payload
+   uint64_t checksum;
+};
+
+//! Computes a 64 bit FNV-type checksum of a memory block
+uint64_t TessChecksum(const char* data, size_t size);
+
 //! Computes a general reverse connectivity table
-TERR_TYPE BuildReverse(int n_nodes1, int n_nbrs1, int n_sing1, int n_nbrs1s, int start_sing1, const int* const* conn_12,
-                       int n_nodes2, int n_nbrs2, int n_sing2, int n_nbrs2s, int start_sing2,       int* const* conn_21);
+TERR_TYPE BuildReverse(int n_nodes1, int n_nbrs1, int n_sing1, int n_nbrs1s, int start_sing1, int stride1, const int* conn_12,
+                       int n_nodes2, int n_nbrs2, int n_sing2, int n_nbrs2s, int start_sing2, int stride2,       int* conn_21);
 
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 // Exceptions
@@ -125,6 +172,17 @@ Tesselation is a partitioning of the surface of a sphere into spherical polygons
 template <PolyType poly_type, int max_division>
 class SphericalTesselation : public Polyhedron<poly_type>
 {
+public:
+
+//! Row length of the VV, VE, and VF tables (largest number of neighbors per vertex in any division)
+   static constexpr int vert_stride = (poly_type == POLY_HEXAHEDRON ? 4 : 6);
+
+//! Row length of the FV, FE, and FF tables (largest number of vertices per face in any division)
+   static constexpr int face_stride = (poly_type == POLY_DODECAHEDRON ? 5 : (poly_type == POLY_HEXAHEDRON ? 4 : 3));
+
+//! Row length of the EV and EF tables
+   static constexpr int edge_stride = 2;
+
 protected:
 
 //! The number of vertices in each division
@@ -160,29 +218,35 @@ protected:
 //! Cartesian coordinates of vertices on a unit sphere
    GeoVector* vert_cart = nullptr;
 
-//! Vertex-vertex connectivity array (not ordered)
-   int** vv_con[max_division + 1] = {nullptr};
+//! Vertex-vertex connectivity array (not ordered). Rows of singular vertices and all rows of division 0 are padded with -1.
+   FlatTable<int, vert_stride> vv_con[max_division + 1];
 
 //! Vertex-edge connectivity array (not ordered)
-   int** ve_con[max_division + 1] = {nullptr};
+   FlatTable<int, vert_stride> ve_con[max_division + 1];
 
 //! Vertex-face connectivity array (ordered counter-clockwise)
-   int** vf_con[max_division + 1] = {nullptr};
+   FlatTable<int, vert_stride> vf_con[max_division + 1];
 
 //! Edge-vertex connectivity array (not ordered)
-   int** ev_con[max_division + 1] = {nullptr};
+   FlatTable<int, edge_stride> ev_con[max_division + 1];
 
 //! Edge-face connectivity array (not ordered)
-   int** ef_con[max_division + 1] = {nullptr};
+   FlatTable<int, edge_stride> ef_con[max_division + 1];
    
 //! Face-vertex connectivity array (ordered counter-clockwise)
-   int** fv_con[max_division + 1] = {nullptr};
+   FlatTable<int, face_stride> fv_con[max_division + 1];
 
 //! Face-edge connectivity array (ordered counter-clockwise)
-   int** fe_con[max_division + 1] = {nullptr};
+   FlatTable<int, face_stride> fe_con[max_division + 1];
 
 //! Face-face connectivity array (ordered counter-clockwise)
-   int** ff_con[max_division + 1] = {nullptr};
+   FlatTable<int, face_stride> ff_con[max_division + 1];
+
+//! Beginning of the memory mapped cache file, if the tesselation was loaded from one
+   void* cache_map = nullptr;
+
+//! Length of the memory mapped region
+   size_t cache_length = 0;
 
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -227,6 +291,9 @@ protected:
 //! Compute FF (CC-ordered and synchronized with FV. FE).
    void FaceFaceConn(int div);
 
+//! Compute the number of elements in each division
+   void ComputeCounts(void);
+
 //! Memory allocator
    void AllocateStorage(void);
 
@@ -236,17 +303,35 @@ protected:
 //! Memory de-allocator
    void FreeStorage(void);
 
+//! Compute the byte offsets of the payload sections in a cache file
+   size_t CacheLayout(size_t* offsets) const;
+
+//! Map the coordinates and connectivity from a cache file
+   bool ReadCache(const std::string& cache_file);
+
 public:
 
 //! Default constructor
    SphericalTesselation(void);
 
+//! Constructor from a cache file
+   explicit SphericalTesselation(const std::string& cache_file);
+
 //! Copy constructor
    SphericalTesselation(const SphericalTesselation& other) = delete;
 
 //! Destructor
    ~SphericalTesselation();
 
+//! Save the coordinates and connectivity to a cache file
+   bool WriteCache(const std::string& cache_file) const;
+
+//! Return true if the tesselation was loaded from a cache file
+   bool FromCache(void) const;
+
+//! Return the default name of the cache file for this tesselation type
+   static std::string CacheFileName(void);
+
 //! Return number of vertices in a given division.
    SPECTRUM_DEVICE_FUNC int NVerts(int div) const;
 
@@ -255,6 +340,30 @@ public:
 
 //! Return number of faces in a given division.
    SPECTRUM_DEVICE_FUNC int NFaces(int div) const;
+
+//! Return the vertex neighbors of a vertex.
+   SPECTRUM_DEVICE_FUNC TableRow<const int> VertVerts(int div, int vert) const;
+
+//! Return the edge neighbors of a vertex.
+   SPECTRUM_DEVICE_FUNC TableRow<const int> VertEdges(int div, int vert) const;
+
+//! Return the face neighbors of a vertex.
+   SPECTRUM_DEVICE_FUNC TableRow<const int> VertFaces(int div, int vert) const;
+
+//! Return the vertices of an edge.
+   SPECTRUM_DEVICE_FUNC TableRow<const int> EdgeVerts(int div, int edge) const;
+
+//! Return the faces of an edge.
+   SPECTRUM_DEVICE_FUNC TableRow<const int> EdgeFaces(int div, int edge) const;
+
+//! Return the vertices of a face.
+   SPECTRUM_DEVICE_FUNC TableRow<const int> FaceVerts(int div, int face) const;
+
+//! Return the edges of a face.
+   SPECTRUM_DEVICE_FUNC TableRow<const int> FaceEdges(int div, int face) const;
+
+//! Return the face neighbors of a face.
+   SPECTRUM_DEVICE_FUNC TableRow<const int> FaceFaces(int div, int face) const;
 };
 
 //----------------------------------------------------------------------------------------------------------------------------------------------------
@@ -347,7 +456,7 @@ SPECTRUM_DEVICE_FUNC inline void SphericalTesselation<poly_type, max_division>::
 /*!
 \author Vladimir Florinski
 \date 04/06/2020
-\param[in] div   Division
+\param[in] div  Division
 \param[in] vert1 First vertex
 \param[in] vert2 Second vertex
 \return Edge connecting "vert1" and "vert2" (-1 if vertices are not connected)
@@ -368,6 +477,28 @@ SPECTRUM_DEVICE_FUNC inline int SphericalTesselation<poly_type, max_division>::M
    return -1;
 };
 
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return True if the storage is mapped from a cache file
+*/
+template <PolyType poly_type, int max_division>
+inline bool SphericalTesselation<poly_type, max_division>::FromCache(void) const
+{
+   return cache_map != nullptr;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return File name unique to the polyhedron type and division
+*/
+template <PolyType poly_type, int max_division>
+inline std::string SphericalTesselation<poly_type, max_division>::CacheFileName(void)
+{
+   return "tesselation_" + std::to_string(poly_type) + "_" + std::to_string(max_division) + ".bin";
+};
+
 /*!
 \author Vladimir Florinski
 \date 08/30/2019
@@ -404,6 +535,110 @@ SPECTRUM_DEVICE_FUNC inline int SphericalTesselation<poly_type, max_division>::N
    return nfaces[div];
 };
 
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] div  Division
+\param[in] vert Vertex
+\return View of the VV row (singular vertices have a shorter row)
+*/
+template <PolyType poly_type, int max_division>
+SPECTRUM_DEVICE_FUNC inline TableRow<const int> SphericalTesselation<poly_type, max_division>::VertVerts(int div, int vert) const
+{
+   return vv_con[div].Row(vert, NVertNbrs(div, vert));
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] div  Division
+\param[in] vert Vertex
+\return View of the VE row (singular vertices have a shorter row)
+*/
+template <PolyType poly_type, int max_division>
+SPECTRUM_DEVICE_FUNC inline TableRow<const int> SphericalTesselation<poly_type, max_division>::VertEdges(int div, int vert) const
+{
+   return ve_con[div].Row(vert, NVertNbrs(div, vert));
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] div  Division
+\param[in] vert Vertex
+\return View of the VF row (singular vertices have a shorter row)
+*/
+template <PolyType poly_type, int max_division>
+SPECTRUM_DEVICE_FUNC inline TableRow<const int> SphericalTesselation<poly_type, max_division>::VertFaces(int div, int vert) const
+{
+   return vf_con[div].Row(vert, NVertNbrs(div, vert));
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] div  Division
+\param[in] edge Edge
+\return View of the EV row
+*/
+template <PolyType poly_type, int max_division>
+SPECTRUM_DEVICE_FUNC inline TableRow<const int> SphericalTesselation<poly_type, max_division>::EdgeVerts(int div, int edge) const
+{
+   return ev_con[div].Row(edge, 2);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] div  Division
+\param[in] edge Edge
+\return View of the EF row
+*/
+template <PolyType poly_type, int max_division>
+SPECTRUM_DEVICE_FUNC inline TableRow<const int> SphericalTesselation<poly_type, max_division>::EdgeFaces(int div, int edge) const
+{
+   return ef_con[div].Row(edge, 2);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] div  Division
+\param[in] face Face
+\return View of the FV row
+*/
+template <PolyType poly_type, int max_division>
+SPECTRUM_DEVICE_FUNC inline TableRow<const int> SphericalTesselation<poly_type, max_division>::FaceVerts(int div, int face) const
+{
+   return fv_con[div].Row(face, verts_per_face[div]);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] div  Division
+\param[in] face Face
+\return View of the FE row
+*/
+template <PolyType poly_type, int max_division>
+SPECTRUM_DEVICE_FUNC inline TableRow<const int> SphericalTesselation<poly_type, max_division>::FaceEdges(int div, int face) const
+{
+   return fe_con[div].Row(face, verts_per_face[div]);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] div  Division
+\param[in] face Face
+\return View of the FF row
+*/
+template <PolyType poly_type, int max_division>
+SPECTRUM_DEVICE_FUNC inline TableRow<const int> SphericalTesselation<poly_type, max_division>::FaceFaces(int div, int face) const
+{
+   return ff_con[div].Row(face, verts_per_face[div]);
+};
+
 };
 
 #endif
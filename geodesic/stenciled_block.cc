@@ -69,8 +69,12 @@ void StenciledBlock<verts_per_face>::SetDimensions(int width, int wghost, int he
    MarkStenciledArea();
    stencil_zonelist = Create2D<int*>(n_faces_withghost, n_stencils);
    memset(stencil_zonelist[0], 0x0, n_faces_withghost * n_stencils * sizeof(int*));
-   geom_matr_At = Create2D<Eigen::MatrixXd>(n_faces_withghost, n_stencils);
-   geom_matr_LU = Create2D<Eigen::PartialPivLU<Eigen::MatrixXd>>(n_faces_withghost, n_stencils);
+
+// Geometry matrices for all faces and stencils are kept in two contiguous arrays. The padding zones of At are never overwritten, so they stay zero.
+   geom_matr_At = new double[n_stencils * 3 * max_zones_per_stencil * n_faces_withghost];
+   memset(geom_matr_At, 0x0, n_stencils * 3 * max_zones_per_stencil * n_faces_withghost * SZDBL);
+   geom_matr_inv = new double[n_stencils * n_ata_elements * n_faces_withghost];
+   memset(geom_matr_inv, 0x0, n_stencils * n_ata_elements * n_faces_withghost * SZDBL);
 };
 
 /*!
@@ -80,8 +84,8 @@ void StenciledBlock<verts_per_face>::SetDimensions(int width, int wghost, int he
 template <int verts_per_face>
 void StenciledBlock<verts_per_face>::FreeStorage(void)
 {
-   Delete2D(geom_matr_At);
-   Delete2D(geom_matr_LU);
+   delete[] geom_matr_At;
+   delete[] geom_matr_inv;
 
 // Free up stencils
    for(auto pface = 0; pface < n_faces_withghost; pface++) {
@@ -118,6 +122,9 @@ void StenciledBlock<verts_per_face>::AssociateMesh(int index, double ximin, doub
    BuildAllStencils();
 
    ComputeMoments();
+
+// Each face writes only its own slots in the matrix arrays, so the faces can be processed concurrently.
+#pragma omp parallel for schedule(static)
    for(auto pface = 0; pface < n_faces_withghost; pface++) {
       if(BITS_RAISED(face_mask[pface], GEOELM_STEN)) {
          for(auto stencil = 0; stencil < n_stencils; stencil++) {
@@ -138,11 +145,12 @@ void StenciledBlock<verts_per_face>::AssociateMesh(int index, double ximin, doub
 template <int verts_per_face>
 void StenciledBlock<verts_per_face>::ComputeMoments(void)
 {
-   double area1, area2;
-   GeoVector cm1, cm2;
-
 // Compute face areas and face centers.
+#pragma omp parallel for schedule(static)
    for(auto face = 0; face < n_faces_withghost; face++) {
+      double area1, area2;
+      GeoVector cm1, cm2;
+
       if(BITS_RAISED(face_mask[face], GEOELM_NEXI)) {
          face_area[face] = 0.0;
          face_cmass[face] = gv_zeros;
@@ -169,8 +177,9 @@ void StenciledBlock<verts_per_face>::ComputeMoments(void)
    };
 
 // Compute edge lengths
+#pragma omp parallel for schedule(static)
    for(auto edge = 0; edge < n_edges_withghost; edge++) {
-      if(BITS_RAISED(edge_mask[edge], GEOELM_NEXI)) {
+      if(BITS_LOWERED(edge_mask[edge], GEOELM_NEXI)) {
          edge_length[edge] = acos(block_vert_cart[ev_local[edge][0]] * block_vert_cart[ev_local[edge][1]]);
       };
    };
@@ -301,34 +310,40 @@ void StenciledBlock<verts_per_face>::BuildAllStencils(void)
 template <int verts_per_face>
 void StenciledBlock<verts_per_face>::ComputeOneMatrix(int pface, int stencil)
 {
-   int face;
-   double rp_factor;
-   Eigen::MatrixXd geom_matr_A, geom_matr_AtA;
-   geom_matr_A.resize(zones_per_stencil[stencil], 3);
+   int face, row, col;
+   double rp_factor, A[max_zones_per_stencil][3], ata[n_ata_elements], cof[n_ata_elements], det;
 
 // Generate the geometry matrix. Each row corresponds to one zone in the stencil.
-   for(auto row = 0; row < zones_per_stencil[stencil]; row++) {
+   for(row = 0; row < zones_per_stencil[stencil]; row++) {
       face = stencil_zonelist[pface][stencil][2 * row];
-      switch(stencil_zonelist[pface][stencil][2 * row + 1]) {
-      case -1:
-         rp_factor = (1.0 + drp_ratio);
-         break;
-      case 1:
-         rp_factor = 1.0 / (1.0 + drp_ratio);
-         break;
-      default:
-         rp_factor = 1.0;
-         break;
-      };
-      for(auto col = 0; col < 3; col++) {
-         geom_matr_A(row, col) = rp_factor * face_cmass[face][col] - face_cmass[pface][col];
+      rp_factor = RadialFactor(stencil_zonelist[pface][stencil][2 * row + 1]);
+      for(col = 0; col < 3; col++) {
+         A[row][col] = rp_factor * face_cmass[face][col] - face_cmass[pface][col];
+         geom_matr_At[AtIndex(pface, stencil, col, row)] = A[row][col];
       };
    };
 
-// Compute AT, ATA, and the LU decomposition
-   geom_matr_At[pface][stencil] = geom_matr_A.transpose();
-   geom_matr_AtA = geom_matr_At[pface][stencil] * geom_matr_A;
-   geom_matr_LU[pface][stencil].compute(geom_matr_AtA);
+// Compute the upper triangle of At*A
+   memset(ata, 0x0, n_ata_elements * SZDBL);
+   for(row = 0; row < zones_per_stencil[stencil]; row++) {
+      ata[0] += A[row][0] * A[row][0];
+      ata[1] += A[row][0] * A[row][1];
+      ata[2] += A[row][0] * A[row][2];
+      ata[3] += A[row][1] * A[row][1];
+      ata[4] += A[row][1] * A[row][2];
+      ata[5] += A[row][2] * A[row][2];
+   };
+
+// Invert the symmetric 3x3 matrix using cofactors
+   cof[0] = ata[3] * ata[5] - ata[4] * ata[4];
+   cof[1] = ata[2] * ata[4] - ata[1] * ata[5];
+   cof[2] = ata[1] * ata[4] - ata[2] * ata[3];
+   cof[3] = ata[0] * ata[5] - ata[2] * ata[2];
+   cof[4] = ata[1] * ata[2] - ata[0] * ata[4];
+   cof[5] = ata[0] * ata[3] - ata[1] * ata[1];
+   det = ata[0] * cof[0] + ata[1] * cof[1] + ata[2] * cof[2];
+
+   for(auto elem = 0; elem < n_ata_elements; elem++) geom_matr_inv[InvIndex(pface, stencil, elem)] = cof[elem] / det;
 };
 
 #ifdef GEO_DEBUG
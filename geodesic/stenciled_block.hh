@@ -9,7 +9,6 @@ This file is part of the SPECTRUM suite of scientific numerical simulation codes
 #ifndef SPECTRUM_STENCILED_BLOCK
 #define SPECTRUM_STENCILED_BLOCK
 
-#include <eigen3/Eigen/Dense>
 #include "geodesic/grid_block.hh"
 #include "common/polynomial.hh"
 
@@ -67,6 +66,12 @@ protected:
 //! Number of zones in each stencil, _excluding_ the principal
    int zones_per_stencil[n_stencils];
 
+//! Largest number of zones in any stencil (the central stencil)
+   static constexpr int max_zones_per_stencil = verts_per_face + 2;
+
+//! Number of unique elements of the symmetric 3x3 matrix At*A
+   static constexpr int n_ata_elements = 6;
+
 //! Face areas on the US
    double* face_area = nullptr;
 
@@ -79,11 +84,11 @@ protected:
 //! Stencil zonelists
    int*** stencil_zonelist = nullptr;
 
-//! Transposed geometry matrices
-   Eigen::MatrixXd** geom_matr_At = nullptr;
+//! Transposed geometry matrices, stored as [stencil][row][zone][face] and padded with zeros to "max_zones_per_stencil" zones
+   double* geom_matr_At = nullptr;
 
-//! LU decomposition of At*A
-   Eigen::PartialPivLU<Eigen::MatrixXd>** geom_matr_LU = {nullptr};
+//! Inverses of At*A, upper triangle (00, 01, 02, 11, 12, 22) stored as [stencil][element][face]
+   double* geom_matr_inv = nullptr;
 
 //! Build a list of stenciled zones and compute the stencil mask
    void MarkStenciledArea(void);
@@ -94,9 +99,21 @@ protected:
 //! Determine whether a zone is in the block's interior - face+k version
    bool IsInteriorZone_Int(int face, int k) const;
 
+//! Position of a transposed geometry matrix element in "geom_matr_At"
+   SPECTRUM_DEVICE_FUNC int AtIndex(int pface, int stencil, int row, int zone) const;
+
+//! Position of an element of the inverse of At*A in "geom_matr_inv"
+   SPECTRUM_DEVICE_FUNC int InvIndex(int pface, int stencil, int elem) const;
+
+//! Scale factor of the zone centers in a neighboring shell
+   SPECTRUM_DEVICE_FUNC double RadialFactor(int plane) const;
+
 //! Compute the geometry matrix for one stencil of a single face
    void ComputeOneMatrix(int pface, int stencil);
 
+//! Solve the least squares problem for the gradient in one stencil
+   SPECTRUM_DEVICE_FUNC void StencilGradient(int pface, int stencil, const double* diffs, double* grad) const;
+
 //! Compute the zone lists for each stencil for each zone
    void BuildAllStencils(void);
 
@@ -163,6 +180,81 @@ SPECTRUM_DEVICE_FUNC inline bool StenciledBlock<verts_per_face>::IsInteriorZone_
    return (k >= ghost_height) && (k <= n_shells_withghost - ghost_height - 1) && GridBlock<verts_per_face>::IsInteriorFace_Int(face);
 };
 
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] plane Shell offset of the zone (-1, 0, or 1)
+\return Ratio of the distances of the zone center in the shell "k+plane" and in the shell "k"
+*/
+template <int verts_per_face>
+SPECTRUM_DEVICE_FUNC inline double StenciledBlock<verts_per_face>::RadialFactor(int plane) const
+{
+   switch(plane) {
+   case -1:
+      return 1.0 / (1.0 + drp_ratio);
+   case 1:
+      return 1.0 + drp_ratio;
+   default:
+      return 1.0;
+   };
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] pface   Principal face
+\param[in] stencil Stencil (central, dir1, dir2, etc.)
+\param[in] row     Row of At (0 to 2)
+\param[in] zone    Zone in the stencil
+\return Index into "geom_matr_At"
+\note Faces are the fastest varying index, so that a loop over faces for a fixed element is unit stride.
+*/
+template <int verts_per_face>
+SPECTRUM_DEVICE_FUNC inline int StenciledBlock<verts_per_face>::AtIndex(int pface, int stencil, int row, int zone) const
+{
+   return ((stencil * 3 + row) * max_zones_per_stencil + zone) * n_faces_withghost + pface;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] pface   Principal face
+\param[in] stencil Stencil (central, dir1, dir2, etc.)
+\param[in] elem    Element of the upper triangle (0 to 5)
+\return Index into "geom_matr_inv"
+*/
+template <int verts_per_face>
+SPECTRUM_DEVICE_FUNC inline int StenciledBlock<verts_per_face>::InvIndex(int pface, int stencil, int elem) const
+{
+   return (stencil * n_ata_elements + elem) * n_faces_withghost + pface;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in]  pface   Principal face
+\param[in]  stencil Stencil (central, dir1, dir2, etc.)
+\param[in]  diffs   Differences between the zone values and the principal zone value, one per zone in the stencil
+\param[out] grad    Cartesian components of the gradient
+*/
+template <int verts_per_face>
+SPECTRUM_DEVICE_FUNC inline void StenciledBlock<verts_per_face>::StencilGradient(int pface, int stencil, const double* diffs, double* grad) const
+{
+   double b[3], inv[n_ata_elements];
+
+// Right hand side of the normal equations At*A*g = At*d
+   for(auto row = 0; row < 3; row++) {
+      b[row] = 0.0;
+      for(auto zone = 0; zone < zones_per_stencil[stencil]; zone++) b[row] += geom_matr_At[AtIndex(pface, stencil, row, zone)] * diffs[zone];
+   };
+
+// Multiply by the stored inverse of the symmetric matrix At*A
+   for(auto elem = 0; elem < n_ata_elements; elem++) inv[elem] = geom_matr_inv[InvIndex(pface, stencil, elem)];
+   grad[0] = inv[0] * b[0] + inv[1] * b[1] + inv[2] * b[2];
+   grad[1] = inv[1] * b[0] + inv[3] * b[1] + inv[4] * b[2];
+   grad[2] = inv[2] * b[0] + inv[4] * b[1] + inv[5] * b[2];
+};
+
 };
 
 #endif
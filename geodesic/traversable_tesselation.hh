@@ -43,6 +43,9 @@ public:
 //! Default constructor
    TraversableTesselation(void) = default;
 
+//! Constructor from a cache file
+   explicit TraversableTesselation(const std::string& cache_file);
+
 //! Compute lists of faces and vertices in a sector with ghost cells.
    void GetAllInsideFaceNative(int divs, int sect, int divf, int nghost, int* flist, int* vlist, bool* corners) const;
 };
@@ -73,6 +76,9 @@ public:
 //! Default constructor
    TraversableTesselation(void) = default;
 
+//! Constructor from a cache file
+   explicit TraversableTesselation(const std::string& cache_file);
+
 //! Destructor
    ~TraversableTesselation() = default;
 
@@ -80,6 +86,28 @@ public:
    void GetAllInsideFaceNative(int divs, int sect, int divf, int nghost, int* flist, int* vlist, bool* corners) const;
 };
 
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] cache_file Name of the tesselation cache file
+*/
+template <PolyType poly_type, int max_division>
+inline TraversableTesselation<poly_type, max_division>::TraversableTesselation(const std::string& cache_file)
+                                                      : RequestableTesselation<poly_type, max_division>(cache_file)
+{
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] cache_file Name of the tesselation cache file
+*/
+template <int max_division>
+inline TraversableTesselation<POLY_HEXAHEDRON, max_division>::TraversableTesselation(const std::string& cache_file)
+                                                             : RequestableTesselation<POLY_HEXAHEDRON, max_division>(cache_file)
+{
+};
+
 };
 
 #endif
@@ -17,6 +17,24 @@ This file is part of the SPECTRUM suite of scientific nThis file is part of the
 
 namespace Spectrum {
 
+//! Loops over arrays for a class that provides scalar "Physical()", "Reference()", and "Derivative()" functions
+#define ArrayFunctionsDistance(T) \
+void T::GetPhysicalArray(int n, const double* ref, double* phys) const \
+{ \
+_Pragma("omp simd") \
+   for(auto i = 0; i < n; i++) phys[i] = Physical(ref[i]); \
+}; \
+void T::GetReferenceArray(int n, const double* phys, double* ref) const \
+{ \
+_Pragma("omp simd") \
+   for(auto i = 0; i < n; i++) ref[i] = Reference(phys[i]); \
+}; \
+void T::GetDerivativeArray(int n, const double* ref, double* der) const \
+{ \
+_Pragma("omp simd") \
+   for(auto i = 0; i < n; i++) der[i] = Derivative(ref[i]); \
+};
+
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 // DistanceBase methods
 //----------------------------------------------------------------------------------------------------------------------------------------------------
@@ -178,11 +196,46 @@ void DistanceExponential::SetupDistance(bool construct)
 */
 void DistanceExponential::EvaluateDistance(void)
 {
-   if (selector == 0) _pos[0] = rmin * pow(ratio, _pos[1]);
-   else if (selector == 1) _pos[1] = log(_pos[0] / rmin) / log_ratio;
-   else _pos[2] = rmin * log_ratio * pow(ratio, _pos[1]);
+   if (selector == 0) _pos[0] = Physical(_pos[1]);
+   else if (selector == 1) _pos[1] = Reference(_pos[0]);
+   else _pos[2] = Derivative(_pos[1]);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] ref Reference variable
+\return Physical variable
+*/
+double DistanceExponential::Physical(double ref) const
+{
+   return rmin * exp(log_ratio * ref);
 };
 
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] phys Physical variable
+\return Reference variable
+*/
+double DistanceExponential::Reference(double phys) const
+{
+   return log(phys / rmin) / log_ratio;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] ref Reference variable
+\return Derivative of the physical variable
+*/
+double DistanceExponential::Derivative(double ref) const
+{
+   return rmin * log_ratio * exp(log_ratio * ref);
+};
+
+ArrayFunctionsDistance(DistanceExponential)
+
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 // DistancePowerLaw methods
 //----------------------------------------------------------------------------------------------------------------------------------------------------
@@ -229,11 +282,46 @@ void DistancePowerLaw::SetupDistance(bool construct)
 */
 void DistancePowerLaw::EvaluateDistance(void)
 {
-   if (selector == 0) _pos[0] = rmin * pow(1.0 + _pos[1] / ref0, powl);
-   else if (selector == 1) _pos[1] = ref0 * (pow(_pos[0] / rmin, pow_inv) - 1.0);
-   else _pos[2] = c * pow(1.0 + _pos[1] / ref0, powl - 1.0);
+   if (selector == 0) _pos[0] = Physical(_pos[1]);
+   else if (selector == 1) _pos[1] = Reference(_pos[0]);
+   else _pos[2] = Derivative(_pos[1]);
 };
 
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] ref Reference variable
+\return Physical variable
+*/
+double DistancePowerLaw::Physical(double ref) const
+{
+   return rmin * pow(1.0 + ref / ref0, powl);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] phys Physical variable
+\return Reference variable
+*/
+double DistancePowerLaw::Reference(double phys) const
+{
+   return ref0 * (pow(phys / rmin, pow_inv) - 1.0);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] ref Reference variable
+\return Derivative of the physical variable
+*/
+double DistancePowerLaw::Derivative(double ref) const
+{
+   return c * pow(1.0 + ref / ref0, powl - 1.0);
+};
+
+ArrayFunctionsDistance(DistancePowerLaw)
+
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 // DistanceLinearExp methods
 //----------------------------------------------------------------------------------------------------------------------------------------------------
@@ -286,15 +374,48 @@ void DistanceLinearExp::SetupDistance(bool construct)
 */
 void DistanceLinearExp::EvaluateDistance(void)
 {
-   double chi;
-   if (selector == 0) _pos[0] = rmin * (1.0 - C + _pos[1] / ref0 + C * pow(base, _pos[1]));
-   else if (selector == 1) {
-      chi = ref0 * (_pos[0] / rmin - 1.0 + C);
-      _pos[1] = chi - gsl_sf_lambert_W0(ref0 * C * logy * pow(base, chi)) / logy;
-   }
-   else _pos[2] = rmin / ref0 + c * pow(base, _pos[1]);
+   if (selector == 0) _pos[0] = Physical(_pos[1]);
+   else if (selector == 1) _pos[1] = Reference(_pos[0]);
+   else _pos[2] = Derivative(_pos[1]);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] ref Reference variable
+\return Physical variable
+\note "pow(base, x)" is written as "exp(logy * x)", which is cheaper and vectorizes
+*/
+double DistanceLinearExp::Physical(double ref) const
+{
+   return rmin * (1.0 - C + ref / ref0 + C * exp(logy * ref));
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] phys Physical variable
+\return Reference variable
+*/
+double DistanceLinearExp::Reference(double phys) const
+{
+   double chi = ref0 * (phys / rmin - 1.0 + C);
+   return chi - gsl_sf_lambert_W0(ref0 * C * logy * exp(logy * chi)) / logy;
 };
 
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] ref Reference variable
+\return Derivative of the physical variable
+*/
+double DistanceLinearExp::Derivative(double ref) const
+{
+   return rmin / ref0 + c * exp(logy * ref);
+};
+
+ArrayFunctionsDistance(DistanceLinearExp)
+
 #ifdef GEO_DEBUG
 
 /*!
@@ -75,6 +75,15 @@ public:
 
 //! Return the derivative of the physical coordinate (strored in _pos[2])
    double GetDerivative(double ref);
+
+//! Compute the physical coordinates for an array of reference coordinates
+   virtual void GetPhysicalArray(int n, const double* ref, double* phys) const = 0;
+
+//! Compute the reference coordinates for an array of physical coordinates
+   virtual void GetReferenceArray(int n, const double* phys, double* ref) const = 0;
+
+//! Compute the derivatives of the physical coordinate for an array of reference coordinates
+   virtual void GetDerivativeArray(int n, const double* ref, double* der) const = 0;
 };
 
 //----------------------------------------------------------------------------------------------------------------------------------------------------
@@ -121,6 +130,24 @@ public:
 
 //! Clone function
    CloneFunctionDistance(DistanceExponential);
+
+//! Physical coordinate from the reference coordinate
+   double Physical(double ref) const;
+
+//! Reference coordinate from the physical coordinate
+   double Reference(double phys) const;
+
+//! Derivative of the physical coordinate
+   double Derivative(double ref) const;
+
+//! Compute the physical coordinates for an array of reference coordinates
+   void GetPhysicalArray(int n, const double* ref, double* phys) const override;
+
+//! Compute the reference coordinates for an array of physical coordinates
+   void GetReferenceArray(int n, const double* phys, double* ref) const override;
+
+//! Compute the derivatives of the physical coordinate for an array of reference coordinates
+   void GetDerivativeArray(int n, const double* ref, double* der) const override;
 };
 
 //----------------------------------------------------------------------------------------------------------------------------------------------------
@@ -173,6 +200,24 @@ public:
 
 //! Clone function
    CloneFunctionDistance(DistancePowerLaw);
+
+//! Physical coordinate from the reference coordinate
+   double Physical(double ref) const;
+
+//! Reference coordinate from the physical coordinate
+   double Reference(double phys) const;
+
+//! Derivative of the physical coordinate
+   double Derivative(double ref) const;
+
+//! Compute the physical coordinates for an array of reference coordinates
+   void GetPhysicalArray(int n, const double* ref, double* phys) const override;
+
+//! Compute the reference coordinates for an array of physical coordinates
+   void GetReferenceArray(int n, const double* phys, double* ref) const override;
+
+//! Compute the derivatives of the physical coordinate for an array of reference coordinates
+   void GetDerivativeArray(int n, const double* ref, double* der) const override;
 };
 
 //----------------------------------------------------------------------------------------------------------------------------------------------------
@@ -228,6 +273,24 @@ public:
 
 //! Clone function
    CloneFunctionDistance(DistanceLinearExp);
+
+//! Physical coordinate from the reference coordinate
+   double Physical(double ref) const;
+
+//! Reference coordinate from the physical coordinate
+   double Reference(double phys) const;
+
+//! Derivative of the physical coordinate
+   double Derivative(double ref) const;
+
+//! Compute the physical coordinates for an array of reference coordinates
+   void GetPhysicalArray(int n, const double* ref, double* phys) const override;
+
+//! Compute the reference coordinates for an array of physical coordinates
+   void GetReferenceArray(int n, const double* phys, double* ref) const override;
+
+//! Compute the derivatives of the physical coordinate for an array of reference coordinates
+   void GetDerivativeArray(int n, const double* ref, double* der) const override;
 };
 
 #ifdef GEO_DEBUG
@@ -65,13 +65,13 @@ protected:
 //! Cosine of the central angle
    double c;
 
+public:
+
 //! Compute the set of basis functions for the given point
-   SPECTRUM_DEVICE_FUNC void BasisFunctions(double del, double* psi) const;
+   SPECTRUM_DEVICE_FUNC static constexpr void BasisFunctions(double del, double* psi);
 
 //! Compute the set of basis function derivatives for the given point
-   SPECTRUM_DEVICE_FUNC void BasisDerivatives(double del, double* dpdd) const;
-
-public:
+   SPECTRUM_DEVICE_FUNC static constexpr void BasisDerivatives(double del, double* dpdd);
 
 //! Default constructor
    SPECTRUM_DEVICE_FUNC MappedEdge(void);
@@ -184,7 +184,7 @@ SPECTRUM_DEVICE_FUNC inline void MappedEdge<order>::GetVertAnchors(int iv, GeoVe
 \param[out] psi All edge basis function values
 */
 template <>
-SPECTRUM_DEVICE_FUNC inline void MappedEdge<1>::BasisFunctions(double del, double* psi) const
+SPECTRUM_DEVICE_FUNC inline constexpr void MappedEdge<1>::BasisFunctions(double del, double* psi)
 {
    psi[0] = 1.0 - del;
    psi[1] = del;
@@ -198,7 +198,7 @@ SPECTRUM_DEVICE_FUNC inline void MappedEdge<1>::BasisFunctions(double del, doubl
 \param[out] psi All edge basis function values
 */
 template <>
-SPECTRUM_DEVICE_FUNC inline void MappedEdge<2>::BasisFunctions(double del, double* psi) const
+SPECTRUM_DEVICE_FUNC inline constexpr void MappedEdge<2>::BasisFunctions(double del, double* psi)
 {
    double omd = 1.0 - del;
 
@@ -215,7 +215,7 @@ SPECTRUM_DEVICE_FUNC inline void MappedEdge<2>::BasisFunctions(double del, doubl
 \param[out] psi All edge basis function values
 */
 template <>
-SPECTRUM_DEVICE_FUNC inline void MappedEdge<3>::BasisFunctions(double del, double* psi) const
+SPECTRUM_DEVICE_FUNC inline constexpr void MappedEdge<3>::BasisFunctions(double del, double* psi)
 {
    double omd = 1.0 - del;
    double tomdm1 = 3.0 * omd - 1.0;
@@ -234,7 +234,7 @@ SPECTRUM_DEVICE_FUNC inline void MappedEdge<3>::BasisFunctions(double del, doubl
 \param[out] dpdd All edge basis function delta derivatives
 */
 template <>
-SPECTRUM_DEVICE_FUNC inline void MappedEdge<1>::BasisDerivatives(double del, double* dpdd) const
+SPECTRUM_DEVICE_FUNC inline constexpr void MappedEdge<1>::BasisDerivatives(double del, double* dpdd)
 {
    dpdd[0] = -1.0;
    dpdd[1] =  1.0;
@@ -247,7 +247,7 @@ SPECTRUM_DEVICE_FUNC inline void MappedEdge<1>::BasisDerivatives(double del, dou
 \param[out] dpdd All edge basis function delta derivatives
 */
 template <>
-SPECTRUM_DEVICE_FUNC inline void MappedEdge<2>::BasisDerivatives(double del, double* dpdd) const
+SPECTRUM_DEVICE_FUNC inline constexpr void MappedEdge<2>::BasisDerivatives(double del, double* dpdd)
 {
    double omd = 1.0 - del;
 
@@ -263,7 +263,7 @@ SPECTRUM_DEVICE_FUNC inline void MappedEdge<2>::BasisDerivatives(double del, dou
 \param[out] dpdd All edge basis function delta derivatives
 */
 template <>
-SPECTRUM_DEVICE_FUNC inline void MappedEdge<3>::BasisDerivatives(double del, double* dpdd) const
+SPECTRUM_DEVICE_FUNC inline constexpr void MappedEdge<3>::BasisDerivatives(double del, double* dpdd)
 {
    double omd = 1.0 - del;
    double tomdm1 = 3.0 * omd - 1.0;
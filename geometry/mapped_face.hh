@@ -19,7 +19,7 @@ This file is part of the SPECTRUM suite of scientific numerical simulation codes
 namespace Spectrum {
 
 //! Area of the reference (plane) element
-constexpr double ref_face_area[2] = {sqrtthr / 4.0, 1.0};
+constexpr double ref_face_area[2] = {M_SQRT3 / 4.0, 1.0};
 
 //                      2                    3-----------------------2
 //                     / \                   |                       |
@@ -74,27 +74,27 @@ constexpr int n_face_anchors[2][MAX_ELEMENT_ORDER] = {{3, 6, 10}, {4, 8, 12}};
 //! Reference coordinates of the face anchors (triangles, 1 order)
 constexpr double face_anchors_tria_1[n_face_anchors[0][0]][2] = {{0.0,       0.0          },
                                                                  {1.0,       0.0          },
-                                                                 {1.0 / 2.0, sqrtthr / 2.0}};
+                                                                 {1.0 / 2.0, M_SQRT3 / 2.0}};
 
 //! Reference coordinates of the face anchors (triangles, 2 order)
 constexpr double face_anchors_tria_2[n_face_anchors[0][1]][2] = {{0.0,       0.0          },
                                                                  {1.0,       0.0          },
-                                                                 {1.0 / 2.0, sqrtthr / 2.0},
+                                                                 {1.0 / 2.0, M_SQRT3 / 2.0},
                                                                  {1.0 / 2.0, 0.0          },
-                                                                 {3.0 / 4.0, sqrtthr / 4.0},
-                                                                 {1.0 / 4.0, sqrtthr / 4.0}};
+                                                                 {3.0 / 4.0, M_SQRT3 / 4.0},
+                                                                 {1.0 / 4.0, M_SQRT3 / 4.0}};
 
 //! Reference coordinates of the face anchors (triangles, 3 order)
 constexpr double face_anchors_tria_3[n_face_anchors[0][2]][2] = {{0.0,       0.0                  },
                                                                  {1.0,       0.0                  },
-                                                                 {1.0 / 2.0, sqrtthr / 2.0        },
+                                                                 {1.0 / 2.0, M_SQRT3 / 2.0        },
                                                                  {1.0 / 3.0, 0.0                  },
                                                                  {2.0 / 3.0, 0.0                  },
-                                                                 {5.0 / 6.0, 1.0 / (2.0 * sqrtthr)},
-                                                                 {2.0 / 3.0, 1.0 / sqrtthr        },
-                                                                 {1.0 / 3.0, 1.0 / sqrtthr        },
-                                                                 {1.0 / 6.0, 1.0 / (2.0 * sqrtthr)},
-                                                                 {1.0 / 2.0, 1.0 / (2.0 * sqrtthr)}};
+                                                                 {5.0 / 6.0, 1.0 / (2.0 * M_SQRT3)},
+                                                                 {2.0 / 3.0, 1.0 / M_SQRT3        },
+                                                                 {1.0 / 3.0, 1.0 / M_SQRT3        },
+                                                                 {1.0 / 6.0, 1.0 / (2.0 * M_SQRT3)},
+                                                                 {1.0 / 2.0, 1.0 / (2.0 * M_SQRT3)}};
 
 //! Reference coordinates of the face anchors (quads, 1 order)
 constexpr double face_anchors_quad_1[n_face_anchors[1][0]][2] = {{0.0, 0.0},
@@ -221,13 +221,13 @@ protected:
 //! Cosines of the central angles
    double c[n_verts];
 
+public:
+
 //! Compute the set of basis functions for the given point
-   SPECTRUM_DEVICE_FUNC void BasisFunctions(double alp, double bet, double* psi) const;
+   SPECTRUM_DEVICE_FUNC static constexpr void BasisFunctions(double alp, double bet, double* psi);
 
 //! Compute the complete set of basis function derivatives for the given point
-   SPECTRUM_DEVICE_FUNC void BasisDerivatives(double alp, double bet, double* dpda, double* dpdb) const;
-
-public:
+   SPECTRUM_DEVICE_FUNC static constexpr void BasisDerivatives(double alp, double bet, double* dpda, double* dpdb);
 
 //! Default constructor
    SPECTRUM_DEVICE_FUNC MappedFace(void);
@@ -388,11 +388,11 @@ SPECTRUM_DEVICE_FUNC inline void MappedFace<n_verts, order>::GetEdgeAnchors(int
 \param[out] psi All face basis function values
 */
 template <>
-SPECTRUM_DEVICE_FUNC inline void MappedFace<3, 1>::BasisFunctions(double alp, double bet, double* psi) const
+SPECTRUM_DEVICE_FUNC inline constexpr void MappedFace<3, 1>::BasisFunctions(double alp, double bet, double* psi)
 {
-   psi[0] = 1.0 - alp - oo_sqrtthr * bet;
-   psi[1] = alp - oo_sqrtthr * bet;
-   psi[2] = 2.0 * oo_sqrtthr * bet;
+   psi[0] = 1.0 - alp - M_SQRT1_3 * bet;
+   psi[1] = alp - M_SQRT1_3 * bet;
+   psi[2] = 2.0 * M_SQRT1_3 * bet;
 };
 
 /*!
@@ -403,14 +403,14 @@ SPECTRUM_DEVICE_FUNC inline void MappedFace<3, 1>::BasisFunctions(double alp, do
 \param[out] psi All face basis function values
 */
 template <>
-SPECTRUM_DEVICE_FUNC inline void MappedFace<3, 2>::BasisFunctions(double alp, double bet, double* psi) const
+SPECTRUM_DEVICE_FUNC inline constexpr void MappedFace<3, 2>::BasisFunctions(double alp, double bet, double* psi)
 {
 // Natural coordinates
-   double L[3];
+   double L[3] = {0.0};
 
-   L[0] = 1.0 - alp - oo_sqrtthr * bet;
-   L[1] = alp - oo_sqrtthr * bet;
-   L[2] = 2.0 * oo_sqrtthr * bet;
+   L[0] = 1.0 - alp - M_SQRT1_3 * bet;
+   L[1] = alp - M_SQRT1_3 * bet;
+   L[2] = 2.0 * M_SQRT1_3 * bet;
 
    psi[0] = L[0] * (2.0 * L[0] - 1.0);
    psi[1] = L[1] * (2.0 * L[1] - 1.0);
@@ -429,14 +429,14 @@ SPECTRUM_DEVICE_FUNC inline void MappedFace<3, 2>::BasisFunctions(double alp, do
 \param[out] psi All face basis function values
 */
 template <>
-SPECTRUM_DEVICE_FUNC inline void MappedFace<3, 3>::BasisFunctions(double alp, double bet, double* psi) const
+SPECTRUM_DEVICE_FUNC inline constexpr void MappedFace<3, 3>::BasisFunctions(double alp, double bet, double* psi)
 {
 // Natural coordinates
-   double L[3], tl1[3];
+   double L[3] = {0.0}, tl1[3] = {0.0};
 
-   L[0] = 1.0 - alp - oo_sqrtthr * bet;
-   L[1] = alp - oo_sqrtthr * bet;
-   L[2] = 2.0 * oo_sqrtthr * bet;
+   L[0] = 1.0 - alp - M_SQRT1_3 * bet;
+   L[1] = alp - M_SQRT1_3 * bet;
+   L[2] = 2.0 * M_SQRT1_3 * bet;
 
    tl1[0] = 3.0 * L[0] - 1.0;
    tl1[1] = 3.0 * L[1] - 1.0;
@@ -464,7 +464,7 @@ SPECTRUM_DEVICE_FUNC inline void MappedFace<3, 3>::BasisFunctions(double alp, do
 \param[out] psi All face basis function values
 */
 template <>
-SPECTRUM_DEVICE_FUNC inline void MappedFace<4, 1>::BasisFunctions(double alp, double bet, double* psi) const
+SPECTRUM_DEVICE_FUNC inline constexpr void MappedFace<4, 1>::BasisFunctions(double alp, double bet, double* psi)
 {
    double oma = 1.0 - alp;
    double omb = 1.0 - bet;
@@ -483,7 +483,7 @@ SPECTRUM_DEVICE_FUNC inline void MappedFace<4, 1>::BasisFunctions(double alp, do
 \param[out] psi All face basis function values
 */
 template <>
-SPECTRUM_DEVICE_FUNC inline void MappedFace<4, 2>::BasisFunctions(double alp, double bet, double* psi) const
+SPECTRUM_DEVICE_FUNC inline constexpr void MappedFace<4, 2>::BasisFunctions(double alp, double bet, double* psi)
 {
    double oma = 1.0 - alp;
    double omb = 1.0 - bet;
@@ -507,7 +507,7 @@ SPECTRUM_DEVICE_FUNC inline void MappedFace<4, 2>::BasisFunctions(double alp, do
 \param[out] psi All face basis function values
 */
 template <>
-SPECTRUM_DEVICE_FUNC inline void MappedFace<4, 3>::BasisFunctions(double alp, double bet, double* psi) const
+SPECTRUM_DEVICE_FUNC inline constexpr void MappedFace<4, 3>::BasisFunctions(double alp, double bet, double* psi)
 {
    double oma = 1.0 - alp;
    double omb = 1.0 - bet;
@@ -543,15 +543,15 @@ SPECTRUM_DEVICE_FUNC inline void MappedFace<4, 3>::BasisFunctions(double alp, do
 \param[out] dpdb All face basis function beta derivatives
 */
 template <>
-SPECTRUM_DEVICE_FUNC inline void MappedFace<3, 1>::BasisDerivatives(double alp, double bet, double* dpda, double* dpdb) const
+SPECTRUM_DEVICE_FUNC inline constexpr void MappedFace<3, 1>::BasisDerivatives(double alp, double bet, double* dpda, double* dpdb)
 {
    dpda[0] = -1.0;
    dpda[1] =  1.0;
    dpda[2] =  0.0;
 
-   dpdb[0] = -oo_sqrtthr;
-   dpdb[1] = -oo_sqrtthr;
-   dpdb[2] = 2.0 * oo_sqrtthr;
+   dpdb[0] = -M_SQRT1_3;
+   dpdb[1] = -M_SQRT1_3;
+   dpdb[2] = 2.0 * M_SQRT1_3;
 };
 
 /*!
@@ -563,14 +563,14 @@ SPECTRUM_DEVICE_FUNC inline void MappedFace<3, 1>::BasisDerivatives(double alp,
 \param[out] dpdb All face basis function beta derivatives
 */
 template <>
-SPECTRUM_DEVICE_FUNC inline void MappedFace<3, 2>::BasisDerivatives(double alp, double bet, double* dpda, double* dpdb) const
+SPECTRUM_DEVICE_FUNC inline constexpr void MappedFace<3, 2>::BasisDerivatives(double alp, double bet, double* dpda, double* dpdb)
 {
 // Natural coordinates
-   double L[3];
+   double L[3] = {0.0};
 
-   L[0] = 1.0 - alp - oo_sqrtthr * bet;
-   L[1] = alp - oo_sqrtthr * bet;
-   L[2] = 2.0 * oo_sqrtthr * bet;
+   L[0] = 1.0 - alp - M_SQRT1_3 * bet;
+   L[1] = alp - M_SQRT1_3 * bet;
+   L[2] = 2.0 * M_SQRT1_3 * bet;
 
    dpda[0] = -4.0 * L[0] + 1.0;
    dpda[1] =  4.0 * L[1] - 1.0;
@@ -579,12 +579,12 @@ SPECTRUM_DEVICE_FUNC inline void MappedFace<3, 2>::BasisDerivatives(double alp,
    dpda[4] =  4.0 * L[2];
    dpda[5] = -4.0 * L[2];
 
-   dpdb[0] =        oo_sqrtthr * dpda[0];
-   dpdb[1] =       -oo_sqrtthr * dpda[1];
-   dpdb[2] =  2.0 * oo_sqrtthr * (4.0 * L[2] - 1.0);
-   dpdb[3] = -4.0 * oo_sqrtthr * (L[0] + L[1]);
-   dpdb[4] =  4.0 * oo_sqrtthr * (2.0 * L[1] - L[2]);
-   dpdb[5] =  4.0 * oo_sqrtthr * (2.0 * L[0] - L[2]);
+   dpdb[0] =        M_SQRT1_3 * dpda[0];
+   dpdb[1] =       -M_SQRT1_3 * dpda[1];
+   dpdb[2] =  2.0 * M_SQRT1_3 * (4.0 * L[2] - 1.0);
+   dpdb[3] = -4.0 * M_SQRT1_3 * (L[0] + L[1]);
+   dpdb[4] =  4.0 * M_SQRT1_3 * (2.0 * L[1] - L[2]);
+   dpdb[5] =  4.0 * M_SQRT1_3 * (2.0 * L[0] - L[2]);
 };
 
 /*!
@@ -596,14 +596,14 @@ SPECTRUM_DEVICE_FUNC inline void MappedFace<3, 2>::BasisDerivatives(double alp,
 \param[out] dpdb All face basis function beta derivatives
 */
 template <>
-SPECTRUM_DEVICE_FUNC inline void MappedFace<3, 3>::BasisDerivatives(double alp, double bet, double* dpda, double* dpdb) const
+SPECTRUM_DEVICE_FUNC inline constexpr void MappedFace<3, 3>::BasisDerivatives(double alp, double bet, double* dpda, double* dpdb)
 {
 // Natural coordinates
-   double L[3], tl1[3], sl1[3];
+   double L[3] = {0.0}, tl1[3] = {0.0}, sl1[3] = {0.0};
 
-   L[0] = 1.0 - alp - oo_sqrtthr * bet;
-   L[1] = alp - oo_sqrtthr * bet;
-   L[2] = 2.0 * oo_sqrtthr * bet;
+   L[0] = 1.0 - alp - M_SQRT1_3 * bet;
+   L[1] = alp - M_SQRT1_3 * bet;
+   L[2] = 2.0 * M_SQRT1_3 * bet;
 
    tl1[0] = 3.0 * L[0] - 1.0;
    tl1[1] = 3.0 * L[1] - 1.0;
@@ -624,16 +624,16 @@ SPECTRUM_DEVICE_FUNC inline void MappedFace<3, 3>::BasisDerivatives(double alp,
    dpda[8] = -4.5 * L[2] * sl1[0];
    dpda[9] = 27.0 * L[2] * (L[0] - L[1]);
 
-   dpdb[0] =        oo_sqrtthr * dpda[0];
-   dpdb[1] =       -oo_sqrtthr * dpda[1];
-   dpdb[2] =  2.0 * oo_sqrtthr * (9.0 * L[2] * (1.5 * L[2] - 1.0) + 1.0);
-   dpdb[3] = -4.5 * oo_sqrtthr * (L[0] * tl1[0] + L[1] * sl1[0]);
-   dpdb[4] = -4.5 * oo_sqrtthr * (L[1] * tl1[1] + L[0] * sl1[1]);
-   dpdb[5] =  4.5 * oo_sqrtthr * (2.0 * L[1] * tl1[1] - L[2] * sl1[1]);
-   dpdb[6] = -4.5 * oo_sqrtthr * (L[2] * tl1[2] - 2.0 * L[1] * sl1[2]);
-   dpdb[7] = -4.5 * oo_sqrtthr * (L[2] * tl1[2] - 2.0 * L[0] * sl1[2]);   
-   dpdb[8] =  4.5 * oo_sqrtthr * (2.0 * L[0] * tl1[0] - L[2] * sl1[0]);
-   dpdb[9] = 27.0 * oo_sqrtthr * (2.0 * L[0] * L[1] - L[2] * (L[0] + L[1]));
+   dpdb[0] =        M_SQRT1_3 * dpda[0];
+   dpdb[1] =       -M_SQRT1_3 * dpda[1];
+   dpdb[2] =  2.0 * M_SQRT1_3 * (9.0 * L[2] * (1.5 * L[2] - 1.0) + 1.0);
+   dpdb[3] = -4.5 * M_SQRT1_3 * (L[0] * tl1[0] + L[1] * sl1[0]);
+   dpdb[4] = -4.5 * M_SQRT1_3 * (L[1] * tl1[1] + L[0] * sl1[1]);
+   dpdb[5] =  4.5 * M_SQRT1_3 * (2.0 * L[1] * tl1[1] - L[2] * sl1[1]);
+   dpdb[6] = -4.5 * M_SQRT1_3 * (L[2] * tl1[2] - 2.0 * L[1] * sl1[2]);
+   dpdb[7] = -4.5 * M_SQRT1_3 * (L[2] * tl1[2] - 2.0 * L[0] * sl1[2]);   
+   dpdb[8] =  4.5 * M_SQRT1_3 * (2.0 * L[0] * tl1[0] - L[2] * sl1[0]);
+   dpdb[9] = 27.0 * M_SQRT1_3 * (2.0 * L[0] * L[1] - L[2] * (L[0] + L[1]));
 };
 
 /*!
@@ -645,7 +645,7 @@ SPECTRUM_DEVICE_FUNC inline void MappedFace<3, 3>::BasisDerivatives(double alp,
 \param[out] dpdb All face basis function beta derivatives
 */
 template <>
-SPECTRUM_DEVICE_FUNC inline void MappedFace<4, 1>::BasisDerivatives(double alp, double bet, double* dpda, double* dpdb) const
+SPECTRUM_DEVICE_FUNC inline constexpr void MappedFace<4, 1>::BasisDerivatives(double alp, double bet, double* dpda, double* dpdb)
 {
    double oma = 1.0 - alp;
    double omb = 1.0 - bet;
@@ -670,7 +670,7 @@ SPECTRUM_DEVICE_FUNC inline void MappedFace<4, 1>::BasisDerivatives(double alp,
 \param[out] dpdb All face basis function beta derivatives
 */
 template <>
-SPECTRUM_DEVICE_FUNC inline void MappedFace<4, 2>::BasisDerivatives(double alp, double bet, double* dpda, double* dpdb) const
+SPECTRUM_DEVICE_FUNC inline constexpr void MappedFace<4, 2>::BasisDerivatives(double alp, double bet, double* dpda, double* dpdb)
 {
    double oma = 1.0 - alp;
    double omb = 1.0 - bet;
@@ -703,7 +703,7 @@ SPECTRUM_DEVICE_FUNC inline void MappedFace<4, 2>::BasisDerivatives(double alp,
 \param[out] dpdb All face basis function beta derivatives
 */
 template <>
-SPECTRUM_DEVICE_FUNC inline void MappedFace<4, 3>::BasisDerivatives(double alp, double bet, double* dpda, double* dpdb) const
+SPECTRUM_DEVICE_FUNC inline constexpr void MappedFace<4, 3>::BasisDerivatives(double alp, double bet, double* dpda, double* dpdb)
 {
    double oma = 1.0 - alp;
    double omb = 1.0 - bet;
@@ -0,0 +1,493 @@
+/*!
+\file mapped_geometry_cache.hh
+\brief Precomputed quadrature geometry for sets of mapped edges and faces
+\author Swati Sharma
+
+This file is part of the SPECTRUM suite of scientific numerical simulation codes. SPECTRUM stands for Space Plasma and Energetic Charged particle TRansport on Unstructured Meshes. The code simulates plasma or neutral particle flows using MHD equations on a grid, transport of cosmic rays using stochastic or grid based methods. The "unstructured" part refers to the use of a geodesic mesh providing a uniform coverage of the surface of a sphere.
+*/
+
+#ifndef SPECTRUM_MAPPED_GEOMETRY_CACHE
+#define SPECTRUM_MAPPED_GEOMETRY_CACHE
+
+#include <cstring>
+#include "geometry/mapped_face.hh"
+#include "geometry/quadrature.hh"
+
+namespace Spectrum {
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// Reference element tables
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\brief Basis functions and their derivatives at the quadrature points of the reference edge
+\author Swati Sharma
+
+The table depends only on the template parameters, so every instance is a compile time constant.
+*/
+template <int order, int qorder>
+struct EdgeQuadratureTable
+{
+//! Number of anchors
+   static constexpr int n_anchors = n_edge_anchors[order - 1];
+
+//! Number of quadrature points
+   static constexpr int n_qpoints = n_qpoints_lin[qorder - 1];
+
+//! Quadrature weights
+   double weight[n_qpoints] = {0.0};
+
+//! Basis functions, [qpoint][anchor]
+   double psi[n_qpoints][n_anchors] = {{0.0}};
+
+//! Basis function derivatives, [qpoint][anchor]
+   double dpdd[n_qpoints][n_anchors] = {{0.0}};
+
+//! Default constructor
+   constexpr EdgeQuadratureTable(void);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+template <int order, int qorder>
+constexpr EdgeQuadratureTable<order, qorder>::EdgeQuadratureTable(void)
+{
+   for(auto qpt = 0; qpt < n_qpoints; qpt++) {
+      weight[qpt] = qpoints_lin[qorder - 1][1][qpt];
+      MappedEdge<order>::BasisFunctions(qpoints_lin[qorder - 1][0][qpt], psi[qpt]);
+      MappedEdge<order>::BasisDerivatives(qpoints_lin[qorder - 1][0][qpt], dpdd[qpt]);
+   };
+};
+
+/*!
+\brief Basis functions and their derivatives at the quadrature points of the reference face
+\author Swati Sharma
+
+The table depends only on the template parameters, so every instance is a compile time constant.
+*/
+template <int n_verts, int order, int qorder>
+struct FaceQuadratureTable
+{
+//! Number of anchors
+   static constexpr int n_anchors = n_face_anchors[n_verts - 3][order - 1];
+
+//! Number of quadrature points
+   static constexpr int n_qpoints = (n_verts == 3 ? n_qpoints_tri[qorder - 1] : n_qpoints_rec[qorder - 1]);
+
+//! Quadrature weights
+   double weight[n_qpoints] = {0.0};
+
+//! Basis functions, [qpoint][anchor]
+   double psi[n_qpoints][n_anchors] = {{0.0}};
+
+//! Basis function derivatives in the first coordinate, [qpoint][anchor]
+   double dpda[n_qpoints][n_anchors] = {{0.0}};
+
+//! Basis function derivatives in the second coordinate, [qpoint][anchor]
+   double dpdb[n_qpoints][n_anchors] = {{0.0}};
+
+//! Default constructor
+   constexpr FaceQuadratureTable(void);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+template <int n_verts, int order, int qorder>
+constexpr FaceQuadratureTable<n_verts, order, qorder>::FaceQuadratureTable(void)
+{
+   const double* const* qpoints = (n_verts == 3 ? qpoints_tri[qorder - 1] : qpoints_rec[qorder - 1]);
+
+   for(auto qpt = 0; qpt < n_qpoints; qpt++) {
+      weight[qpt] = qpoints[2][qpt];
+      MappedFace<n_verts, order>::BasisFunctions(qpoints[0][qpt], qpoints[1][qpt], psi[qpt]);
+      MappedFace<n_verts, order>::BasisDerivatives(qpoints[0][qpt], qpoints[1][qpt], dpda[qpt], dpdb[qpt]);
+   };
+};
+
+//! Reference edge table for each (order, qorder) instantiation
+template <int order, int qorder>
+inline constexpr EdgeQuadratureTable<order, qorder> edge_quadrature_table{};
+
+//! Reference face table for each (n_verts, order, qorder) instantiation
+template <int n_verts, int order, int qorder>
+inline constexpr FaceQuadratureTable<n_verts, order, qorder> face_quadrature_table{};
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// MappedEdgeCache class
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\brief Quadrature points, weights, and directions for a set of mapped edges
+\author Swati Sharma
+
+The mapping is evaluated once for every edge when the cache is built. All arrays are indexed as [edge][qpoint], so integrating over an edge reads a short contiguous run of values. The weights already include the Jacobian (the physical arc length element).
+*/
+template <int order, int qorder = order + 1>
+class MappedEdgeCache
+{
+public:
+
+//! Reference table
+   using table_type = EdgeQuadratureTable<order, qorder>;
+
+//! Number of quadrature points per edge
+   static constexpr int n_qpoints = table_type::n_qpoints;
+
+protected:
+
+//! Number of edges
+   int n_edges = 0;
+
+//! Positions of the quadrature points
+   GeoVector* qpoint = nullptr;
+
+//! Quadrature weights multiplied by the Jacobian
+   double* wjac = nullptr;
+
+//! Unit tangent vectors at the quadrature points
+   GeoVector* tangent = nullptr;
+
+//! Unit normal vectors (tangent cross position) at the quadrature points, lying in the surface through the edge and the origin
+   GeoVector* normal = nullptr;
+
+public:
+
+//! Default constructor
+   MappedEdgeCache(void) = default;
+
+//! Constructor with arguments
+   MappedEdgeCache(int n_edges_in, const GeoVector* anchors);
+
+//! Copy constructor - deleted because the class owns memory
+   MappedEdgeCache(const MappedEdgeCache& other) = delete;
+
+//! Destructor
+   ~MappedEdgeCache();
+
+//! Compute the geometry for all edges
+   void Build(int n_edges_in, const GeoVector* anchors);
+
+//! Free all dynamically allocated memory
+   void FreeStorage(void);
+
+//! Return the number of edges
+   int Size(void) const {return n_edges;};
+
+//! Return the quadrature point positions for one edge
+   SPECTRUM_DEVICE_FUNC const GeoVector* QPoints(int edge) const {return qpoint + edge * n_qpoints;};
+
+//! Return the weights times the Jacobian for one edge
+   SPECTRUM_DEVICE_FUNC const double* WJac(int edge) const {return wjac + edge * n_qpoints;};
+
+//! Return the unit tangents for one edge
+   SPECTRUM_DEVICE_FUNC const GeoVector* Tangents(int edge) const {return tangent + edge * n_qpoints;};
+
+//! Return the unit normals for one edge
+   SPECTRUM_DEVICE_FUNC const GeoVector* Normals(int edge) const {return normal + edge * n_qpoints;};
+
+//! Integrate a scalar sampled at the quadrature points
+   SPECTRUM_DEVICE_FUNC double Integrate(int edge, const double* values) const;
+
+//! Integrate the normal component of a vector sampled at the quadrature points
+   SPECTRUM_DEVICE_FUNC double IntegrateNormal(int edge, const GeoVector* values) const;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] n_edges_in Number of edges
+\param[in] anchors    Anchors of all edges, [edge][anchor]
+*/
+template <int order, int qorder>
+inline MappedEdgeCache<order, qorder>::MappedEdgeCache(int n_edges_in, const GeoVector* anchors)
+{
+   Build(n_edges_in, anchors);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+template <int order, int qorder>
+inline MappedEdgeCache<order, qorder>::~MappedEdgeCache()
+{
+   FreeStorage();
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+template <int order, int qorder>
+inline void MappedEdgeCache<order, qorder>::FreeStorage(void)
+{
+   delete[] qpoint;
+   delete[] wjac;
+   delete[] tangent;
+   delete[] normal;
+   qpoint = tangent = normal = nullptr;
+   wjac = nullptr;
+   n_edges = 0;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] n_edges_in Number of edges
+\param[in] anchors    Anchors of all edges, [edge][anchor]
+*/
+template <int order, int qorder>
+inline void MappedEdgeCache<order, qorder>::Build(int n_edges_in, const GeoVector* anchors)
+{
+   constexpr const table_type& table = edge_quadrature_table<order, qorder>;
+
+   FreeStorage();
+   n_edges = n_edges_in;
+   qpoint = new GeoVector[n_edges * n_qpoints];
+   wjac = new double[n_edges * n_qpoints];
+   tangent = new GeoVector[n_edges * n_qpoints];
+   normal = new GeoVector[n_edges * n_qpoints];
+
+   for(auto edge = 0; edge < n_edges; edge++) {
+      const GeoVector* anc = anchors + edge * table_type::n_anchors;
+      for(auto qpt = 0; qpt < n_qpoints; qpt++) {
+         int idx = edge * n_qpoints + qpt;
+         GeoVector pos = gv_zeros, tan = gv_zeros;
+         for(auto apt = 0; apt < table_type::n_anchors; apt++) {
+            pos += table.psi[qpt][apt] * anc[apt];
+            tan += table.dpdd[qpt][apt] * anc[apt];
+         };
+
+         double length;
+         qpoint[idx] = pos;
+         tan.Normalize(length);
+         tangent[idx] = tan;
+         wjac[idx] = table.weight[qpt] * length;
+         normal[idx] = UnitVec(tan ^ pos);
+      };
+   };
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] edge   Edge index
+\param[in] values Function values at the quadrature points of the edge
+\return Line integral over the edge
+*/
+template <int order, int qorder>
+SPECTRUM_DEVICE_FUNC inline double MappedEdgeCache<order, qorder>::Integrate(int edge, const double* values) const
+{
+   const double* w = WJac(edge);
+   double sum = 0.0;
+   for(auto qpt = 0; qpt < n_qpoints; qpt++) sum += w[qpt] * values[qpt];
+   return sum;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] edge   Edge index
+\param[in] values Vector values at the quadrature points of the edge
+\return Line integral of the normal component over the edge
+*/
+template <int order, int qorder>
+SPECTRUM_DEVICE_FUNC inline double MappedEdgeCache<order, qorder>::IntegrateNormal(int edge, const GeoVector* values) const
+{
+   const double* w = WJac(edge);
+   const GeoVector* n = Normals(edge);
+   double sum = 0.0;
+   for(auto qpt = 0; qpt < n_qpoints; qpt++) sum += w[qpt] * (n[qpt] * values[qpt]);
+   return sum;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// MappedFaceCache class
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\brief Quadrature points, weights, and normals for a set of mapped faces
+\author Swati Sharma
+
+The mapping is evaluated once for every face when the cache is built. All arrays are indexed as [face][qpoint], so integrating over a face reads a short contiguous run of values. The weights already include the Jacobian (the physical area element), and the normals are the unit vectors in the direction of "MappedFace::Normal()".
+*/
+template <int n_verts, int order, int qorder = order + 1>
+class MappedFaceCache
+{
+public:
+
+//! Reference table
+   using table_type = FaceQuadratureTable<n_verts, order, qorder>;
+
+//! Number of quadrature points per face
+   static constexpr int n_qpoints = table_type::n_qpoints;
+
+protected:
+
+//! Number of faces
+   int n_faces = 0;
+
+//! Positions of the quadrature points
+   GeoVector* qpoint = nullptr;
+
+//! Quadrature weights multiplied by the Jacobian
+   double* wjac = nullptr;
+
+//! Unit normal vectors at the quadrature points
+   GeoVector* normal = nullptr;
+
+public:
+
+//! Default constructor
+   MappedFaceCache(void) = default;
+
+//! Constructor with arguments
+   MappedFaceCache(int n_faces_in, const GeoVector* anchors);
+
+//! Copy constructor - deleted because the class owns memory
+   MappedFaceCache(const MappedFaceCache& other) = delete;
+
+//! Destructor
+   ~MappedFaceCache();
+
+//! Compute the geometry for all faces
+   void Build(int n_faces_in, const GeoVector* anchors);
+
+//! Free all dynamically allocated memory
+   void FreeStorage(void);
+
+//! Return the number of faces
+   int Size(void) const {return n_faces;};
+
+//! Return the quadrature point positions for one face
+   SPECTRUM_DEVICE_FUNC const GeoVector* QPoints(int face) const {return qpoint + face * n_qpoints;};
+
+//! Return the weights times the Jacobian for one face
+   SPECTRUM_DEVICE_FUNC const double* WJac(int face) const {return wjac + face * n_qpoints;};
+
+//! Return the unit normals for one face
+   SPECTRUM_DEVICE_FUNC const GeoVector* Normals(int face) const {return normal + face * n_qpoints;};
+
+//! Integrate a scalar sampled at the quadrature points
+   SPECTRUM_DEVICE_FUNC double Integrate(int face, const double* values) const;
+
+//! Integrate the normal component of a vector sampled at the quadrature points
+   SPECTRUM_DEVICE_FUNC double IntegrateNormal(int face, const GeoVector* values) const;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] n_faces_in Number of faces
+\param[in] anchors    Anchors of all faces, [face][anchor]
+*/
+template <int n_verts, int order, int qorder>
+inline MappedFaceCache<n_verts, order, qorder>::MappedFaceCache(int n_faces_in, const GeoVector* anchors)
+{
+   Build(n_faces_in, anchors);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+template <int n_verts, int order, int qorder>
+inline MappedFaceCache<n_verts, order, qorder>::~MappedFaceCache()
+{
+   FreeStorage();
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+template <int n_verts, int order, int qorder>
+inline void MappedFaceCache<n_verts, order, qorder>::FreeStorage(void)
+{
+   delete[] qpoint;
+   delete[] wjac;
+   delete[] normal;
+   qpoint = normal = nullptr;
+   wjac = nullptr;
+   n_faces = 0;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] n_faces_in Number of faces
+\param[in] anchors    Anchors of all faces, [face][anchor]
+*/
+template <int n_verts, int order, int qorder>
+inline void MappedFaceCache<n_verts, order, qorder>::Build(int n_faces_in, const GeoVector* anchors)
+{
+   constexpr const table_type& table = face_quadrature_table<n_verts, order, qorder>;
+
+   FreeStorage();
+   n_faces = n_faces_in;
+   qpoint = new GeoVector[n_faces * n_qpoints];
+   wjac = new double[n_faces * n_qpoints];
+   normal = new GeoVector[n_faces * n_qpoints];
+
+   for(auto face = 0; face < n_faces; face++) {
+      const GeoVector* anc = anchors + face * table_type::n_anchors;
+      for(auto qpt = 0; qpt < n_qpoints; qpt++) {
+         int idx = face * n_qpoints + qpt;
+         GeoVector pos = gv_zeros, tana = gv_zeros, tanb = gv_zeros;
+         for(auto apt = 0; apt < table_type::n_anchors; apt++) {
+            pos += table.psi[qpt][apt] * anc[apt];
+            tana += table.dpda[qpt][apt] * anc[apt];
+            tanb += table.dpdb[qpt][apt] * anc[apt];
+         };
+
+// The reference element area is part of the Jacobian, as in "MappedFace::Normal()"
+         double area;
+         GeoVector nrm = ref_face_area[n_verts - 3] * (tana ^ tanb);
+         qpoint[idx] = pos;
+         nrm.Normalize(area);
+         normal[idx] = nrm;
+         wjac[idx] = table.weight[qpt] * area;
+      };
+   };
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] face   Face index
+\param[in] values Function values at the quadrature points of the face
+\return Surface integral over the face
+*/
+template <int n_verts, int order, int qorder>
+SPECTRUM_DEVICE_FUNC inline double MappedFaceCache<n_verts, order, qorder>::Integrate(int face, const double* values) const
+{
+   const double* w = WJac(face);
+   double sum = 0.0;
+   for(auto qpt = 0; qpt < n_qpoints; qpt++) sum += w[qpt] * values[qpt];
+   return sum;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] face   Face index
+\param[in] values Vector values at the quadrature points of the face
+\return Flux of the vector through the face
+*/
+template <int n_verts, int order, int qorder>
+SPECTRUM_DEVICE_FUNC inline double MappedFaceCache<n_verts, order, qorder>::IntegrateNormal(int face, const GeoVector* values) const
+{
+   const double* w = WJac(face);
+   const GeoVector* n = Normals(face);
+   double sum = 0.0;
+   for(auto qpt = 0; qpt < n_qpoints; qpt++) sum += w[qpt] * (n[qpt] * values[qpt]);
+   return sum;
+};
+
+};
+
+#endif
@@ -30,28 +30,28 @@ namespace Spectrum {
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 
 //! Gauss-Legendre quadrature displacement, 1 point (exact to \f$x^1\f$)
-const double qdispl_glg_1[1] = {0.0};
+constexpr double qdispl_glg_1[1] = {0.0};
 
 //! Gauss-Legendre quadrature weight, 1 point
-const double weight_glg_1[1] = {1.0};
+constexpr double weight_glg_1[1] = {1.0};
 
 //! Gauss-Legendre quadrature displacements, 2 points (exact to \f$x^3\f$)
-const double qdispl_glg_2[2] = {-sqrtthr / 6.0, sqrtthr / 6.0};
+constexpr double qdispl_glg_2[2] = {-M_SQRT3 / 6.0, M_SQRT3 / 6.0};
 
 //! Gauss-Legendre quadrature weights, 2 points
-const double weight_glg_2[2] = {1.0 / 2.0, 1.0 / 2.0};
+constexpr double weight_glg_2[2] = {1.0 / 2.0, 1.0 / 2.0};
 
 //! Gauss-Legendre quadrature displacements, 3 points (exact to \f$x^5\f$)
-const double qdispl_glg_3[3] = {-sqrtthr * sqrtfiv / 10.0, 0.0, sqrtthr * sqrtfiv / 10.0};
+constexpr double qdispl_glg_3[3] = {-M_SQRT3 * M_SQRT5 / 10.0, 0.0, M_SQRT3 * M_SQRT5 / 10.0};
 
 //! Gauss-Legendre quadrature weights, 3 points
-const double weight_glg_3[3] = {5.0 / 18.0, 8.0 / 18.0, 5.0 / 18.0};
+constexpr double weight_glg_3[3] = {5.0 / 18.0, 8.0 / 18.0, 5.0 / 18.0};
 
 //! Gauss-Legendre quadrature displacements
-const double* const qdispl_gauss_legendre[MAX_QPOINTS_GLG] = {qdispl_glg_1, qdispl_glg_2, qdispl_glg_3};
+constexpr const double* qdispl_gauss_legendre[MAX_QPOINTS_GLG] = {qdispl_glg_1, qdispl_glg_2, qdispl_glg_3};
                                                              
 //! Gauss-Legendre quadrature weights
-const double* const weight_gauss_legendre[MAX_QPOINTS_GLG] = {weight_glg_1, weight_glg_2, weight_glg_3};
+constexpr const double* weight_gauss_legendre[MAX_QPOINTS_GLG] = {weight_glg_1, weight_glg_2, weight_glg_3};
 
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 // Quadrature points on a unit interval
@@ -61,41 +61,41 @@ const double* const weight_gauss_legendre[MAX_QPOINTS_GLG] = {weight_glg_1, weig
 //                 ------------0------------
 
 //! Reference coordinates for 1st order rule on a line
-const double qpoints_lin_1order_coordx[1] = {0.5 + qdispl_glg_1[0]};
+constexpr double qpoints_lin_1order_coordx[1] = {0.5 + qdispl_glg_1[0]};
 
 //! Weights for 1st order rule on a line
-const double qpoints_lin_1order_weight[1] = {weight_glg_1[0]};
+constexpr double qpoints_lin_1order_weight[1] = {weight_glg_1[0]};
 
 // Integrates 3rd order polynomial exactly
 //                 ------0-----------1------
 
 //! Reference coordinates for 2nd/3rd order rule on a line
-const double qpoints_lin_3order_coordx[2] = {0.5 + qdispl_glg_2[0], 0.5 + qdispl_glg_2[1]};
+constexpr double qpoints_lin_3order_coordx[2] = {0.5 + qdispl_glg_2[0], 0.5 + qdispl_glg_2[1]};
 
 //! Weights for 2nd/3rd order rule on a line
-const double qpoints_lin_3order_weight[2] = {weight_glg_2[0], weight_glg_2[1]};
+constexpr double qpoints_lin_3order_weight[2] = {weight_glg_2[0], weight_glg_2[1]};
 
 // Integrates 5th order polynomial exactly
 //                 ---0--------1--------2---
 
 //! Reference coordinates for 4th/5th order rule on a line
-const double qpoints_lin_5order_coordx[3] = {0.5 + qdispl_glg_3[0], 0.5 + qdispl_glg_3[1], 0.5 + qdispl_glg_3[2]};
+constexpr double qpoints_lin_5order_coordx[3] = {0.5 + qdispl_glg_3[0], 0.5 + qdispl_glg_3[1], 0.5 + qdispl_glg_3[2]};
 
 //! Weights for 4th/5th order rule on a line
-const double qpoints_lin_5order_weight[3] = {weight_glg_3[0], weight_glg_3[1], weight_glg_3[2]};
+constexpr double qpoints_lin_5order_weight[3] = {weight_glg_3[0], weight_glg_3[1], weight_glg_3[2]};
 
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 
-const double* qpoints_lin_1order[2] = {qpoints_lin_1order_coordx, qpoints_lin_1order_weight};
-const double* qpoints_lin_2order[2] = {qpoints_lin_3order_coordx, qpoints_lin_3order_weight};
-const double* qpoints_lin_3order[2] = {qpoints_lin_3order_coordx, qpoints_lin_3order_weight};
-const double* qpoints_lin_4order[2] = {qpoints_lin_5order_coordx, qpoints_lin_5order_weight};
+constexpr const double* qpoints_lin_1order[2] = {qpoints_lin_1order_coordx, qpoints_lin_1order_weight};
+constexpr const double* qpoints_lin_2order[2] = {qpoints_lin_3order_coordx, qpoints_lin_3order_weight};
+constexpr const double* qpoints_lin_3order[2] = {qpoints_lin_3order_coordx, qpoints_lin_3order_weight};
+constexpr const double* qpoints_lin_4order[2] = {qpoints_lin_5order_coordx, qpoints_lin_5order_weight};
 
 //! Number of line quadrature points
-const int n_qpoints_lin[MAX_QORDER] = {1, 2, 2, 3};
+constexpr int n_qpoints_lin[MAX_QORDER] = {1, 2, 2, 3};
 
 //! All properties of line quadrature points
-const double* const* qpoints_lin[MAX_QORDER] = {qpoints_lin_1order, qpoints_lin_2order, qpoints_lin_3order, qpoints_lin_4order};
+constexpr const double* const* qpoints_lin[MAX_QORDER] = {qpoints_lin_1order, qpoints_lin_2order, qpoints_lin_3order, qpoints_lin_4order};
 
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 // Quadrature points on an equilateral unit triangle
@@ -118,13 +118,13 @@ const double* const* qpoints_lin[MAX_QORDER] = {qpoints_lin_1order, qpoints_lin_
 //                 -------------------------
 
 //! First reference coordinate for 1st order rule on a triangle
-const double qpoints_tri_1order_coordx[] = {1.0 / 2.0};
+constexpr double qpoints_tri_1order_coordx[] = {1.0 / 2.0};
 
 //! Second reference coordinate for 1st order rule on a triangle
-const double qpoints_tri_1order_coordy[] = {1.0 / (2.0 * sqrtthr)};
+constexpr double qpoints_tri_1order_coordy[] = {1.0 / (2.0 * M_SQRT3)};
 
 //! Weights for 1st order rule on a triangle
-const double qpoints_tri_1order_weight[] = {1.0};
+constexpr double qpoints_tri_1order_weight[] = {1.0};
 
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -144,13 +144,13 @@ const double qpoints_tri_1order_weight[] = {1.0};
 //                 -------------------------
 
 //! First reference coordinate for 2nd order rule on a triangle
-const double qpoints_tri_2order_coordx[] = {1.0 / 4.0, 3.0 / 4.0, 2.0 / 4.0};
+constexpr double qpoints_tri_2order_coordx[] = {1.0 / 4.0, 3.0 / 4.0, 2.0 / 4.0};
 
 //! Second reference coordinate for 2nd order rule on a triangle
-const double qpoints_tri_2order_coordy[] = {1.0 / (4.0 * sqrtthr), 1.0 / (4.0 * sqrtthr), 1.0 / (1.0 * sqrtthr)};
+constexpr double qpoints_tri_2order_coordy[] = {1.0 / (4.0 * M_SQRT3), 1.0 / (4.0 * M_SQRT3), 1.0 / (1.0 * M_SQRT3)};
 
 //! Weights for 2nd order rule on a triangle
-const double qpoints_tri_2order_weight[] = {1.0 / 3.0, 1.0 / 3.0, 1.0 / 3.0};
+constexpr double qpoints_tri_2order_weight[] = {1.0 / 3.0, 1.0 / 3.0, 1.0 / 3.0};
 
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -170,13 +170,13 @@ const double qpoints_tri_2order_weight[] = {1.0 / 3.0, 1.0 / 3.0, 1.0 / 3.0};
 //                 -------------------------
 
 //! First reference coordinate for 3rd order rule on a triangle
-const double qpoints_tri_3order_coordx[] = { 5.0 / 10.0, 3.0 / 10.0, 7.0 / 10.0, 5.0 / 10.0};
+constexpr double qpoints_tri_3order_coordx[] = { 5.0 / 10.0, 3.0 / 10.0, 7.0 / 10.0, 5.0 / 10.0};
 
 //! Second reference coordinate for 2nd order rule on a triangle
-const double qpoints_tri_3order_coordy[] = { 5.0 / (10.0 * sqrtthr), 3.0 / (10.0 * sqrtthr), 3.0 / (10.0 * sqrtthr), 9.0 / (10.0 * sqrtthr)};
+constexpr double qpoints_tri_3order_coordy[] = { 5.0 / (10.0 * M_SQRT3), 3.0 / (10.0 * M_SQRT3), 3.0 / (10.0 * M_SQRT3), 9.0 / (10.0 * M_SQRT3)};
 
 //! Weights for 2nd order rule on a triangle
-const double qpoints_tri_3order_weight[] = {-27.0 / 48.0, 25.0 / 48.0, 25.0 / 48.0, 25.0 / 48.0};
+constexpr double qpoints_tri_3order_weight[] = {-27.0 / 48.0, 25.0 / 48.0, 25.0 / 48.0, 25.0 / 48.0};
 
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -195,42 +195,45 @@ const double qpoints_tri_3order_weight[] = {-27.0 / 48.0, 25.0 / 48.0, 25.0 / 48
 //                  /  0               1  \
 //                 -------------------------
 
+//! The irrational factor \f$\sqrt{95-22\sqrt{10}}\f$ in the 4th order rule, written as a literal so that the tables are constant expressions
+constexpr double sqrt_dunavant_4 = 5.0428059130106968;
+
 //! First reference coordinate for 4th order rule on a triangle
-const double qpoints_tri_4order_coordx[] = {(8.0 - sqrtten) / 12.0 - sqrtten * sqrt(95.0 - 22.0 * sqrtten) / 60.0,
-                                            (4.0 + sqrtten) / 12.0 + sqrtten * sqrt(95.0 - 22.0 * sqrtten) / 60.0,
+constexpr double qpoints_tri_4order_coordx[] = {(8.0 - M_SQRT10) / 12.0 - M_SQRT10 * sqrt_dunavant_4 / 60.0,
+                                            (4.0 + M_SQRT10) / 12.0 + M_SQRT10 * sqrt_dunavant_4 / 60.0,
                                             1.0 / 2.0,
                                             1.0 / 2.0,
-                                            (8.0 - sqrtten) / 12.0 + sqrtten * sqrt(95.0 - 22.0 * sqrtten) / 60.0,
-                                            (4.0 + sqrtten) / 12.0 - sqrtten * sqrt(95.0 - 22.0 * sqrtten) / 60.0};
+                                            (8.0 - M_SQRT10) / 12.0 + M_SQRT10 * sqrt_dunavant_4 / 60.0,
+                                            (4.0 + M_SQRT10) / 12.0 - M_SQRT10 * sqrt_dunavant_4 / 60.0};
 
 //! Second reference coordinate for 3rd/4th order rule on a triangle
-const double qpoints_tri_4order_coordy[] = {(8.0 - sqrtten) / (12.0 * sqrtthr) - sqrtten * sqrt(95.0 - 22.0 * sqrtten) / (60.0 * sqrtthr),
-                                            (8.0 - sqrtten) / (12.0 * sqrtthr) - sqrtten * sqrt(95.0 - 22.0 * sqrtten) / (60.0 * sqrtthr),
-                                            (1.0 + sqrtten) / ( 6.0 * sqrtthr) + sqrtten * sqrt(95.0 - 22.0 * sqrtten) / (30.0 * sqrtthr),
-                                            (1.0 + sqrtten) / ( 6.0 * sqrtthr) - sqrtten * sqrt(95.0 - 22.0 * sqrtten) / (30.0 * sqrtthr),
-                                            (8.0 - sqrtten) / (12.0 * sqrtthr) + sqrtten * sqrt(95.0 - 22.0 * sqrtten) / (60.0 * sqrtthr),
-                                            (8.0 - sqrtten) / (12.0 * sqrtthr) + sqrtten * sqrt(95.0 - 22.0 * sqrtten) / (60.0 * sqrtthr)};
+constexpr double qpoints_tri_4order_coordy[] = {(8.0 - M_SQRT10) / (12.0 * M_SQRT3) - M_SQRT10 * sqrt_dunavant_4 / (60.0 * M_SQRT3),
+                                            (8.0 - M_SQRT10) / (12.0 * M_SQRT3) - M_SQRT10 * sqrt_dunavant_4 / (60.0 * M_SQRT3),
+                                            (1.0 + M_SQRT10) / ( 6.0 * M_SQRT3) + M_SQRT10 * sqrt_dunavant_4 / (30.0 * M_SQRT3),
+                                            (1.0 + M_SQRT10) / ( 6.0 * M_SQRT3) - M_SQRT10 * sqrt_dunavant_4 / (30.0 * M_SQRT3),
+                                            (8.0 - M_SQRT10) / (12.0 * M_SQRT3) + M_SQRT10 * sqrt_dunavant_4 / (60.0 * M_SQRT3),
+                                            (8.0 - M_SQRT10) / (12.0 * M_SQRT3) + M_SQRT10 * sqrt_dunavant_4 / (60.0 * M_SQRT3)};
 
 //! Weights for 3rd/4th order rule on a triangle
-const double qpoints_tri_4order_weight[] = {1.0 / 6.0 - (45.0 - sqrtten) * sqrt(95.0 - 22.0 * sqrtten) / 3720.0,
-                                            1.0 / 6.0 - (45.0 - sqrtten) * sqrt(95.0 - 22.0 * sqrtten) / 3720.0,
-                                            1.0 / 6.0 - (45.0 - sqrtten) * sqrt(95.0 - 22.0 * sqrtten) / 3720.0,
-                                            1.0 / 6.0 + (45.0 - sqrtten) * sqrt(95.0 - 22.0 * sqrtten) / 3720.0,
-                                            1.0 / 6.0 + (45.0 - sqrtten) * sqrt(95.0 - 22.0 * sqrtten) / 3720.0,
-                                            1.0 / 6.0 + (45.0 - sqrtten) * sqrt(95.0 - 22.0 * sqrtten) / 3720.0};
+constexpr double qpoints_tri_4order_weight[] = {1.0 / 6.0 - (45.0 - M_SQRT10) * sqrt_dunavant_4 / 3720.0,
+                                            1.0 / 6.0 - (45.0 - M_SQRT10) * sqrt_dunavant_4 / 3720.0,
+                                            1.0 / 6.0 - (45.0 - M_SQRT10) * sqrt_dunavant_4 / 3720.0,
+                                            1.0 / 6.0 + (45.0 - M_SQRT10) * sqrt_dunavant_4 / 3720.0,
+                                            1.0 / 6.0 + (45.0 - M_SQRT10) * sqrt_dunavant_4 / 3720.0,
+                                            1.0 / 6.0 + (45.0 - M_SQRT10) * sqrt_dunavant_4 / 3720.0};
 
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 
-const double* qpoints_tri_1order[3] = {qpoints_tri_1order_coordx, qpoints_tri_1order_coordy, qpoints_tri_1order_weight};
-const double* qpoints_tri_2order[3] = {qpoints_tri_2order_coordx, qpoints_tri_2order_coordy, qpoints_tri_2order_weight};
-const double* qpoints_tri_3order[3] = {qpoints_tri_4order_coordx, qpoints_tri_4order_coordy, qpoints_tri_4order_weight};
-const double* qpoints_tri_4order[3] = {qpoints_tri_4order_coordx, qpoints_tri_4order_coordy, qpoints_tri_4order_weight};
+constexpr const double* qpoints_tri_1order[3] = {qpoints_tri_1order_coordx, qpoints_tri_1order_coordy, qpoints_tri_1order_weight};
+constexpr const double* qpoints_tri_2order[3] = {qpoints_tri_2order_coordx, qpoints_tri_2order_coordy, qpoints_tri_2order_weight};
+constexpr const double* qpoints_tri_3order[3] = {qpoints_tri_4order_coordx, qpoints_tri_4order_coordy, qpoints_tri_4order_weight};
+constexpr const double* qpoints_tri_4order[3] = {qpoints_tri_4order_coordx, qpoints_tri_4order_coordy, qpoints_tri_4order_weight};
 
 //! Number of triangle quadrature points
-const int n_qpoints_tri[MAX_QORDER] = {1, 3, 6, 6};
+constexpr int n_qpoints_tri[MAX_QORDER] = {1, 3, 6, 6};
 
 //! All properties of triangle quadrature points
-const double* const* qpoints_tri[MAX_QORDER] = {qpoints_tri_1order, qpoints_tri_2order, qpoints_tri_3order, qpoints_tri_4order};
+constexpr const double* const* qpoints_tri[MAX_QORDER] = {qpoints_tri_1order, qpoints_tri_2order, qpoints_tri_3order, qpoints_tri_4order};
 
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 // Quadrature points on a unit square
@@ -252,13 +255,13 @@ const double* const* qpoints_tri[MAX_QORDER] = {qpoints_tri_1order, qpoints_tri_
 //                 -------------------------
 
 //! First reference coordinate for 1st order rule on a rectangle
-const double qpoints_rec_1order_coordx[] = {0.5 + qdispl_glg_1[0]};
+constexpr double qpoints_rec_1order_coordx[] = {0.5 + qdispl_glg_1[0]};
 
 //! Second reference coordinate for 1st order rule on a rectangle
-const double qpoints_rec_1order_coordy[] = {0.5 + qdispl_glg_1[0]};
+constexpr double qpoints_rec_1order_coordy[] = {0.5 + qdispl_glg_1[0]};
 
 //! Weights for 1st order rule on a rectangle
-const double qpoints_rec_1order_weight[] = {weight_glg_1[0]};
+constexpr double qpoints_rec_1order_weight[] = {weight_glg_1[0]};
 
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -278,13 +281,13 @@ const double qpoints_rec_1order_weight[] = {weight_glg_1[0]};
 //                 -------------------------
 
 //! First reference coordinate for 2nd order rule on a rectangle
-const double qpoints_rec_2order_coordx[] = {0.5 + qdispl_glg_2[0], 0.5 + qdispl_glg_2[1], 0.5 + qdispl_glg_1[0]};
+constexpr double qpoints_rec_2order_coordx[] = {0.5 + qdispl_glg_2[0], 0.5 + qdispl_glg_2[1], 0.5 + qdispl_glg_1[0]};
 
 //! Second reference coordinate for 2nd order rule on a rectangle
-const double qpoints_rec_2order_coordy[] = {0.5 + qdispl_glg_2[0], 0.5 + qdispl_glg_2[0], 0.5 + qdispl_glg_2[1]};
+constexpr double qpoints_rec_2order_coordy[] = {0.5 + qdispl_glg_2[0], 0.5 + qdispl_glg_2[0], 0.5 + qdispl_glg_2[1]};
 
 //! Weights for 2nd order rule on a rectangle
-const double qpoints_rec_2order_weight[] = {weight_glg_2[0] * weight_glg_2[0], weight_glg_2[1] * weight_glg_2[0], weight_glg_1[0] * weight_glg_2[1]};
+constexpr double qpoints_rec_2order_weight[] = {weight_glg_2[0] * weight_glg_2[0], weight_glg_2[1] * weight_glg_2[0], weight_glg_1[0] * weight_glg_2[1]};
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 
 // Integrates 3rd order bi-variate polynomial exactly.
@@ -303,15 +306,15 @@ const double qpoints_rec_2order_weight[] = {weight_glg_2[0] * weight_glg_2[0], w
 //                 -------------------------
 
 //! First reference coordinate for 3rd order rule on a rectangle
-const double qpoints_rec_3order_coordx[] = {0.5 + qdispl_glg_2[0], 0.5 + qdispl_glg_2[1],
+constexpr double qpoints_rec_3order_coordx[] = {0.5 + qdispl_glg_2[0], 0.5 + qdispl_glg_2[1],
                                             0.5 + qdispl_glg_2[0], 0.5 + qdispl_glg_2[1]};
 
 //! Second reference coordinate for 3rd order rule on a rectangle
-const double qpoints_rec_3order_coordy[] = {0.5 + qdispl_glg_2[0], 0.5 + qdispl_glg_2[0],
+constexpr double qpoints_rec_3order_coordy[] = {0.5 + qdispl_glg_2[0], 0.5 + qdispl_glg_2[0],
                                             0.5 + qdispl_glg_2[1], 0.5 + qdispl_glg_2[1]};
 
 //! Weights for 3rd order rule on a rectangle
-const double qpoints_rec_3order_weight[] = {weight_glg_2[0] * weight_glg_2[0], weight_glg_2[1] * weight_glg_2[0],
+constexpr double qpoints_rec_3order_weight[] = {weight_glg_2[0] * weight_glg_2[0], weight_glg_2[1] * weight_glg_2[0],
                                             weight_glg_2[0] * weight_glg_2[1], weight_glg_2[1] * weight_glg_2[1]};
 
 //----------------------------------------------------------------------------------------------------------------------------------------------------
@@ -332,17 +335,17 @@ const double qpoints_rec_3order_weight[] = {weight_glg_2[0] * weight_glg_2[0], w
 //                 -------------------------
 
 //! First reference coordinate for 4th order rule on a rectangle
-const double qpoints_rec_4order_coordx[] = {0.5 + qdispl_glg_2[0], 0.5 + qdispl_glg_2[1],
+constexpr double qpoints_rec_4order_coordx[] = {0.5 + qdispl_glg_2[0], 0.5 + qdispl_glg_2[1],
                                             0.5 + qdispl_glg_2[0], 0.5 + qdispl_glg_2[1],
                                             0.5 + qdispl_glg_2[0], 0.5 + qdispl_glg_2[1]};
 
 //! Second reference coordinate for 4th order rule on a rectangle
-const double qpoints_rec_4order_coordy[] = {0.5 + qdispl_glg_3[0], 0.5 + qdispl_glg_3[0],
+constexpr double qpoints_rec_4order_coordy[] = {0.5 + qdispl_glg_3[0], 0.5 + qdispl_glg_3[0],
                                             0.5 + qdispl_glg_3[1], 0.5 + qdispl_glg_3[1],
                                             0.5 + qdispl_glg_3[2], 0.5 + qdispl_glg_3[2]};
 
 //! Weights for 4th order rule on a rectangle
-const double qpoints_rec_4order_weight[] = {weight_glg_2[0] * weight_glg_3[0], weight_glg_2[1] * weight_glg_3[0],
+constexpr double qpoints_rec_4order_weight[] = {weight_glg_2[0] * weight_glg_3[0], weight_glg_2[1] * weight_glg_3[0],
                                             weight_glg_2[0] * weight_glg_3[1], weight_glg_2[1] * weight_glg_3[1],
                                             weight_glg_2[0] * weight_glg_3[2], weight_glg_2[1] * weight_glg_3[2]};
 
@@ -364,39 +367,39 @@ const double qpoints_rec_4order_weight[] = {weight_glg_2[0] * weight_glg_3[0], w
 //                 -------------------------
 
 //! First reference coordinate for 5th order rule on a rectangle
-const double qpoints_rec_5order_coordx[] = {0.5 + qdispl_glg_3[0], 0.5 + qdispl_glg_3[1], 0.5 + qdispl_glg_3[2],
+constexpr double qpoints_rec_5order_coordx[] = {0.5 + qdispl_glg_3[0], 0.5 + qdispl_glg_3[1], 0.5 + qdispl_glg_3[2],
                                             0.5 + qdispl_glg_3[0], 0.5 + qdispl_glg_3[1], 0.5 + qdispl_glg_3[2],
                                             0.5 + qdispl_glg_3[0], 0.5 + qdispl_glg_3[1], 0.5 + qdispl_glg_3[2]};
 
 //! Second reference coordinate for 5th order rule on a rectangle
-const double qpoints_rec_5order_coordy[] = {0.5 + qdispl_glg_3[0], 0.5 + qdispl_glg_3[0], 0.5 + qdispl_glg_3[0],
+constexpr double qpoints_rec_5order_coordy[] = {0.5 + qdispl_glg_3[0], 0.5 + qdispl_glg_3[0], 0.5 + qdispl_glg_3[0],
                                             0.5 + qdispl_glg_3[1], 0.5 + qdispl_glg_3[1], 0.5 + qdispl_glg_3[1],
                                             0.5 + qdispl_glg_3[2], 0.5 + qdispl_glg_3[2], 0.5 + qdispl_glg_3[2]};
 
 //! Weights for 5th order rule on a rectangle
-const double qpoints_rec_5order_weight[] = {weight_glg_3[0] * weight_glg_3[0], weight_glg_3[1] * weight_glg_3[0], weight_glg_3[2] * weight_glg_3[0],
+constexpr double qpoints_rec_5order_weight[] = {weight_glg_3[0] * weight_glg_3[0], weight_glg_3[1] * weight_glg_3[0], weight_glg_3[2] * weight_glg_3[0],
                                             weight_glg_3[0] * weight_glg_3[1], weight_glg_3[1] * weight_glg_3[1], weight_glg_3[2] * weight_glg_3[1],
                                             weight_glg_3[0] * weight_glg_3[2], weight_glg_3[1] * weight_glg_3[2], weight_glg_3[2] * weight_glg_3[2]};
 
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 
-const double* qpoints_rec_1order[3] = {qpoints_rec_1order_coordx, qpoints_rec_1order_coordy, qpoints_rec_1order_weight};
-const double* qpoints_rec_2order[3] = {qpoints_rec_3order_coordx, qpoints_rec_3order_coordy, qpoints_rec_3order_weight};
-const double* qpoints_rec_3order[3] = {qpoints_rec_3order_coordx, qpoints_rec_3order_coordy, qpoints_rec_3order_weight};
-const double* qpoints_rec_4order[3] = {qpoints_rec_5order_coordx, qpoints_rec_5order_coordy, qpoints_rec_5order_weight};
+constexpr const double* qpoints_rec_1order[3] = {qpoints_rec_1order_coordx, qpoints_rec_1order_coordy, qpoints_rec_1order_weight};
+constexpr const double* qpoints_rec_2order[3] = {qpoints_rec_3order_coordx, qpoints_rec_3order_coordy, qpoints_rec_3order_weight};
+constexpr const double* qpoints_rec_3order[3] = {qpoints_rec_3order_coordx, qpoints_rec_3order_coordy, qpoints_rec_3order_weight};
+constexpr const double* qpoints_rec_4order[3] = {qpoints_rec_5order_coordx, qpoints_rec_5order_coordy, qpoints_rec_5order_weight};
 
 //! Number of rectangle quadrature points
-const int n_qpoints_rec[MAX_QORDER] = {1, 4, 4, 9};
+constexpr int n_qpoints_rec[MAX_QORDER] = {1, 4, 4, 9};
 
 //! All properties of rectangle quadrature points
-const double* const* qpoints_rec[MAX_QORDER] = {qpoints_rec_1order, qpoints_rec_2order, qpoints_rec_3order, qpoints_rec_4order};
+constexpr const double* const* qpoints_rec[MAX_QORDER] = {qpoints_rec_1order, qpoints_rec_2order, qpoints_rec_3order, qpoints_rec_4order};
 
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 
 #ifdef GEO_DEBUG
 
 //! Reference coordinates of the vertices
-const double vert_coord[2][4][2] = {{{0.0, 0.0}, {1.0, 0.0}, {1.0 / 2.0, sqrtthr / 2.0}, {0.0, 0.0}},
+constexpr double vert_coord[2][4][2] = {{{0.0, 0.0}, {1.0, 0.0}, {1.0 / 2.0, M_SQRT3 / 2.0}, {0.0, 0.0}},
                                     {{0.0, 0.0}, {1.0, 0.0}, {1.0      , 1.0          }, {0.0, 1.0}}};
 
 //! File name for quadrature point visualization
@@ -412,7 +415,7 @@ const std::string qp_fname = "quadpoints.dat";
 inline void QuadVisualize(int n_verts, int order)
 {
    const int* n_qpoints = (n_verts == 3 ? n_qpoints_tri : n_qpoints_rec);
-   const double* const** qpoints = (n_verts == 3 ? qpoints_tri : qpoints_rec);
+   const double* const* const* qpoints = (n_verts == 3 ? qpoints_tri : qpoints_rec);
 
    std::ofstream qpfile;
    qpfile.open(qp_fname.c_str(), std::ofstream::out);
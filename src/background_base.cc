@@ -74,7 +74,8 @@ void BackgroundBase::DirectionalDerivative(int xyz)
 
    if(BITS_LOWERED(_status, STATE_SETUP_COMPLETE)) {
       RAISE_BITS(_status, STATE_INVALID);
-      throw ExUninitialized();
+      fields_error = FIELDS_ERR_UNINITIALIZED;
+      return;
    };
 
 // Spatial derivatives
@@ -133,8 +134,12 @@ void BackgroundBase::DirectionalDerivative(int xyz)
 
 // If at least one increment failed, half the increment
       if(_spdata._dr_forw_fail[xyz] || _spdata._dr_back_fail[xyz]) _spdata_tmp._dr[xyz] *= 0.5;
-// Check if both increments failed, throw error
-      if(_spdata._dr_forw_fail[xyz] && _spdata._dr_back_fail[xyz]) throw ExFieldError();
+// Check if both increments failed, report error
+      if(_spdata._dr_forw_fail[xyz] && _spdata._dr_back_fail[xyz]) {
+         fields_error = FIELDS_ERR_FIELD;
+         _pos = _pos_saved;
+         return;
+      };
 
 // Restore position
       _pos = _pos_saved;
@@ -204,8 +209,12 @@ void BackgroundBase::DirectionalDerivative(int xyz)
 
 // If at least one increment failed, half the increment
       if(_spdata._dt_forw_fail || _spdata._dt_back_fail) _spdata_tmp._dt *= 0.5;
-// Check if both increments failed, throw error
-      if(_spdata._dt_forw_fail && _spdata._dt_back_fail) throw ExFieldError();
+// Check if both increments failed, report error
+      if(_spdata._dt_forw_fail && _spdata._dt_back_fail) {
+         fields_error = FIELDS_ERR_FIELD;
+         _t = _t_saved;
+         return;
+      };
 
 // Restore time
       _t = _t_saved;
@@ -357,6 +366,27 @@ void BackgroundBase::EvaluateBackground(void)
    LOWER_BITS(_status, STATE_INVALID);
 };
 
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in]  n_pts  Number of positions
+\param[in]  t      Time
+\param[in]  pos    Array of positions
+\param[in]  mask   Which fields to compute
+\param[out] spdata Array of spatial data, one per position
+\note The default version evaluates one position at a time. Derived classes that can share work between nearby positions (e.g., a common block or stencil) should override this.
+*/
+void BackgroundBase::EvaluateBackgroundArray(int n_pts, double t, const GeoVector* pos, uint16_t mask, SpatialData* spdata)
+{
+   _t = t;
+   for(int pt = 0; pt < n_pts; pt++) {
+      _pos = pos[pt];
+      _spdata._mask = mask;
+      EvaluateBackground();
+      spdata[pt] = _spdata;
+   };
+};
+
 /*!
 \author Vladimir Florinski
 \date 10/13/2022
@@ -419,36 +449,117 @@ double BackgroundBase::GetSafeIncr(const GeoVector& dir)
 \note This is a common routine that the derived classes should not change.
 */
 void BackgroundBase::GetFields(double t_in, const GeoVector& pos_in, const GeoVector& mom_in, SpatialData& spdata)
+{
+   switch(TryGetFields(t_in, pos_in, mom_in, spdata)) {
+   case FIELDS_ERR_UNINITIALIZED:
+      throw ExUninitialized();
+   case FIELDS_ERR_COORDINATES:
+      throw ExCoordinates();
+   case FIELDS_ERR_FIELD:
+   case FIELDS_ERR_SERVER:
+      throw ExFieldError();
+   };
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in]  t_in   Time
+\param[in]  pos_in Position
+\param[in]  mom_in Momentum (p,mu,phi) coordinates
+\param[out] spdata All spatial data
+\return FIELDS_OK on success, or the reason for the failure
+\note This is a common routine that the derived classes should not change.
+
+This is the same as "GetFields()", except that failures are reported by the return value, so that the trajectory integrators can discard a trajectory without unwinding the stack. The argument is not modified if the evaluation fails.
+*/
+int BackgroundBase::TryGetFields(double t_in, const GeoVector& pos_in, const GeoVector& mom_in, SpatialData& spdata)
 {
 // Check that state setup is complete
    if(BITS_LOWERED(_status, STATE_SETUP_COMPLETE)) {
       RAISE_BITS(_status, STATE_INVALID);
-      throw ExUninitialized();
+      return FIELDS_ERR_UNINITIALIZED;
    };
+   LOWER_BITS(_status, STATE_INVALID);
+   fields_error = FIELDS_OK;
 
 // If "EvaluateDmax()" fails, the state will be set to "STATE_INVALID" and background will not be evaluated
    SetState(t_in, pos_in, mom_in);
    EvaluateDmax();
-   if(BITS_RAISED(_status, STATE_INVALID)) throw ExCoordinates();
+   if(BITS_RAISED(_status, STATE_INVALID)) return FIELDS_ERR_COORDINATES;
 
 // The mask is provided by the caller, we need to copy it into our internal fields structure
    _spdata._mask = spdata._mask;
 
-// Compute u, B, E
+// Compute u, B, E. A derived class may provide a more specific reason for the failure in "fields_error".
    EvaluateBackground();
-   if(BITS_RAISED(_status, STATE_INVALID)) throw ExFieldError();
+   if(BITS_RAISED(_status, STATE_INVALID)) return (fields_error == FIELDS_OK ? FIELDS_ERR_FIELD : fields_error);
 // Compute Bmag, bhat
    if(BITS_RAISED(_spdata._mask, BACKGROUND_B)) {
       EvaluateBmag();
-      if(_spdata.Bmag < sp_tiny) RAISE_BITS(_status, STATE_INVALID);
-      else _spdata.bhat = _spdata.Bvec / _spdata.Bmag;
+      if(_spdata.Bmag < sp_tiny) {
+         RAISE_BITS(_status, STATE_INVALID);
+         return FIELDS_ERR_FIELD;
+      };
+      _spdata.bhat = _spdata.Bvec / _spdata.Bmag;
    };
-   if(BITS_RAISED(_status, STATE_INVALID)) throw ExFieldError();
 // Compute derivatives of u, B, E
    EvaluateBackgroundDerivatives();
+   if(fields_error != FIELDS_OK) return fields_error;
 
 // Copy the internal fields into arguments
    spdata = _spdata;
+   return FIELDS_OK;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in]  n_pts   Number of points
+\param[in]  t_in    Time
+\param[in]  pos_in  Positions
+\param[in]  mask    Which fields to compute
+\param[out] spdata  Fields at each position
+\param[out] status  STATE_NONE if the fields at this position are valid, STATE_INVALID otherwise
+\return Number of valid points
+
+This is the same as calling "TryGetFields()" for each position. It is meant for tracers that advance many independent points together. The momentum is set to zero, so the mask should not request derivatives that depend on the gyro-radius.
+*/
+int BackgroundBase::GetFieldsArray(int n_pts, double t_in, const GeoVector* pos_in, uint16_t mask, SpatialData* spdata, uint16_t* status)
+{
+   int pt, n_valid = 0;
+
+   for(pt = 0; pt < n_pts; pt++) {
+      spdata[pt]._mask = mask;
+      if(TryGetFields(t_in, pos_in[pt], gv_zeros, spdata[pt]) == FIELDS_OK) {
+         status[pt] = STATE_NONE;
+         n_valid++;
+      }
+      else status[pt] = STATE_INVALID;
+   };
+
+   return n_valid;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[out] state Persistent state that cannot be reproduced from the data container
+
+Most backgrounds are fully determined by their parameters, so the default state is empty. Classes that draw random numbers during setup should pack the results, so that all processes can be given the same realization.
+*/
+void BackgroundBase::PackState(std::vector<double>& state) const
+{
+   state.clear();
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] state Persistent state packed by "PackState()"
+*/
+void BackgroundBase::UnpackState(const std::vector<double>& state)
+{
 };
 
 };
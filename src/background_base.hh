@@ -21,6 +21,8 @@ This file is part of the SPECTRUM suite of scientific numerical simulation codes
 #include <memory>
 #ifdef USE_SILO
 #include <silo.h>
+#include <vector>
+#include "common/silo_writer.hh"
 #endif
 
 namespace Spectrum {
@@ -48,6 +50,21 @@ const double local_rot_ang = M_PI / BACKGROUND_NUM_GRAD_EVALS;
 const double sin_lra = sin(local_rot_ang);
 const double cos_lra = cos(local_rot_ang);
 
+//! Field evaluation succeeded
+const int FIELDS_OK = 0;
+
+//! Field evaluation failed because the background was not set up
+const int FIELDS_ERR_UNINITIALIZED = 1;
+
+//! Field evaluation failed because the position is outside of the domain
+const int FIELDS_ERR_COORDINATES = 2;
+
+//! Field evaluation failed because the fields or their derivatives could not be computed
+const int FIELDS_ERR_FIELD = 3;
+
+//! Field evaluation failed because the server could not provide the data
+const int FIELDS_ERR_SERVER = 4;
+
 //! Clone function pattern
 #define CloneFunctionBackground(T) std::unique_ptr<BackgroundBase> Clone(void) const override {return std::make_unique<T>();};
 
@@ -126,6 +143,9 @@ protected:
 //! Rotation matrix (transient)
    GeoMatrix rot_mat;
 
+//! Error code set by the evaluation functions that cannot report an error through "STATE_INVALID" (transient)
+   int fields_error = FIELDS_OK;
+
 #ifdef USE_SILO
 
 //! A handle to a SILO database (transient)
@@ -146,6 +166,9 @@ protected:
 //! Direction of the x axis in the cut plane (transient)
    GeoVector x_dir;
 
+//! Background writer for multi-block output (transient)
+   std::unique_ptr<SiloWriter> silo_writer;
+
 #endif
 
 //! Default constructor (protected, class not designed to be instantiated)
@@ -169,6 +192,9 @@ protected:
 //! Compute the internal u, B, and E fields
    virtual void EvaluateBackground(void);
 
+//! Compute the u, B, and E fields at an array of positions
+   virtual void EvaluateBackgroundArray(int n_pts, double t, const GeoVector* pos, uint16_t mask, SpatialData* spdata);
+
 //! Compute the internal derivatives of the fields
    virtual void EvaluateBackgroundDerivatives(void);
 
@@ -201,6 +227,18 @@ public:
 //! Return fields at the internal position, evaluated or previously stored
    void GetFields(double t_in, const GeoVector& pos_in, const GeoVector& mom_in, SpatialData& spdata);
 
+//! Return fields at the internal position and an error code instead of throwing
+   int TryGetFields(double t_in, const GeoVector& pos_in, const GeoVector& mom_in, SpatialData& spdata);
+
+//! Return fields at an array of positions without throwing
+   int GetFieldsArray(int n_pts, double t_in, const GeoVector* pos_in, uint16_t mask, SpatialData* spdata, uint16_t* status);
+
+//! Pack the persistent state that cannot be reproduced from the data container (stub)
+   virtual void PackState(std::vector<double>& state) const;
+
+//! Restore the persistent state packed by "PackState()" (stub)
+   virtual void UnpackState(const std::vector<double>& state);
+
 #ifdef USE_SILO
 
 //! Set up the plot limits
@@ -225,6 +263,10 @@ public:
 //! Generate a 2D box vector plot
    void BoxPlot2DVector(const std::string var_name, bool phys_units, double t = 0.0);
 
+//! Generate a 3D box plot of several variables as a multi-block SILO database
+   void BoxPlot3DParallel(const std::string& file_base, const std::vector<std::string>& var_names, bool phys_units, double t = 0.0,
+                          int rank = 0, int n_ranks = 1, int blocks_per_rank = 4);
+
 //! Finalize the output
    void BoxPlotFinalize(void);
 
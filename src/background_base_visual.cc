@@ -10,6 +10,10 @@ This file is part of the SPECTRUM suite of scientific numerical simulation codes
 #include "background_base.hh"
 #include <iostream>
 #include <iomanip>
+#include <algorithm>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #ifdef USE_SILO
 
@@ -494,6 +498,198 @@ void BackgroundBase::BoxPlot2DVector(const std::string var_name, bool phys_units
    for(xyz = 0; xyz < 2; xyz++) delete[] vec_field[xyz];
 };
 
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] file_base       Base name of the SILO files (without extension)
+\param[in] var_names       Names of the variables to be plotted
+\param[in] phys_units      Use physical units for output
+\param[in] t               Time at which to plot variables
+\param[in] rank            Rank of this process among the processes sharing the work
+\param[in] n_ranks         Number of processes sharing the work
+\param[in] blocks_per_rank Number of blocks (slabs of z planes) assigned to each process
+
+The box is cut into "n_ranks * blocks_per_rank" slabs along z, and slab "b" is computed by process "b % n_ranks". Every process writes its slabs into its own file "<file_base>_<rank>.silo" as meshes "cube_mesh_<b>" and variables "<var_name>_<b>", and rank 0 writes the root file "<file_base>.silo" with the multi-block objects named "cube_mesh" and "<var_name>". All variables are computed in a single sweep over the zones of a slab, and the slab is handed over to the background writer as soon as it is complete, so that file I/O overlaps with the computation of the next slab. Output is not guaranteed to be on disk until "BoxPlotFinalize()" is called.
+*/
+void BackgroundBase::BoxPlot3DParallel(const std::string& file_base, const std::vector<std::string>& var_names, bool phys_units, double t,
+                                       int rank, int n_ranks, int blocks_per_rank)
+{
+   if(BITS_LOWERED(_status, STATE_SETUP_COMPLETE)) return;
+
+   int xyz, ix, iy, iz, idx, var, cmp, blk, thr, n_blocks, n_threads, iz_first, iz_last, n_zones;
+   uint16_t mask = 0;
+   GeoVector incr;
+   MultiIndex dims_n, dims_zb;
+   std::string file_name;
+
+// Field accessor, number of components, unit, and mask for each requested variable
+   struct PlotVariable {
+      std::string name;
+      int n_comp;
+      double unit;
+      uint16_t mask;
+      double (*value)(const SpatialData& spdata, int cmp);
+   };
+   std::vector<PlotVariable> plot_vars;
+
+// Parse the user input
+   for(auto& var_name : var_names) {
+      if(var_name == "Umag") plot_vars.push_back({var_name, 1, unit_velocity_fluid, BACKGROUND_U,
+                                                  [](const SpatialData& spdata, int cmp) {return spdata.Uvec.Norm();}});
+      else if(var_name == "Ux") plot_vars.push_back({var_name, 1, unit_velocity_fluid, BACKGROUND_U,
+                                                     [](const SpatialData& spdata, int cmp) {return spdata.Uvec[0];}});
+      else if(var_name == "Uy") plot_vars.push_back({var_name, 1, unit_velocity_fluid, BACKGROUND_U,
+                                                     [](const SpatialData& spdata, int cmp) {return spdata.Uvec[1];}});
+      else if(var_name == "Uz") plot_vars.push_back({var_name, 1, unit_velocity_fluid, BACKGROUND_U,
+                                                     [](const SpatialData& spdata, int cmp) {return spdata.Uvec[2];}});
+      else if(var_name == "Uvec") plot_vars.push_back({var_name, 3, unit_velocity_fluid, BACKGROUND_U,
+                                                       [](const SpatialData& spdata, int cmp) {return spdata.Uvec[cmp];}});
+      else if(var_name == "Bmag") plot_vars.push_back({var_name, 1, unit_magnetic_fluid, BACKGROUND_B,
+                                                       [](const SpatialData& spdata, int cmp) {return spdata.Bvec.Norm();}});
+      else if(var_name == "Bx") plot_vars.push_back({var_name, 1, unit_magnetic_fluid, BACKGROUND_B,
+                                                     [](const SpatialData& spdata, int cmp) {return spdata.Bvec[0];}});
+      else if(var_name == "By") plot_vars.push_back({var_name, 1, unit_magnetic_fluid, BACKGROUND_B,
+                                                     [](const SpatialData& spdata, int cmp) {return spdata.Bvec[1];}});
+      else if(var_name == "Bz") plot_vars.push_back({var_name, 1, unit_magnetic_fluid, BACKGROUND_B,
+                                                     [](const SpatialData& spdata, int cmp) {return spdata.Bvec[2];}});
+      else if(var_name == "Bvec") plot_vars.push_back({var_name, 3, unit_magnetic_fluid, BACKGROUND_B,
+                                                       [](const SpatialData& spdata, int cmp) {return spdata.Bvec[cmp];}});
+      else if(var_name == "Region1") plot_vars.push_back({var_name, 1, 1.0, 0,
+                                                          [](const SpatialData& spdata, int cmp) {return spdata.region[0];}});
+      else if(var_name == "Region2") plot_vars.push_back({var_name, 1, 1.0, 0,
+                                                          [](const SpatialData& spdata, int cmp) {return spdata.region[1];}});
+      else if(var_name == "Region3") plot_vars.push_back({var_name, 1, 1.0, 0,
+                                                          [](const SpatialData& spdata, int cmp) {return spdata.region[2];}});
+      else if(var_name == "n_dens") plot_vars.push_back({var_name, 1, unit_number_density_fluid, 0,
+                                                         [](const SpatialData& spdata, int cmp) {return spdata.n_dens;}});
+      else if(var_name == "p_ther") plot_vars.push_back({var_name, 1, unit_pressure_fluid, 0,
+                                                         [](const SpatialData& spdata, int cmp) {return spdata.p_ther;}});
+      else continue;
+      mask |= plot_vars.back().mask;
+   };
+   if(plot_vars.empty()) return;
+
+// Split the box into slabs, but not thinner than one plane
+   n_blocks = std::min(n_ranks * blocks_per_rank, dims_z[2]);
+   if(n_blocks < 1 || rank >= n_blocks) return;
+
+// Block paths are relative to the root file, so the directory part is removed
+   file_name = file_base.substr(file_base.find_last_of('/') + 1);
+
+// Start the writer if this is the first call since the last finalize
+   if(!silo_writer) silo_writer = std::make_unique<SiloWriter>();
+
+// The root file only needs the names, so it can be written before any data are available
+   if(rank == 0) {
+      std::vector<std::string> block_paths(n_blocks), multi_names(plot_vars.size());
+      for(blk = 0; blk < n_blocks; blk++) block_paths[blk] = file_name + "_" + std::to_string(blk % n_ranks) + ".silo:";
+      for(var = 0; var < plot_vars.size(); var++) multi_names[var] = plot_vars[var].name;
+
+      silo_writer->CreateFile(file_base + ".silo");
+      silo_writer->Submit([block_paths, multi_names](DBfile* silofile) {
+         return WriteSiloMultiBlock(silofile, mesh3d_name, DB_QUAD_RECT, block_paths, multi_names, DB_QUADVAR);
+      });
+      silo_writer->CloseFile();
+   };
+   silo_writer->CreateFile(file_base + "_" + std::to_string(rank) + ".silo");
+
+// Evaluators for each thread. The clones only share the persistent data, so this is only safe when the background does not use a server.
+   std::vector<std::unique_ptr<BackgroundBase>> clones;
+   std::vector<BackgroundBase*> evaluators(1, this);
+#if defined(_OPENMP) && (SERVER_TYPE == SERVER_SELF)
+   n_threads = omp_get_max_threads();
+   for(thr = 1; thr < n_threads; thr++) {
+      clones.push_back(Clone());
+      clones.back()->SetupObject(container);
+      evaluators.push_back(clones.back().get());
+   };
+#else
+   n_threads = 1;
+#endif
+
+   incr = (xyz_max - xyz_min) / dims_z;
+
+   std::cerr << "Calculating the variables on rank " << rank << ":     ";
+
+   for(blk = rank; blk < n_blocks; blk += n_ranks) {
+
+// Slab dimensions
+      iz_first = blk * dims_z[2] / n_blocks;
+      iz_last = (blk + 1) * dims_z[2] / n_blocks;
+      dims_zb = MultiIndex(dims_z[0], dims_z[1], iz_last - iz_first);
+      dims_n = dims_zb + 1;
+      n_zones = dims_zb.Prod();
+
+// Node coordinates
+      std::vector<std::vector<double>> coords(3);
+      for(xyz = 0; xyz < 3; xyz++) {
+         coords[xyz].resize(dims_n[xyz]);
+         for(idx = 0; idx < dims_n[xyz]; idx++) {
+            coords[xyz][idx] = (xyz_min[xyz] + ((xyz == 2 ? iz_first : 0) + idx) * incr[xyz]) * (phys_units ? unit_length_fluid : 1.0);
+         };
+      };
+
+      silo_writer->Submit([coords, dims_n, blk](DBfile* silofile) mutable {
+         double* coord_ptrs[3] = {coords[0].data(), coords[1].data(), coords[2].data()};
+         return DBPutQuadmesh(silofile, (mesh3d_name + "_" + std::to_string(blk)).c_str(), NULL, coord_ptrs, dims_n.ijk, 3,
+                              DB_DOUBLE, DB_COLLINEAR, NULL);
+      });
+
+// Zone centers
+      std::vector<GeoVector> zone_pos(n_zones);
+      std::vector<SpatialData> zone_data(n_zones);
+      idx = 0;
+      for(iz = iz_first; iz < iz_last; iz++) {
+         for(iy = 0; iy < dims_z[1]; iy++) {
+            for(ix = 0; ix < dims_z[0]; ix++) {
+               zone_pos[idx][0] = xyz_min[0] + (ix + 0.5) * incr[0];
+               zone_pos[idx][1] = xyz_min[1] + (iy + 0.5) * incr[1];
+               zone_pos[idx][2] = xyz_min[2] + (iz + 0.5) * incr[2];
+               idx++;
+            };
+         };
+      };
+
+// One sweep over all zones computes every requested variable. Each thread gets a contiguous range of zones.
+#pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(thr = 0; thr < n_threads; thr++) {
+         int zone_first = thr * n_zones / n_threads;
+         int zone_last = (thr + 1) * n_zones / n_threads;
+         evaluators[thr]->EvaluateBackgroundArray(zone_last - zone_first, t, zone_pos.data() + zone_first, mask,
+                                                  zone_data.data() + zone_first);
+      };
+
+// Hand over the variables to the writer
+      for(auto& plot_var : plot_vars) {
+         double var_unit = (phys_units ? plot_var.unit : 1.0);
+         std::vector<std::vector<double>> fields(plot_var.n_comp, std::vector<double>(n_zones));
+         for(cmp = 0; cmp < plot_var.n_comp; cmp++) {
+            for(idx = 0; idx < n_zones; idx++) fields[cmp][idx] = plot_var.value(zone_data[idx], cmp) * var_unit;
+         };
+
+         silo_writer->Submit([fields, dims_zb, blk, name = plot_var.name](DBfile* silofile) mutable {
+            std::string mesh_name = mesh3d_name + "_" + std::to_string(blk);
+            std::string var_name = name + "_" + std::to_string(blk);
+            if(fields.size() == 1) {
+               return DBPutQuadvar1(silofile, var_name.c_str(), mesh_name.c_str(), fields[0].data(), dims_zb.ijk, 3, NULL, 0,
+                                    DB_DOUBLE, DB_ZONECENT, NULL);
+            };
+            std::string sub_names[3] = {var_name + "_x", var_name + "_y", var_name + "_z"};
+            char* sub_ptrs[3] = {sub_names[0].data(), sub_names[1].data(), sub_names[2].data()};
+            double* field_ptrs[3] = {fields[0].data(), fields[1].data(), fields[2].data()};
+            return DBPutQuadvar(silofile, var_name.c_str(), mesh_name.c_str(), 3, sub_ptrs, field_ptrs, dims_zb.ijk, 3, NULL, 0,
+                                DB_DOUBLE, DB_ZONECENT, NULL);
+         });
+      };
+
+      std::cerr << "\e[4D";
+      std::cerr << std::setw(3) << int(double(blk + 1) / double(n_blocks) * 100.0) << "%";
+   };
+   std::cerr << "\e[4D100%\n";
+
+   silo_writer->CloseFile();
+};
+
 /*!
 \author Vladimir Florinski
 \date 10/23/2020
@@ -502,6 +698,12 @@ void BackgroundBase::BoxPlotFinalize(void)
 {
    if(BITS_LOWERED(_status, STATE_SETUP_COMPLETE)) return;
    if(silofile) DBClose(silofile);
+
+// Wait for the background writer to complete all output
+   if(silo_writer) {
+      if(silo_writer->Finish()) std::cerr << "BoxPlotFinalize: some parallel SILO output could not be written" << std::endl;
+      silo_writer.reset();
+   };
 };
 
 };
@@ -79,7 +79,10 @@ void BackgroundServer::SetupBackground(bool construct)
 void BackgroundServer::EvaluateBackground(void)
 {
 #ifdef NEED_SERVER
-   server_front->GetVariables(_t, _pos, _spdata);
+   if(!server_front->GetVariables(_t, _pos, _spdata)) {
+      RAISE_BITS(_status, STATE_INVALID);
+      fields_error = FIELDS_ERR_SERVER;
+   };
 #endif
 };
 
@@ -67,6 +67,10 @@ void BackgroundShock::SetupBackground(bool construct)
 
 // Normalize n_shock
    n_shock.Normalize();
+
+// A discontinuous shock has no structure to resolve
+   dmax_shock = dmax0;
+   hw_shock = 0.0;
 };
 
 /*!
@@ -76,7 +80,7 @@ void BackgroundShock::SetupBackground(bool construct)
 void BackgroundShock::EvaluateBackground(void)
 {
 // Upstream
-   if((_pos - r0_shock - v_shock * n_shock * _t) * n_shock > 0) {
+   if(ShockDistance() > 0) {
       if(BITS_RAISED(_spdata._mask, BACKGROUND_U)) _spdata.Uvec = u0;
       if(BITS_RAISED(_spdata._mask, BACKGROUND_B)) _spdata.Bvec = B0;
       _spdata.region = 1.0;
@@ -109,4 +113,23 @@ void BackgroundShock::EvaluateBackgroundDerivatives(void)
    if(BITS_RAISED(_spdata._mask, BACKGROUND_dEdt)) _spdata.dEvecdt = gv_zeros;
 };
 
+/*!
+\author Swati Sharma
+\date 10/17/2026
+
+Inside the shock region "dmax" is "dmax_shock". Outside it increases linearly to "dmax0" over a distance of "dmax0", so that a step taken from anywhere in the ramp cannot cross into the shock region by more than "dmax_shock". This is the same profile as in "BackgroundSolarWindTermShock".
+*/
+void BackgroundShock::EvaluateDmax(void)
+{
+   double ds;
+
+   _spdata.dmax = dmax0;
+   if(dmax_shock < dmax0) {
+      ds = fabs(ShockDistance()) - hw_shock;
+      if(ds < 0.0) _spdata.dmax = dmax_shock;
+      else if(ds < dmax0) _spdata.dmax = dmax_shock + (dmax0 - dmax_shock) * ds / dmax0;
+   };
+   LOWER_BITS(_status, STATE_INVALID);
+};
+
 };
@@ -45,6 +45,15 @@ protected:
 //! Downstream magnetic field (persistent), "B0" is upstream magnetic field
    GeoVector B1;
 
+//! Largest distance per time step at the shock (persistent)
+   double dmax_shock;
+
+//! Half width of the region around the shock where "dmax_shock" is used (persistent)
+   double hw_shock;
+
+//! Signed distance from the shock, positive upstream
+   double ShockDistance(void) const;
+
 //! Set up the field evaluator based on "params"
    void SetupBackground(bool construct) override;
 
@@ -54,6 +63,9 @@ protected:
 //! Compute the internal u, B, and E derivatives
    void EvaluateBackgroundDerivatives(void) override;
 
+//! Compute the maximum distance per time step
+   void EvaluateDmax(void) override;
+
 public:
 
 //! Default constructor
@@ -72,6 +84,20 @@ public:
    CloneFunctionBackground(BackgroundShock);
 };
 
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// BackgroundShock inline methods
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return Signed distance from the shock at the internal position and time
+*/
+inline double BackgroundShock::ShockDistance(void) const
+{
+   return (_pos - r0_shock - v_shock * n_shock * _t) * n_shock;
+};
+
 };
 
 #endif
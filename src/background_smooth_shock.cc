@@ -111,6 +111,11 @@ void BackgroundSmoothShock::SetupBackground(bool construct)
 
 // Unpack parameters
    container.Read(&width_shock);
+   container.Read(&dmax_fraction);
+
+// Resolve the transition region. For the tanh profile the region extends to about one width from the center.
+   dmax_shock = fmin(dmax_fraction * width_shock, dmax0);
+   hw_shock = width_shock;
 };
 
 /*!
@@ -120,7 +125,7 @@ void BackgroundSmoothShock::SetupBackground(bool construct)
 void BackgroundSmoothShock::EvaluateBackground(void)
 {
    double a1, a2;
-   ds_shock = (_pos - r0_shock - v_shock * n_shock * _t) * n_shock / width_shock;
+   ds_shock = ShockDistance() / width_shock;
 
    a1 = ShockTransition(ds_shock);
    a2 = 1.0 - a1;
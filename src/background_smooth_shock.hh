@@ -33,7 +33,7 @@ const std::string bg_name_smooth_shock = "BackgroundSmoothShock";
 \brief Constant EM field with a smooth transition region
 \author Juan G Alonso Guzman
 
-Parameters: (BackgroundShock), width_shock
+Parameters: (BackgroundShock), double width_shock, double dmax_fraction
 */
 class BackgroundSmoothShock : public BackgroundShock {
 
@@ -42,6 +42,9 @@ protected:
 //! Width of shock transition region (persistent)
    double width_shock;
 
+//! Largest distance per time step at the shock as a fraction of "width_shock" (persistent)
+   double dmax_fraction;
+
 //! Relative distance to shock (transient)
    double ds_shock;
 
@@ -7,6 +7,7 @@ This file is part of the SPECTRUM suite of scientific numerical simulation codes
 */
 
 #include "background_waves.hh"
+#include "common/print_warn.hh"
 
 namespace Spectrum {
 
@@ -260,4 +261,62 @@ void BackgroundWaves::EvaluateDmax(void)
    LOWER_BITS(_status, STATE_INVALID);
 };
 
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[out] state Phase, polarization, basis, and amplitude of each wave
+
+The wavenumbers are not included because they are fully determined by the parameters.
+*/
+void BackgroundWaves::PackState(std::vector<double>& state) const
+{
+   int wave, i, j;
+   turb_type t_type;
+
+   state.clear();
+   for(t_type = turb_alfven; t_type <= turb_isotropic; GEO_INCR(t_type, turb_type)) {
+      for(wave = 0; wave < n_waves[t_type]; wave++) {
+         state.push_back(phase[t_type][wave]);
+         state.push_back(cosa[t_type][wave]);
+         state.push_back(sina[t_type][wave]);
+         for(i = 0; i < 3; i++) {
+            for(j = 0; j < 3; j++) state.push_back(basis[t_type][wave][i][j]);
+         };
+         state.push_back(Ampl[t_type][wave]);
+      };
+   };
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] state Phase, polarization, basis, and amplitude of each wave, packed by "PackState()"
+*/
+void BackgroundWaves::UnpackState(const std::vector<double>& state)
+{
+   int wave, i, j;
+   size_t n_total = 0;
+   turb_type t_type;
+   std::vector<double>::const_iterator it = state.begin();
+
+// The number of waves must be the same as in the object that packed the state
+   for(t_type = turb_alfven; t_type <= turb_isotropic; GEO_INCR(t_type, turb_type)) n_total += n_waves[t_type];
+   if(state.size() != 13 * n_total) {
+      PrintError(__FILE__, __LINE__, "Wave state has the wrong size", true);
+      return;
+   };
+
+   for(t_type = turb_alfven; t_type <= turb_isotropic; GEO_INCR(t_type, turb_type)) {
+      for(wave = 0; wave < n_waves[t_type]; wave++) {
+         phase[t_type][wave] = *it++;
+         cosa[t_type][wave] = *it++;
+         sina[t_type][wave] = *it++;
+         for(i = 0; i < 3; i++) {
+            for(j = 0; j < 3; j++) basis[t_type][wave][i][j] = *it++;
+         };
+         Ampl[t_type][wave] = *it++;
+      };
+   };
+};
+
 };
@@ -93,6 +93,12 @@ public:
 
 //! Clone function
    CloneFunctionBackground(BackgroundWaves);
+
+//! Pack the random phases, polarizations, and orientations of the waves
+   void PackState(std::vector<double>& state) const override;
+
+//! Restore the random phases, polarizations, and orientations of the waves
+   void UnpackState(const std::vector<double>& state) override;
 };
 
 };
@@ -185,7 +185,7 @@ public:
    void GetZoneOffset(const GeoVector& pos, MultiIndex& zone, GeoVector& offset) const;
 
 //! Check if a position is inside the block
-   bool PositionInside(const GeoVector& pos) const;
+   virtual bool PositionInside(const GeoVector& pos) const;
 
 //! Return the LN zone center and offset for a given point
    virtual MultiIndex GetQuadrant(const GeoVector& pos) const = 0;
@@ -0,0 +1,398 @@
+/*!
+\file block_geodesic.cc
+\brief Implements a class to operate on geodesic grid blocks
+\author Swati Sharma
+
+This file is part of the SPECTRUM suite of scientific numerical simulation codes. SPECTRUM stands for Space Plasma and Energetic Charged particle TRansport on Unstructured Meshes. The code simulates plasma or neutral particle flows using MHD equations on a grid, transport of cosmic rays using stochastic or grid based methods. The "unstructured" part refers to the use of a geodesic mesh providing a uniform coverage of the surface of a sphere.
+*/
+
+#include "block_geodesic.hh"
+#include "reader_geodesic.hh"
+#include "server_base.hh"
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+
+namespace Spectrum {
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// BlockGeodesic methods
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+void BlockGeodesic::AllocateMemory(void)
+{
+   variables = new double[n_variables * block_size.Prod()];
+   corners = new GeoVector[verts_per_face];
+   face_cent = new GeoVector[n_faces];
+   ff = new int[n_faces * verts_per_face];
+   interior = new int[n_faces];
+   r_in = new double[n_shells + 1];
+   face_spacing = new double[n_faces];
+   lsq_inverse = new GeoMatrix[block_size.Prod()];
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] dims Vertices per face, faces, shells, ghost shells, and variables, as returned by "ReadGeodesicGetDimensions()"
+*/
+BlockGeodesic::BlockGeodesic(const int* dims)
+{
+   verts_per_face = dims[0];
+   n_faces = dims[1];
+   n_shells = dims[2];
+   ghost_height = dims[3];
+   n_variables = dims[4];
+   block_size = MultiIndex(n_faces, n_shells, 1);
+
+// There are no neighbor blocks
+   max_neighbors_per_dim = 1;
+   max_neighbors_per_dim_mns = 0;
+   max_neighbors = 0;
+   max_neighbor_levels = 0;
+   AllocateMemory();
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+BlockGeodesic::~BlockGeodesic(void)
+{
+   delete[] corners;
+   delete[] face_cent;
+   delete[] ff;
+   delete[] interior;
+   delete[] r_in;
+   delete[] face_spacing;
+   delete[] lsq_inverse;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] unit_length_block Unit of length used by the reader
+
+\note Can be called from server processes only
+*/
+void BlockGeodesic::LoadDimensions(double unit_length_block)
+{
+   ReadGeodesicGetBlockGeometry(node, corners[0].Data(), face_cent[0].Data(), ff, interior, r_in);
+   for(auto shell = 0; shell <= n_shells; shell++) r_in[shell] *= unit_length_block / unit_length_fluid;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+
+\note The ghost layers make neighbor blocks unnecessary for interpolation
+*/
+void BlockGeodesic::LoadNeighbors(void)
+{
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+
+\note Can be called from server processes only
+*/
+void BlockGeodesic::LoadVariables(void)
+{
+   ReadGeodesicGetBlockData(node, variables);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in]  zone          Zone (face, shell)
+\param[out] stencil_zones Zones in the stencil, not including "zone" itself
+\return Number of zones in the stencil
+*/
+int BlockGeodesic::StencilZones(const MultiIndex& zone, MultiIndex* stencil_zones) const
+{
+   int iv, face, n_zones = 0;
+
+// Lateral neighbors in the same shell
+   for(iv = 0; iv < verts_per_face; iv++) {
+      face = ff[zone.i * verts_per_face + iv];
+      if(face >= 0) stencil_zones[n_zones++] = MultiIndex(face, zone.j, 0);
+   };
+
+// Radial neighbors
+   if(zone.j > 0) stencil_zones[n_zones++] = MultiIndex(zone.i, zone.j - 1, 0);
+   if(zone.j < n_shells - 1) stencil_zones[n_zones++] = MultiIndex(zone.i, zone.j + 1, 0);
+
+   return n_zones;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+
+\note Must be called after the geometry was loaded or received
+*/
+void BlockGeodesic::ConfigureGeometry(void)
+{
+   int face, shell, iz, iv, nbr, n_zones;
+   double dot, best_dot = -2.0, r_max;
+   MultiIndex zone, stencil_zones[max_stencil_geodesic];
+   GeoVector sector_cent = gv_zeros, dr;
+   GeoMatrix normal;
+
+   r_min_phys = r_in[ghost_height];
+   r_max_phys = r_in[n_shells - ghost_height];
+   r_max = r_in[n_shells];
+
+// The bounding cube of the block is only used to describe the block to the base class
+   face_min = -r_max * gv_ones;
+   face_max = r_max * gv_ones;
+   face_min_phys = -r_max_phys * gv_ones;
+   face_max_phys = r_max_phys * gv_ones;
+
+// The walk to find the zone starts from the interior face closest to the middle of the sector
+   for(iv = 0; iv < verts_per_face; iv++) sector_cent += corners[iv];
+   sector_cent.Normalize();
+   center = sector_cent * 0.5 * (r_min_phys + r_max_phys);
+
+   for(face = 0; face < n_faces; face++) {
+      face_spacing[face] = M_PI;
+      for(iv = 0; iv < verts_per_face; iv++) {
+         nbr = ff[face * verts_per_face + iv];
+         if(nbr >= 0) face_spacing[face] = fmin(face_spacing[face], acos(fmin(face_cent[face] * face_cent[nbr], 1.0)));
+      };
+      if(!interior[face]) continue;
+      dot = face_cent[face] * sector_cent;
+      if(dot > best_dot) {
+         best_dot = dot;
+         start_face = face;
+      };
+   };
+
+// Invert the least squares normal matrix of each zone. Singular stencils produce a zero matrix, reducing the reconstruction to zeroth order.
+   for(shell = 0; shell < n_shells; shell++) {
+      zone.j = shell;
+      for(face = 0; face < n_faces; face++) {
+         zone.i = face;
+         normal = gm_zeros;
+         n_zones = StencilZones(zone, stencil_zones);
+         for(iz = 0; iz < n_zones; iz++) {
+            dr = ZoneCenter(stencil_zones[iz]) - ZoneCenter(zone);
+            normal += Dyadic(dr);
+         };
+         if(fabs(normal.Det()) > sp_tiny * Cube(Sqr(ZoneSize(zone)))) lsq_inverse[DataLoc(0, zone) / n_variables] = normal.Inverse();
+         else lsq_inverse[DataLoc(0, zone) / n_variables] = gm_zeros;
+      };
+   };
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] pos Position
+\return True if the position is in the interior of the block
+*/
+bool BlockGeodesic::PositionInside(const GeoVector& pos) const
+{
+   double r = pos.Norm();
+   if((r < r_min_phys) || (r > r_max_phys)) return false;
+   return InsideSphericalPolygon(verts_per_face, corners, pos);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] pos        Position (need not be normalized)
+\param[in] first_face Face to start the walk from, or -1 to use the middle of the sector
+\return Face whose center is closest to the direction of "pos"
+
+\note The walk moves to the neighbor whose center is closest to "pos" until no neighbor is closer. On a geodesic grid this takes a number of steps proportional to the angular distance.
+*/
+int BlockGeodesic::FindFace(const GeoVector& pos, int first_face) const
+{
+   int iv, nbr, face, best_face;
+   double dot, best_dot;
+
+   best_face = (first_face >= 0 ? first_face : start_face);
+   best_dot = face_cent[best_face] * pos;
+   do {
+      face = best_face;
+      for(iv = 0; iv < verts_per_face; iv++) {
+         nbr = ff[face * verts_per_face + iv];
+         if(nbr < 0) continue;
+         dot = face_cent[nbr] * pos;
+         if(dot > best_dot) {
+            best_dot = dot;
+            best_face = nbr;
+         };
+      };
+   } while(best_face != face);
+
+   return face;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] r Radial distance
+\return Shell containing "r", clamped to the block
+*/
+int BlockGeodesic::FindShell(double r) const
+{
+   int shell = std::upper_bound(r_in, r_in + n_shells + 1, r) - r_in - 1;
+   return std::clamp(shell, 0, n_shells - 1);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] zone Zone (face, shell)
+\return Smaller of the radial and lateral sizes of the zone
+*/
+double BlockGeodesic::ZoneSize(const MultiIndex& zone) const
+{
+   return fmin(r_in[zone.j + 1] - r_in[zone.j], ShellCenter(zone.j) * face_spacing[zone.i]);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in]  zone     Zone (face, shell)
+\param[out] grads    Gradients of all variables, [var][xyz]
+\param[out] gradBmag Gradient of the magnitude of the magnetic field
+*/
+void BlockGeodesic::LeastSquaresGradients(const MultiIndex& zone, double* grads, GeoVector& gradBmag) const
+{
+   int iz, vidx, n_zones;
+   double dvar, Bmag0;
+   MultiIndex stencil_zones[max_stencil_geodesic];
+   GeoVector dr, rhs, Bvec;
+   const GeoMatrix& lsq = lsq_inverse[DataLoc(0, zone) / n_variables];
+   const double* vars0 = variables + DataLoc(0, zone);
+   const double* vars1;
+
+   for(vidx = 0; vidx < 3 * n_variables; vidx++) grads[vidx] = 0.0;
+   gradBmag = gv_zeros;
+
+   Bmag0 = GeoVector(vars0 + SERVER_VAR_INDEX_MAG).Norm();
+   n_zones = StencilZones(zone, stencil_zones);
+
+// Accumulate the right hand sides. The normal matrix is applied at the end because it is the same for all variables.
+   for(iz = 0; iz < n_zones; iz++) {
+      dr = ZoneCenter(stencil_zones[iz]) - ZoneCenter(zone);
+      vars1 = variables + DataLoc(0, stencil_zones[iz]);
+      for(vidx = 0; vidx < n_variables; vidx++) {
+         dvar = vars1[vidx] - vars0[vidx];
+         grads[3 * vidx    ] += dvar * dr[0];
+         grads[3 * vidx + 1] += dvar * dr[1];
+         grads[3 * vidx + 2] += dvar * dr[2];
+      };
+      Bvec = GeoVector(vars1 + SERVER_VAR_INDEX_MAG);
+      gradBmag += (Bvec.Norm() - Bmag0) * dr;
+   };
+
+   for(vidx = 0; vidx < n_variables; vidx++) {
+      rhs = GeoVector(grads + 3 * vidx);
+      rhs = lsq * rhs;
+      for(auto xyz = 0; xyz < 3; xyz++) grads[3 * vidx + xyz] = rhs[xyz];
+   };
+   gradBmag = lsq * gradBmag;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] pos Coordinates of a point
+\return Which side of the block center the point is on (1 or 2) in each dimension
+*/
+MultiIndex BlockGeodesic::GetQuadrant(const GeoVector& pos) const
+{
+   MultiIndex quadrant;
+   for(auto xyz = 0; xyz < 3; xyz++) {
+      quadrant[xyz] = (pos[xyz] < center[xyz] ? 1 : 2);
+   };
+   return quadrant;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] level_idx Position in the "neighbor_levels" array
+\return Relative refinement level of the neighbor block
+*/
+int BlockGeodesic::GetNeighborLevel(const MultiIndex& level_idx) const
+{
+   return 0;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] i x-position in the "neighbor_levels" array
+\param[in] j y-position in the "neighbor_levels" array
+\param[in] k z-position in the "neighbor_levels" array
+\return Relative refinement level of the neighbor block
+*/
+int BlockGeodesic::GetNeighborLevel(int i, int j, int k) const
+{
+   return 0;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] node_idx Position in the "neighbor_nodes" array
+\return Node of the neighbor block (always -1, the neighbors are not stored)
+*/
+int BlockGeodesic::GetNeighborNode(const MultiIndex& node_idx) const
+{
+   return -1;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] i x-position in the "neighbor_nodes" array
+\param[in] j y-position in the "neighbor_nodes" array
+\param[in] k z-position in the "neighbor_nodes" array
+\return Node of the neighbor block (always -1, the neighbors are not stored)
+*/
+int BlockGeodesic::GetNeighborNode(int i, int j, int k) const
+{
+   return -1;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+void BlockGeodesic::PrintVariables(void) const
+{
+   int face, shell, n;
+   std::cerr << std::setprecision(8);
+   for(shell = 0; shell < n_shells; shell++) {
+      for(face = 0; face < n_faces; face++) {
+         for(n = 0; n < n_variables; n++) std::cerr << std::setw(16) << variables[DataLoc(n, face, shell, 0)];
+         std::cerr << std::endl;
+      };
+   };
+};
+
+#ifdef GEO_DEBUG
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+void BlockGeodesic::PrintNeighbors(void)
+{
+   std::cerr << "Block " << node << " has no neighbor list, ghost layers are stored instead\n";
+};
+
+#endif
+
+};
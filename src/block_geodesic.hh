@@ -0,0 +1,273 @@
+/*!
+\file block_geodesic.hh
+\brief Defines a class to operate on geodesic grid blocks
+\author Swati Sharma
+
+This file is part of the SPECTRUM suite of scientific numerical simulation codes. SPECTRUM stands for Space Plasma and Energetic Charged particle TRansport on Unstructured Meshes. The code simulates plasma or neutral particle flows using MHD equations on a grid, transport of cosmic rays using stochastic or grid based methods. The "unstructured" part refers to the use of a geodesic mesh providing a uniform coverage of the surface of a sphere.
+*/
+
+#ifndef SPECTRUM_BLOCK_GEODESIC_HH
+#define SPECTRUM_BLOCK_GEODESIC_HH
+
+#include "block_base.hh"
+#include "common/matrix.hh"
+
+namespace Spectrum {
+
+//! Largest number of zones in a least squares stencil (six lateral neighbors and two radial neighbors)
+const int max_stencil_geodesic = 8;
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// BlockGeodesic class declaration
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\brief A sector of a spherical shell partitioned into zones
+\author Swati Sharma
+
+This class corresponds to a single block of a geodesic grid simulation, i.e., one sector of the tesselation restricted to one radial slab. The faces of the sector, including the ghost faces, are the first index of the zone and the shells, including the ghost shells, are the second. Because the ghost layers are part of the block, all interpolation stencils are local. Each zone carries a least squares gradient operator built from its lateral neighbors and the zones directly above and below it.
+*/
+class BlockGeodesic : public BlockBase {
+
+protected:
+
+//! Number of vertices per face (persistent)
+   int verts_per_face;
+
+//! Number of faces, including ghost faces (persistent)
+   int n_faces;
+
+//! Number of shells, including ghost shells (persistent)
+   int n_shells;
+
+//! Number of ghost shells on each side (persistent)
+   int ghost_height;
+
+//! Inner radius of the physical part of the block
+   double r_min_phys = 1.0;
+
+//! Outer radius of the physical part of the block
+   double r_max_phys = 0.0;
+
+//! Face used to start the walk when no better guess is available
+   int start_face = 0;
+
+//! Sector corners
+   GeoVector* corners = nullptr;
+
+//! Face centers on the unit sphere
+   GeoVector* face_cent = nullptr;
+
+//! Face neighbors
+   int* ff = nullptr;
+
+//! Interior face flags
+   int* interior = nullptr;
+
+//! Radial interfaces
+   double* r_in = nullptr;
+
+//! Smallest angular distance from a face center to its neighbors
+   double* face_spacing = nullptr;
+
+//! Inverse least squares normal matrices, one per zone
+   GeoMatrix* lsq_inverse = nullptr;
+
+//! Allocate memory for variables and geometry
+   void AllocateMemory(void);
+
+//! Return the radius of a zone center
+   double ShellCenter(int shell) const;
+
+//! Return the position of a zone center
+   GeoVector ZoneCenter(const MultiIndex& zone) const;
+
+//! List the zones in the least squares stencil of a zone
+   int StencilZones(const MultiIndex& zone, MultiIndex* stencil_zones) const;
+
+public:
+
+//! Default constructor - disabled
+   BlockGeodesic(void) = delete;
+
+//! Constructor with arguments
+   BlockGeodesic(const int* dims);
+
+//! Destructor
+   ~BlockGeodesic() override;
+
+//! Obtain the geometry of the block from the reader
+   void LoadDimensions(double unit_length_block) override;
+
+//! No neighbor blocks are needed because of the ghost layers
+   void LoadNeighbors(void) override;
+
+//! Load all variables into the block from the reader
+   void LoadVariables(void) override;
+
+//! Build the stencils and other derived geometric data
+   void ConfigureGeometry(void);
+
+//! Check if a position is inside the block
+   bool PositionInside(const GeoVector& pos) const override;
+
+//! Return the face whose center is closest to a direction
+   int FindFace(const GeoVector& pos, int first_face = -1) const;
+
+//! Return the shell containing a radius
+   int FindShell(double r) const;
+
+//! Return the size of the smallest dimension of a zone
+   double ZoneSize(const MultiIndex& zone) const;
+
+//! Return the displacement from the zone center
+   GeoVector ZoneOffset(const MultiIndex& zone, const GeoVector& pos) const;
+
+//! Compute the least squares gradients of all variables and of |B| in a zone
+   void LeastSquaresGradients(const MultiIndex& zone, double* grads, GeoVector& gradBmag) const;
+
+//! Return the octant of the position relative to the zone center
+   MultiIndex GetQuadrant(const GeoVector& pos) const override;
+
+//! Return the refinement level of a neighbor - multi-index version
+   int GetNeighborLevel(const MultiIndex& level_idx) const override;
+
+//! Return the refinement level of a neighbor - three index version
+   int GetNeighborLevel(int i, int j, int k) const override;
+
+//! Return the node of a neighbor - multi-index version
+   int GetNeighborNode(const MultiIndex& node_idx) const override;
+
+//! Return the node of a neighbor - three index version
+   int GetNeighborNode(int i, int j, int k) const override;
+
+//! Return the number of sector corners
+   int GetCornerCount(void) const;
+
+//! Return the address of "corners"
+   GeoVector* GetCornersAddress(void);
+
+//! Return the address of "face_cent"
+   GeoVector* GetFaceCentAddress(void);
+
+//! Return the address of "ff"
+   int* GetFFAddress(void);
+
+//! Return the address of "interior"
+   int* GetInteriorAddress(void);
+
+//! Return the address of "r_in"
+   double* GetRadiiAddress(void);
+
+//! Print variables in block
+   void PrintVariables(void) const override;
+
+#ifdef GEO_DEBUG
+//! Print the indices of all neighbor blocks
+   void PrintNeighbors(void) override;
+#endif
+
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] shell Shell index
+\return Radius of the center of the shell
+*/
+inline double BlockGeodesic::ShellCenter(int shell) const
+{
+   return 0.5 * (r_in[shell] + r_in[shell + 1]);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] zone Zone (face, shell)
+\return Position of the zone center
+*/
+inline GeoVector BlockGeodesic::ZoneCenter(const MultiIndex& zone) const
+{
+   return face_cent[zone.i] * ShellCenter(zone.j);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] zone Zone (face, shell)
+\param[in] pos  Position
+\return Displacement of "pos" from the zone center
+*/
+inline GeoVector BlockGeodesic::ZoneOffset(const MultiIndex& zone, const GeoVector& pos) const
+{
+   return pos - ZoneCenter(zone);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return Number of elements in "corners"
+*/
+inline int BlockGeodesic::GetCornerCount(void) const
+{
+   return verts_per_face;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return Pointer to the sector corners
+*/
+inline GeoVector* BlockGeodesic::GetCornersAddress(void)
+{
+   return corners;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return Pointer to the face centers
+*/
+inline GeoVector* BlockGeodesic::GetFaceCentAddress(void)
+{
+   return face_cent;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return Pointer to the face neighbors
+*/
+inline int* BlockGeodesic::GetFFAddress(void)
+{
+   return ff;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return Pointer to the interior face flags
+*/
+inline int* BlockGeodesic::GetInteriorAddress(void)
+{
+   return interior;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return Pointer to the radial interfaces
+*/
+inline double* BlockGeodesic::GetRadiiAddress(void)
+{
+   return r_in;
+};
+
+//! Block type
+#if SERVER_TYPE == SERVER_GEODESIC
+typedef BlockGeodesic BlockType;
+#endif
+
+};
+
+#endif
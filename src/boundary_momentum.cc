@@ -68,7 +68,7 @@ void BoundaryMomentum::SetupBoundary(bool construct)
 */
 void BoundaryMomentum::EvaluateBoundary(void)
 {
-#if (TRAJ_TYPE == TRAJ_LORENTZ) || (TRAJ_TYPE == TRAJ_GUIDING) || (TRAJ_TYPE == TRAJ_GUIDING_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF_SCATT)
+#if (TRAJ_TYPE == TRAJ_LORENTZ) || (TRAJ_TYPE == TRAJ_HYBRID) || (TRAJ_TYPE == TRAJ_GUIDING) || (TRAJ_TYPE == TRAJ_GUIDING_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_BOUNCE)
    _delta = _mom.Norm() - momentum;
 #elif (TRAJ_TYPE == TRAJ_FOCUSED) || (TRAJ_TYPE == TRAJ_PARKER)
    _delta = _mom[0] - momentum;
@@ -168,11 +168,11 @@ void BoundaryMirror::SetupBoundary(bool construct)
 void BoundaryMirror::EvaluateBoundary(void)
 {
 // Delta is the parallel momentum component
-#if (TRAJ_TYPE == TRAJ_GUIDING) || (TRAJ_TYPE == TRAJ_GUIDING_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF_SCATT)
+#if (TRAJ_TYPE == TRAJ_GUIDING) || (TRAJ_TYPE == TRAJ_GUIDING_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_BOUNCE)
    _delta = _mom[2];
 #elif TRAJ_TYPE == TRAJ_FOCUSED
    _delta = _mom[0] * _mom[1];
-#elif TRAJ_TYPE == TRAJ_LORENTZ
+#elif (TRAJ_TYPE == TRAJ_LORENTZ) || (TRAJ_TYPE == TRAJ_HYBRID)
    _delta = _mom * bhat;
 #endif
 };
@@ -81,6 +81,28 @@ void DiffusionBase::SetupDiffusion(bool construct)
    Kappa = gv_zeros;
 };
 
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] t_in      Time
+\param[in] pos_in    Position
+\param[in] mom_in    Momentum (p,mu,phi) coordinates
+\param[in] spdata_in Spatial data at the required location
+*/
+void DiffusionBase::PrepareEvaluation(double t_in, const GeoVector& pos_in, const GeoVector& mom_in, const SpatialData& spdata_in)
+{
+   SetState(t_in, pos_in, mom_in);
+   vmag = Vel(_mom[0], specie);
+   _spdata._mask = spdata_in._mask;
+   _spdata = spdata_in;
+   Omega = CyclotronFrequency(vmag, _spdata.Bmag, specie);
+
+#if TRAJ_TYPE != TRAJ_PARKER
+   mu = _mom[1];
+   st2 = 1.0 - Sqr(mu);
+#endif
+};
+
 /*!
 \author Vladimir Florinski
 \date 05/09/2022
@@ -104,22 +126,32 @@ void DiffusionBase::EvaluateDiffusion(void)
 */
 double DiffusionBase::GetComponent(int comp, double t_in, const GeoVector& pos_in, const GeoVector& mom_in, const SpatialData& spdata_in)
 {
-   SetState(t_in, pos_in, mom_in);
-   vmag = Vel(_mom[0], specie);
-   _spdata._mask = spdata_in._mask;
-   _spdata = spdata_in;
-   Omega = CyclotronFrequency(vmag, _spdata.Bmag, specie);
-
-#if TRAJ_TYPE != TRAJ_PARKER
-   mu = _mom[1];
-   st2 = 1.0 - Sqr(mu);
-#endif
-
+   PrepareEvaluation(t_in, pos_in, mom_in, spdata_in);
    comp_eval = comp;
    EvaluateDiffusion();
    return Kappa[comp];
 };
 
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] t_in      Time
+\param[in] pos_in    Position
+\param[in] mom_in    Momentum (p,mu,phi) coordinates
+\param[in] spdata_in Spatial data at the required location
+\return All diffusion components
+\note Components that the model does not provide are zero. Because "comp_eval" is not a valid component index afterwards, "GetDirectionalDerivative()" and "GetMuDerivative()" must be preceded by "GetComponent()" instead.
+
+The "EvaluateDiffusion()" methods skip only the components that were not requested, so with "DIFF_ALL_COMPONENTS" they compute everything in one pass and share the intermediate quantities. Derived classes may override this if they have a faster joint evaluation.
+*/
+GeoVector DiffusionBase::GetComponents(double t_in, const GeoVector& pos_in, const GeoVector& mom_in, const SpatialData& spdata_in)
+{
+   PrepareEvaluation(t_in, pos_in, mom_in, spdata_in);
+   comp_eval = DIFF_ALL_COMPONENTS;
+   EvaluateDiffusion();
+   return Kappa;
+};
+
 /*!
 \author Juan G Alonso Guzman
 \author Vladimir Florinski
@@ -22,6 +22,9 @@ namespace Spectrum {
 //! The diffusion model is independent of the background
 const uint16_t DIFF_NOBACKGROUND = 0x0010;
 
+//! Value of "comp_eval" requesting all components at once
+const int DIFF_ALL_COMPONENTS = -1;
+
 //! Clone function pattern
 #define CloneFunctionDiffusion(T) std::unique_ptr<DiffusionBase> Clone(void) const override {return std::make_unique<T>();};
 
@@ -59,7 +62,7 @@ protected:
 //! Diffusion coefficient packed as a vector (transient)
    GeoVector Kappa;
 
-//! Flag telling which component to evaluate (transient)
+//! Flag telling which component to evaluate, or "DIFF_ALL_COMPONENTS" (transient)
    int comp_eval;
 
 //! Default constructor (protected, class not designed to be instantiated)
@@ -74,6 +77,9 @@ protected:
 //! Set up the diffusion model based on "params"
    virtual void SetupDiffusion(bool construct);
 
+//! Store the arguments and compute the quantities common to all components
+   void PrepareEvaluation(double t_in, const GeoVector& pos_in, const GeoVector& mom_in, const SpatialData& spdata_in);
+
 //! Compute the diffusion coefficients
    virtual void EvaluateDiffusion(void);
 
@@ -91,6 +97,9 @@ public:
 //! Evaluate and return one diffusion component
    double GetComponent(int comp, double t_in, const GeoVector& pos_in, const GeoVector& mom_in, const SpatialData& spdata_in);
 
+//! Evaluate and return all diffusion components in a single pass
+   virtual GeoVector GetComponents(double t_in, const GeoVector& pos_in, const GeoVector& mom_in, const SpatialData& spdata_in);
+
 //! Compute derivative of diffusion coefficient in position or time. By default, it is computed numerically, but specific classes can override with analytic expressions.
    virtual double GetDirectionalDerivative(int xyz);
 
@@ -225,6 +225,25 @@ void DistributionBase::Dump(const std::string& file_name) const
 void DistributionBase::Restore(const std::string& file_name)
 {
 };
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] file_name  Export file name
+\param[in] phys_units Use physical units for output
+*/
+void DistributionBase::Export(const std::string& file_name, bool phys_units) const
+{
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] file_name Marginals file name
+*/
+void DistributionBase::DumpMarginals(const std::string& file_name) const
+{
+};
    
 /*!
 \author Vladimir Florinski
@@ -34,6 +34,9 @@ const uint16_t DISTRO_MOMENTUM = 0x0040;
 //! Function type to respond to different actions
 using WeightAction = std::function<void(void)>;
 
+//! Clone function pattern
+#define CloneFunctionDistribution(T) std::shared_ptr<DistributionBase> Clone(void) const override {return std::make_shared<T>();};
+
 /*!
 \brief A base class describing a generic binned distribution
 \author Vladimir Florinski
@@ -211,6 +214,12 @@ public:
 //! Restore the distribution from a dump file (stub)
    virtual void Restore(const std::string& file_name);
 
+//! Export the distribution in the self-describing binary format (stub)
+   virtual void Export(const std::string& file_name, bool phys_units) const;
+
+//! Dump all 1D and 2D marginals of the distribution to a file (stub)
+   virtual void DumpMarginals(const std::string& file_name) const;
+
 //! Print the reduced distribution in 1D (stub)
    virtual void Print1D(int ijk, const std::string& file_name, bool phys_units) const;
 
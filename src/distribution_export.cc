@@ -0,0 +1,550 @@
+/*!
+\file distribution_export.cc
+\brief Implements a self-describing binary format for distributions and the tools to post-process it
+\author Swati Sharma
+
+This file is part of the SPECTRUM suite of scientific numerical simulation codes. SPECTRUM stands for Space Plasma and Energetic Charged particle TRansport on Unstructured Meshes. The code simulates plasma or neutral particle flows using MHD equations on a grid, transport of cosmic rays using stochastic or grid based methods. The "unstructured" part refers to the use of a geodesic mesh providing a uniform coverage of the surface of a sphere.
+*/
+
+#include "distribution_export.hh"
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace Spectrum {
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in]  file_name File name
+\param[out] size      Size of the file in bytes
+\return Pointer to the mapped file, or nullptr if the file could not be mapped
+*/
+static const char* MapFile(const std::string& file_name, size_t& size)
+{
+   int fd;
+   void* data;
+   struct stat file_stat;
+
+   fd = open(file_name.c_str(), O_RDONLY);
+   if(fd == -1) return nullptr;
+   if((fstat(fd, &file_stat) == -1) || (file_stat.st_size < (off_t)sizeof(DistroExportHeader))) {
+      close(fd);
+      return nullptr;
+   };
+
+   size = file_stat.st_size;
+   data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+   close(fd);
+   if(data == MAP_FAILED) return nullptr;
+
+// The file is read once from beginning to end
+   madvise(data, size, MADV_SEQUENTIAL);
+   return (const char*)data;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in]  data     Mapped file
+\param[in]  size     Size of the file in bytes
+\param[out] n_edges  Total number of bin edges
+\param[out] n_values Total number of bins
+\return True if the header is valid and agrees with the file size
+*/
+static bool CheckLayout(const char* data, size_t size, int64_t& n_edges, int64_t& n_values)
+{
+   int ijk;
+   size_t expected;
+   const DistroExportHeader* header = (const DistroExportHeader*)data;
+
+   if(std::memcmp(header->magic, distro_export_magic, 8)) return false;
+   if(header->n_comp < 1) return false;
+
+   n_edges = 0;
+   n_values = 1;
+   for(ijk = 0; ijk < 3; ijk++) {
+      if(header->n_bins[ijk] < 1) return false;
+      n_edges += header->n_bins[ijk] + 1;
+      n_values *= header->n_bins[ijk];
+   };
+
+   expected = sizeof(DistroExportHeader) + n_edges * sizeof(double) + n_values * sizeof(int64_t)
+            + (header->has_variance ? 2 : 1) * n_values * header->n_comp * sizeof(double);
+   return (size == expected);
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// DistroExport methods
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+DistroExport::DistroExport(void)
+{
+   std::memset(&header, 0, sizeof(header));
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return Total number of bins
+*/
+int64_t DistroExport::NBins(void) const
+{
+   return (int64_t)header.n_bins[0] * header.n_bins[1] * header.n_bins[2];
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] i First index
+\param[in] j Second index
+\param[in] k Third index
+\return Linear index of the bin
+*/
+int64_t DistroExport::LinIdx(int i, int j, int k) const
+{
+   return header.n_bins[2] * ((int64_t)header.n_bins[1] * i + j) + k;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] ijk Which dimension
+\param[in] bin Bin number
+\return Center value for this bin
+*/
+double DistroExport::BinCent(int ijk, int bin) const
+{
+   if(header.log_bins[ijk] && (edges[ijk][bin] > 0.0)) return sqrt(edges[ijk][bin] * edges[ijk][bin + 1]);
+   else return 0.5 * (edges[ijk][bin] + edges[ijk][bin + 1]);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] other Distribution to compare with
+\return True if the bins and the weight format are identical
+*/
+bool DistroExport::Compatible(const DistroExport& other) const
+{
+   int ijk;
+
+   if(header.n_comp != other.header.n_comp) return false;
+   if(header.phys_units != other.header.phys_units) return false;
+   for(ijk = 0; ijk < 3; ijk++) {
+      if(header.n_bins[ijk] != other.header.n_bins[ijk]) return false;
+      if(header.log_bins[ijk] != other.header.log_bins[ijk]) return false;
+      if(edges[ijk] != other.edges[ijk]) return false;
+   };
+   return true;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] file_name File name
+\return True if the file was read successfully
+*/
+bool DistroExport::Read(const std::string& file_name)
+{
+   int ijk;
+   int64_t n_edges, n_values;
+   size_t size;
+   const char* data;
+   const double* edge_ptr;
+   const double* weight_ptr;
+
+   data = MapFile(file_name, size);
+   if(!data) return false;
+   if(!CheckLayout(data, size, n_edges, n_values)) {
+      munmap((void*)data, size);
+      return false;
+   };
+
+   std::memcpy(&header, data, sizeof(header));
+   edge_ptr = (const double*)(data + sizeof(header));
+   for(ijk = 0; ijk < 3; ijk++) {
+      edges[ijk].assign(edge_ptr, edge_ptr + header.n_bins[ijk] + 1);
+      edge_ptr += header.n_bins[ijk] + 1;
+   };
+
+   counts.assign((const int64_t*)edge_ptr, (const int64_t*)edge_ptr + n_values);
+   weight_ptr = (const double*)((const int64_t*)edge_ptr + n_values);
+   weights.assign(weight_ptr, weight_ptr + n_values * header.n_comp);
+   if(header.has_variance) variance.assign(weight_ptr + n_values * header.n_comp, weight_ptr + 2 * n_values * header.n_comp);
+   else variance.clear();
+
+   munmap((void*)data, size);
+   return true;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] file_name File name
+\return True if the file was added successfully
+
+If this object is empty the file is simply read. Otherwise the counts and weights are added directly from the mapped file. The variance is kept only if both operands have it.
+*/
+bool DistroExport::AddFile(const std::string& file_name)
+{
+   int ijk;
+   int64_t n_edges, n_values, idx;
+   size_t size;
+   const char* data;
+   const double* edge_ptr;
+   const int64_t* count_ptr;
+   const double* weight_ptr;
+   const DistroExportHeader* header_in;
+
+   if(counts.empty()) return Read(file_name);
+
+   data = MapFile(file_name, size);
+   if(!data) return false;
+   if(!CheckLayout(data, size, n_edges, n_values)) {
+      munmap((void*)data, size);
+      return false;
+   };
+
+// Check that the layout is the same
+   header_in = (const DistroExportHeader*)data;
+   edge_ptr = (const double*)(data + sizeof(header));
+   bool compatible = (header_in->n_comp == header.n_comp) && (header_in->phys_units == header.phys_units);
+   for(ijk = 0; compatible && (ijk < 3); ijk++) {
+      compatible = (header_in->n_bins[ijk] == header.n_bins[ijk]) && (header_in->log_bins[ijk] == header.log_bins[ijk])
+                && std::equal(edges[ijk].begin(), edges[ijk].end(), edge_ptr);
+      edge_ptr += header.n_bins[ijk] + 1;
+   };
+   if(!compatible) {
+      munmap((void*)data, size);
+      return false;
+   };
+
+   count_ptr = (const int64_t*)edge_ptr;
+   weight_ptr = (const double*)(count_ptr + n_values);
+   for(idx = 0; idx < n_values; idx++) counts[idx] += count_ptr[idx];
+   for(idx = 0; idx < n_values * header.n_comp; idx++) weights[idx] += weight_ptr[idx];
+   if(header.has_variance && header_in->has_variance) {
+      weight_ptr += n_values * header.n_comp;
+      for(idx = 0; idx < n_values * header.n_comp; idx++) variance[idx] += weight_ptr[idx];
+   }
+   else {
+      header.has_variance = 0;
+      variance.clear();
+   };
+   header.n_events += header_in->n_events;
+
+   munmap((void*)data, size);
+   return true;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] file_name File name
+\return True if the file was written successfully
+*/
+bool DistroExport::Write(const std::string& file_name) const
+{
+   int ijk;
+
+   std::ofstream outfile(file_name.c_str(), std::ofstream::binary);
+   if(!outfile.is_open()) return false;
+
+   outfile.write((const char*)&header, sizeof(header));
+   for(ijk = 0; ijk < 3; ijk++) outfile.write((const char*)edges[ijk].data(), edges[ijk].size() * sizeof(double));
+   outfile.write((const char*)counts.data(), counts.size() * sizeof(int64_t));
+   outfile.write((const char*)weights.data(), weights.size() * sizeof(double));
+   if(header.has_variance) outfile.write((const char*)variance.data(), variance.size() * sizeof(double));
+   return outfile.good();
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] other Distribution to add (must be compatible)
+\return Reference to this object
+*/
+DistroExport& DistroExport::operator +=(const DistroExport& other)
+{
+   std::transform(counts.begin(), counts.end(), other.counts.begin(), counts.begin(), std::plus<int64_t>{});
+   std::transform(weights.begin(), weights.end(), other.weights.begin(), weights.begin(), std::plus<double>{});
+   if(header.has_variance && other.header.has_variance) {
+      std::transform(variance.begin(), variance.end(), other.variance.begin(), variance.begin(), std::plus<double>{});
+   }
+   else {
+      header.has_variance = 0;
+      variance.clear();
+   };
+   header.n_events += other.header.n_events;
+   return *this;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] factor Scaling factor
+*/
+void DistroExport::Scale(double factor)
+{
+   for(auto& weight : weights) weight *= factor;
+   for(auto& var : variance) var *= factor * factor;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] mode Normalization type, one of the DISTRO_NORM_XXX constants
+
+After a normalization by counts or by width the weights are no longer sums, and adding such distributions is meaningless.
+*/
+void DistroExport::Normalize(int mode)
+{
+   int i, j, k, comp;
+   int64_t idx;
+   double factor;
+   std::vector<double> total(header.n_comp, 0.0);
+
+   switch(mode) {
+
+   case DISTRO_NORM_COUNTS:
+      for(idx = 0; idx < NBins(); idx++) {
+         factor = (counts[idx] ? 1.0 / counts[idx] : 0.0);
+         for(comp = 0; comp < (int)header.n_comp; comp++) {
+            weights[idx * header.n_comp + comp] *= factor;
+            if(header.has_variance) variance[idx * header.n_comp + comp] *= factor * factor;
+         };
+      };
+      break;
+
+   case DISTRO_NORM_EVENTS:
+      if(header.n_events) Scale(1.0 / header.n_events);
+      break;
+
+   case DISTRO_NORM_WIDTH:
+      for(i = 0; i < header.n_bins[0]; i++) {
+         for(j = 0; j < header.n_bins[1]; j++) {
+            for(k = 0; k < header.n_bins[2]; k++) {
+               factor = 1.0;
+               if(header.dims & 1) factor *= edges[0][i + 1] - edges[0][i];
+               if(header.dims & 2) factor *= edges[1][j + 1] - edges[1][j];
+               if(header.dims & 4) factor *= edges[2][k + 1] - edges[2][k];
+               idx = LinIdx(i, j, k);
+               for(comp = 0; comp < (int)header.n_comp; comp++) {
+                  weights[idx * header.n_comp + comp] /= factor;
+                  if(header.has_variance) variance[idx * header.n_comp + comp] /= factor * factor;
+               };
+            };
+         };
+      };
+      break;
+
+   case DISTRO_NORM_TOTAL:
+      for(idx = 0; idx < NBins(); idx++) {
+         for(comp = 0; comp < (int)header.n_comp; comp++) total[comp] += weights[idx * header.n_comp + comp];
+      };
+      for(idx = 0; idx < NBins(); idx++) {
+         for(comp = 0; comp < (int)header.n_comp; comp++) {
+            if(total[comp] == 0.0) continue;
+            weights[idx * header.n_comp + comp] /= total[comp];
+            if(header.has_variance) variance[idx * header.n_comp + comp] /= total[comp] * total[comp];
+         };
+      };
+      break;
+   };
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] ijk   Which dimension
+\param[in] first First bin to keep
+\param[in] last  One past the last bin to keep
+\return Distribution with the selected range of bins
+*/
+DistroExport DistroExport::Slice(int ijk, int first, int last) const
+{
+   int bin[3], comp;
+   int64_t idx_in, idx_out;
+   DistroExport result;
+
+   first = std::clamp(first, 0, header.n_bins[ijk] - 1);
+   last = std::clamp(last, first + 1, header.n_bins[ijk]);
+
+   result.header = header;
+   result.header.n_bins[ijk] = last - first;
+   for(int d = 0; d < 3; d++) result.edges[d] = edges[d];
+   result.edges[ijk].assign(edges[ijk].begin() + first, edges[ijk].begin() + last + 1);
+   result.counts.assign(result.NBins(), 0);
+   result.weights.assign(result.NBins() * header.n_comp, 0.0);
+   if(header.has_variance) result.variance.assign(result.NBins() * header.n_comp, 0.0);
+
+   for(bin[0] = 0; bin[0] < result.header.n_bins[0]; bin[0]++) {
+      for(bin[1] = 0; bin[1] < result.header.n_bins[1]; bin[1]++) {
+         for(bin[2] = 0; bin[2] < result.header.n_bins[2]; bin[2]++) {
+            idx_out = result.LinIdx(bin[0], bin[1], bin[2]);
+            bin[ijk] += first;
+            idx_in = LinIdx(bin[0], bin[1], bin[2]);
+            bin[ijk] -= first;
+
+            result.counts[idx_out] = counts[idx_in];
+            for(comp = 0; comp < (int)header.n_comp; comp++) {
+               result.weights[idx_out * header.n_comp + comp] = weights[idx_in * header.n_comp + comp];
+               if(header.has_variance) result.variance[idx_out * header.n_comp + comp] = variance[idx_in * header.n_comp + comp];
+            };
+         };
+      };
+   };
+
+   return result;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] factor Number of bins to merge in each dimension
+\return Distribution with merged bins
+
+If the number of bins is not divisible by the factor, the last bin is made of the remaining bins.
+*/
+DistroExport DistroExport::Rebin(const int factor[3]) const
+{
+   int d, bin[3], f[3], comp;
+   int64_t idx_in, idx_out;
+   DistroExport result;
+
+   result.header = header;
+   for(d = 0; d < 3; d++) {
+      f[d] = std::max(factor[d], 1);
+      result.header.n_bins[d] = (header.n_bins[d] + f[d] - 1) / f[d];
+      result.edges[d].resize(result.header.n_bins[d] + 1);
+      for(bin[d] = 0; bin[d] < result.header.n_bins[d]; bin[d]++) result.edges[d][bin[d]] = edges[d][bin[d] * f[d]];
+      result.edges[d].back() = edges[d].back();
+   };
+   result.counts.assign(result.NBins(), 0);
+   result.weights.assign(result.NBins() * header.n_comp, 0.0);
+   if(header.has_variance) result.variance.assign(result.NBins() * header.n_comp, 0.0);
+
+   for(bin[0] = 0; bin[0] < header.n_bins[0]; bin[0]++) {
+      for(bin[1] = 0; bin[1] < header.n_bins[1]; bin[1]++) {
+         for(bin[2] = 0; bin[2] < header.n_bins[2]; bin[2]++) {
+            idx_in = LinIdx(bin[0], bin[1], bin[2]);
+            idx_out = result.LinIdx(bin[0] / f[0], bin[1] / f[1], bin[2] / f[2]);
+
+            result.counts[idx_out] += counts[idx_in];
+            for(comp = 0; comp < (int)header.n_comp; comp++) {
+               result.weights[idx_out * header.n_comp + comp] += weights[idx_in * header.n_comp + comp];
+               if(header.has_variance) result.variance[idx_out * header.n_comp + comp] += variance[idx_in * header.n_comp + comp];
+            };
+         };
+      };
+   };
+
+   return result;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] ijk Dimension to keep
+\return One-dimensional distribution
+*/
+DistroExport DistroExport::Project(int ijk) const
+{
+   int d, factor[3];
+
+   for(d = 0; d < 3; d++) factor[d] = (d == ijk ? 1 : header.n_bins[d]);
+   DistroExport result = Rebin(factor);
+   result.header.dims &= (1 << ijk);
+   return result;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] file_name Text file name
+
+Each line contains the bin centers in the active dimensions, the weight components, their standard deviations (if the variance is available), and the number of events.
+*/
+void DistroExport::PrintText(const std::string& file_name) const
+{
+   int i, j, k, comp;
+   int64_t idx;
+
+   std::ofstream outfile(file_name.c_str());
+   outfile << "# Distribution: " << std::string(header.class_name, strnlen(header.class_name, sizeof(header.class_name))) << std::endl;
+   outfile << "# Total number of events: " << header.n_events << std::endl;
+   outfile << "# Physical units: " << (header.phys_units ? "yes" : "no") << std::endl << std::endl;
+
+   outfile << std::setprecision(10);
+   for(i = 0; i < header.n_bins[0]; i++) {
+      for(j = 0; j < header.n_bins[1]; j++) {
+         for(k = 0; k < header.n_bins[2]; k++) {
+            idx = LinIdx(i, j, k);
+            if(header.dims & 1) outfile << std::setw(20) << BinCent(0, i);
+            if(header.dims & 2) outfile << std::setw(20) << BinCent(1, j);
+            if(header.dims & 4) outfile << std::setw(20) << BinCent(2, k);
+            for(comp = 0; comp < (int)header.n_comp; comp++) outfile << std::setw(20) << weights[idx * header.n_comp + comp];
+            if(header.has_variance) {
+               for(comp = 0; comp < (int)header.n_comp; comp++) outfile << std::setw(20) << sqrt(variance[idx * header.n_comp + comp]);
+            };
+            outfile << std::setw(20) << counts[idx] << std::endl;
+         };
+      };
+   };
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in]  file_names Files to add
+\param[out] total      Sum of all files
+\return True if all files were read and are compatible
+
+Each thread accumulates its share of the files into its own partial sum, and the partial sums are added at the end.
+*/
+bool DistroExport::SumFiles(const std::vector<std::string>& file_names, DistroExport& total)
+{
+   int n_threads = 1;
+   bool success = true;
+
+#ifdef _OPENMP
+   n_threads = std::max(std::min(omp_get_max_threads(), (int)file_names.size()), 1);
+#endif
+   std::vector<DistroExport> partial(n_threads);
+
+#pragma omp parallel for schedule(dynamic) num_threads(n_threads) reduction(&&:success)
+   for(int file = 0; file < file_names.size(); file++) {
+#ifdef _OPENMP
+      int thr = omp_get_thread_num();
+#else
+      int thr = 0;
+#endif
+      if(!partial[thr].AddFile(file_names[file])) success = false;
+   };
+
+   total = DistroExport();
+   for(auto& part : partial) {
+      if(part.counts.empty()) continue;
+      if(total.counts.empty()) total = part;
+      else if(total.Compatible(part)) total += part;
+      else success = false;
+   };
+
+   return success && !total.counts.empty();
+};
+
+};
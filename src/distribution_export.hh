@@ -0,0 +1,157 @@
+/*!
+\file distribution_export.hh
+\brief Declares a self-describing binary format for distributions and the tools to post-process it
+\author Swati Sharma
+
+This file is part of the SPECTRUM suite of scientific numerical simulation codes. SPECTRUM stands for Space Plasma and Energetic Charged particle TRansport on Unstructured Meshes. The code simulates plasma or neutral particle flows using MHD equations on a grid, transport of cosmic rays using stochastic or grid based methods. The "unstructured" part refers to the use of a geodesic mesh providing a uniform coverage of the surface of a sphere.
+*/
+
+#ifndef SPECTRUM_DISTRIBUTION_EXPORT_HH
+#define SPECTRUM_DISTRIBUTION_EXPORT_HH
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Spectrum {
+
+//! Identifier at the beginning of an exported distribution file
+const char distro_export_magic[8] = {'S', 'P', 'D', 'I', 'S', 'T', '0', '1'};
+
+//! Normalization: divide the weights in each bin by the number of events in that bin
+const int DISTRO_NORM_COUNTS = 0;
+
+//! Normalization: divide the weights by the total number of events
+const int DISTRO_NORM_EVENTS = 1;
+
+//! Normalization: divide the weights by the bin volume in the active dimensions
+const int DISTRO_NORM_WIDTH = 2;
+
+//! Normalization: divide the weights by their sum (component by component)
+const int DISTRO_NORM_TOTAL = 3;
+
+/*!
+\brief File header of an exported distribution
+\author Swati Sharma
+
+The size of the header is a multiple of 8 bytes, so that all arrays following it are aligned in a mapped file.
+*/
+struct DistroExportHeader {
+
+//! File identifier
+   char magic[8];
+
+//! Number of components of a weight (1 for scalar, 3 for vector, 9 for matrix distributions, or one per parameter set for multi-weight distributions)
+   uint32_t n_comp;
+
+//! Active dimensions as a bitset
+   uint32_t dims;
+
+//! Number of bins in each dimension
+   int32_t n_bins[3];
+
+//! Whether the bins are logarithmic in each dimension
+   int32_t log_bins[3];
+
+//! Whether the edges and weights are in physical units
+   uint32_t phys_units;
+
+//! Whether the variance of the weights is present
+   uint32_t has_variance;
+
+//! Total number of events
+   int64_t n_events;
+
+//! Physical units of the bin variables
+   double unit_val[3];
+
+//! Physical units of the weight components (the first nine only)
+   double unit_distro[9];
+
+//! Class name of the distribution that produced the file
+   char class_name[64];
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// DistroExport class declaration
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\brief An exported distribution in memory with the operations needed for post-processing
+\author Swati Sharma
+
+File layout: a "DistroExportHeader", the bin edges for each of the three dimensions ("n_bins+1" doubles each), the event counts (int64, one per bin), the summed weights ("n_comp" doubles per bin), and, if "has_variance" is set, the variance of the summed weights in the same layout. Bins are ordered as in "MultiIndex::LinIdx()", i.e., the last dimension varies fastest. The weights are sums over events, exactly as accumulated by the simulation, so files from independent runs can be added. Files are read through a memory map, so adding many files only touches each page once.
+
+This class does not depend on the trajectory type or the distribution classes, so it can be used by stand-alone tools.
+*/
+class DistroExport {
+
+public:
+
+//! File header
+   DistroExportHeader header;
+
+//! Bin edges
+   std::vector<double> edges[3];
+
+//! Number of events in each bin
+   std::vector<int64_t> counts;
+
+//! Summed weights
+   std::vector<double> weights;
+
+//! Variance of the summed weights (empty if not available)
+   std::vector<double> variance;
+
+//! Default constructor
+   DistroExport(void);
+
+//! Return the total number of bins
+   int64_t NBins(void) const;
+
+//! Linear index of a bin
+   int64_t LinIdx(int i, int j, int k) const;
+
+//! Center of a bin (log-center for logarithmic bins)
+   double BinCent(int ijk, int bin) const;
+
+//! Check whether another distribution has the same layout
+   bool Compatible(const DistroExport& other) const;
+
+//! Read a file
+   bool Read(const std::string& file_name);
+
+//! Add the contents of a file without copying it first
+   bool AddFile(const std::string& file_name);
+
+//! Write a file
+   bool Write(const std::string& file_name) const;
+
+//! Add another distribution
+   DistroExport& operator +=(const DistroExport& other);
+
+//! Multiply the weights by a factor
+   void Scale(double factor);
+
+//! Normalize the weights
+   void Normalize(int mode);
+
+//! Keep a range of bins in one dimension
+   DistroExport Slice(int ijk, int first, int last) const;
+
+//! Merge groups of adjacent bins
+   DistroExport Rebin(const int factor[3]) const;
+
+//! Sum over all dimensions except one
+   DistroExport Project(int ijk) const;
+
+//! Write the distribution as a text table
+   void PrintText(const std::string& file_name) const;
+
+//! Sum many files in parallel
+   static bool SumFiles(const std::vector<std::string>& file_names, DistroExport& total);
+};
+
+};
+
+#endif
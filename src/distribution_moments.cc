@@ -0,0 +1,472 @@
+/*!
+\file distribution_moments.cc
+\brief Implements a binless distribution that accumulates weighted moments and directional harmonics of events
+\author Swati Sharma
+
+This file is part of the SPECTRUM suite of scientific numerical simulation codes. SPECTRUM stands for Space Plasma and Energetic Charged particle TRansport on Unstructured Meshes. The code simulates plasma or neutral particle flows using MHD equations on a grid, transport of cosmic rays using stochastic or grid based methods. The "unstructured" part refers to the use of a geodesic mesh providing a uniform coverage of the surface of a sphere.
+*/
+
+#include "distribution_moments.hh"
+#include "common/physics.hh"
+#include "common/print_warn.hh"
+#include <iomanip>
+
+namespace Spectrum {
+
+//! Physical units of the quantities
+const double moment_quantity_units[MOMENT_QUANTITIES] = {unit_time_fluid, unit_length_fluid, unit_length_fluid, unit_length_fluid,
+                                                         unit_length_fluid, unit_length_fluid, unit_length_fluid, unit_length_fluid,
+                                                         unit_momentum_particle, unit_energy_particle, 1.0};
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// DistributionMoments methods
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+DistributionMoments::DistributionMoments(void)
+                   : DistributionBase(dist_name_moments, 0, STATE_NONE)
+{
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] other Object to initialize from
+
+A copy constructor should first first call the Params' version to copy the data container and then check whether the other object has been set up. If yes, it should simply call the virtual method "SetupDistribution()" with the argument of "true".
+*/
+DistributionMoments::DistributionMoments(const DistributionMoments& other)
+                   : DistributionBase(other)
+{
+   if(BITS_RAISED(other._status, STATE_SETUP_COMPLETE)) SetupDistribution(true);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] construct Whether called from a copy constructor or separately
+
+The accumulator is presented to the rest of the code as a 1D distribution with one "bin" per element, so that the existing reduction in the simulation classes exchanges it without modification. Only the first element of "counts" is used.
+*/
+void DistributionMoments::SetupDistribution(bool construct)
+{
+   int l, m, k;
+   double fact_ratio;
+
+   LOWER_BITS(_status, STATE_SETUP_COMPLETE);
+   LOWER_BITS(_status, STATE_INVALID);
+
+   container.Reset();
+   container.Read(&quantities);
+   container.Read(&powers);
+   container.Read(&l_max);
+   container.Read(&val_time);
+   container.Read(&val_hot);
+   container.Read(&val_cold);
+   keep_records = false;
+
+// Each quantity must have a power and the harmonic degree is limited
+   if(quantities.size() != powers.size()) return;
+   for(auto quantity : quantities) {
+      if((quantity < 0) || (quantity >= MOMENT_QUANTITIES)) return;
+   };
+   if(l_max > moments_max_lmax) return;
+   l_max = std::max(l_max, -1);
+
+// Normalization of the associated Legendre functions, sqrt((2l+1)/(4pi) (l-m)!/(l+m)!), stored by "l(l+1)/2+m"
+   norm_lm.resize((l_max + 1) * (l_max + 2) / 2);
+   for(l = 0; l <= l_max; l++) {
+      for(m = 0; m <= l; m++) {
+         fact_ratio = 1.0;
+         for(k = l - m + 1; k <= l + m; k++) fact_ratio /= k;
+         norm_lm[l * (l + 1) / 2 + m] = sqrt((2 * l + 1) * fact_ratio / M_4PI);
+      };
+   };
+
+   n_obs = quantities.size() + Sqr(l_max + 1);
+   obs.resize(n_obs);
+   acc.resize(2 + 2 * n_obs);
+   n_bins = MultiIndex(acc.size(), 1, 1);
+   dims = 1;
+   counts.resize(acc.size());
+   ResetDistribution();
+
+// Place the actions into the table
+   ActionTable.clear();
+   ActionTable.push_back([this]() {MomentsHot();});
+   ActionTable.push_back([this]() {MomentsCold();});
+
+   RAISE_BITS(_status, STATE_SETUP_COMPLETE);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[out] mu  Pitch angle cosine
+\param[out] phi Gyrophase measured from "GetSecondUnitVec(bhat)"
+\return 2 if the direction is fully resolved, 1 if only "mu" is known (gyrotropic), or 0 if the distribution is isotropic
+*/
+int DistributionMoments::Direction(double& mu, double& phi) const
+{
+   const GeoVector& momentum = (val_time ? _mom2 : _mom);
+   phi = 0.0;
+
+#if (TRAJ_TYPE == TRAJ_LORENTZ) || (TRAJ_TYPE == TRAJ_HYBRID)
+   const GeoVector& bhat = (val_time ? _spdata2.bhat : _spdata.bhat);
+   GeoVector mom_hat = UnitVec(momentum);
+   GeoVector e1 = GetSecondUnitVec(bhat);
+   mu = mom_hat * bhat;
+   phi = atan2(mom_hat * (bhat ^ e1), mom_hat * e1);
+   return 2;
+#elif (TRAJ_TYPE == TRAJ_GUIDING) || (TRAJ_TYPE == TRAJ_GUIDING_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_BOUNCE)
+   mu = momentum[2] / momentum.Norm();
+   return 1;
+#elif TRAJ_TYPE == TRAJ_FOCUSED
+   mu = momentum[1];
+   return 1;
+#else
+   mu = 0.0;
+   return 0;
+#endif
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in]  mu       Cosine of the polar angle
+\param[in]  phi      Azimuthal angle
+\param[in]  symmetry Symmetry of the direction as returned by "Direction()"
+\param[out] ylm      Harmonics stored by "l^2+l+m"
+
+The associated Legendre functions are computed with the standard upward recurrence in "l" without the Condon-Shortley phase. Harmonics with "m > 0" use "cos(m phi)" and those with "m < 0" use "sin(|m| phi)".
+*/
+void DistributionMoments::Harmonics(double mu, double phi, int symmetry, double* ylm) const
+{
+   int l, m, m_max;
+   double plm[(moments_max_lmax + 1) * (moments_max_lmax + 2) / 2];
+   double sin_theta = sqrt(fmax(1.0 - Sqr(mu), 0.0));
+
+   for(l = 0; l <= l_max; l++) {
+      for(m = -l; m <= l; m++) ylm[l * l + l + m] = 0.0;
+   };
+   if(l_max < 0) return;
+   if(symmetry == 0) {
+      ylm[0] = norm_lm[0];
+      return;
+   };
+   m_max = (symmetry == 2 ? l_max : 0);
+
+// Diagonal, first off-diagonal, and the remaining terms of the recurrence
+   for(m = 0; m <= m_max; m++) {
+      plm[m * (m + 1) / 2 + m] = (m ? (2 * m - 1) * sin_theta * plm[(m - 1) * m / 2 + m - 1] : 1.0);
+      if(m < l_max) plm[(m + 1) * (m + 2) / 2 + m] = (2 * m + 1) * mu * plm[m * (m + 1) / 2 + m];
+      for(l = m + 2; l <= l_max; l++) {
+         plm[l * (l + 1) / 2 + m] = ((2 * l - 1) * mu * plm[(l - 1) * l / 2 + m] - (l + m - 1) * plm[(l - 2) * (l - 1) / 2 + m]) / (l - m);
+      };
+   };
+
+   for(l = 0; l <= l_max; l++) {
+      ylm[l * l + l] = norm_lm[l * (l + 1) / 2] * plm[l * (l + 1) / 2];
+      for(m = 1; m <= std::min(l, m_max); m++) {
+         ylm[l * l + l + m] = M_SQRT2 * norm_lm[l * (l + 1) / 2 + m] * plm[l * (l + 1) / 2 + m] * cos(m * phi);
+         ylm[l * l + l - m] = M_SQRT2 * norm_lm[l * (l + 1) / 2 + m] * plm[l * (l + 1) / 2 + m] * sin(m * phi);
+      };
+   };
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] quantity Which quantity to compute
+\return Value of the quantity
+*/
+double DistributionMoments::Quantity(int quantity) const
+{
+   double mu, phi;
+   const GeoVector& position = (val_time ? _pos2 : _pos);
+   const GeoVector& momentum = (val_time ? _mom2 : _mom);
+
+   switch(quantity) {
+
+   case MOMENT_TIME:
+      return _t2 - _t;
+
+   case MOMENT_POS_X:
+   case MOMENT_POS_Y:
+   case MOMENT_POS_Z:
+      return position[quantity - MOMENT_POS_X];
+
+   case MOMENT_DISP_X:
+   case MOMENT_DISP_Y:
+   case MOMENT_DISP_Z:
+      return _pos2[quantity - MOMENT_DISP_X] - _pos[quantity - MOMENT_DISP_X];
+
+   case MOMENT_RADIUS:
+      return position.Norm();
+
+// Focused and Parker trajectories store the momentum magnitude in the first component
+   case MOMENT_MOMENTUM:
+#if (TRAJ_TYPE == TRAJ_FOCUSED) || (TRAJ_TYPE == TRAJ_PARKER)
+      return momentum[0];
+#else
+      return momentum.Norm();
+#endif
+
+   case MOMENT_ENERGY:
+#if (TRAJ_TYPE == TRAJ_FOCUSED) || (TRAJ_TYPE == TRAJ_PARKER)
+      return EnrKin(momentum[0], specie);
+#else
+      return EnrKin(momentum.Norm(), specie);
+#endif
+
+   case MOMENT_PITCH:
+      Direction(mu, phi);
+      return mu;
+
+   default:
+      return 0.0;
+   };
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+void DistributionMoments::EvaluateValue(void)
+{
+   int ob, symmetry;
+   double mu, phi;
+
+   for(ob = 0; ob < quantities.size(); ob++) obs[ob] = pow(Quantity(quantities[ob]), powers[ob]);
+
+   if(l_max >= 0) {
+      symmetry = Direction(mu, phi);
+      Harmonics(mu, phi, symmetry, obs.data() + quantities.size());
+   };
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] action_in Action index from "ActionTable"
+*/
+void DistributionMoments::EvaluateWeight(int action_in)
+{
+   if((action_in < 0) || (action_in >= ActionTable.size())) {
+      PrintError(__FILE__, __LINE__, "Invalid action index", true);
+      _weight = 0.0;
+      return;
+   };
+   ActionTable[action_in]();
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+void DistributionMoments::MomentsHot(void)
+{
+   _weight = val_hot;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+void DistributionMoments::MomentsCold(void)
+{
+   _weight = val_cold;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+
+West's weighted update: "mean += (w / W) (x - mean)" and "S += w (x - mean_old) (x - mean_new)", where "W" already includes the new weight.
+*/
+void DistributionMoments::AddEvent(void)
+{
+   int ob;
+   double weight_new, ratio, delta;
+
+   counts[0]++;
+   n_events++;
+
+   weight_new = acc[0] + _weight;
+   if((_weight == 0.0) || (weight_new == 0.0)) return;
+   ratio = _weight / weight_new;
+
+   for(ob = 0; ob < n_obs; ob++) {
+      delta = obs[ob] - acc[2 + 2 * ob];
+      acc[2 + 2 * ob] += ratio * delta;
+      acc[3 + 2 * ob] += _weight * delta * (obs[ob] - acc[2 + 2 * ob]);
+   };
+
+   acc[0] = weight_new;
+   acc[1] += Sqr(_weight);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] other Second distribution
+\return Reference to this object
+
+The accumulators are combined with the formula of Chan et al.: "mean = mean_a + delta W_b / W" and "S = S_a + S_b + delta^2 W_a W_b / W", with "delta = mean_b - mean_a".
+*/
+DistributionBase& DistributionMoments::operator +=(const DistributionBase& other)
+{
+   int ob;
+   double weight_a, weight_b, weight_new, delta;
+
+// We need to cast from the base class to the derived class because the base class does not have "acc"
+   const DistributionMoments& other_cast = dynamic_cast<const DistributionMoments&>(other);
+
+   weight_a = acc[0];
+   weight_b = other_cast.acc[0];
+   weight_new = weight_a + weight_b;
+
+   if((weight_b != 0.0) && (weight_new != 0.0)) {
+      for(ob = 0; ob < n_obs; ob++) {
+         delta = other_cast.acc[2 + 2 * ob] - acc[2 + 2 * ob];
+         acc[2 + 2 * ob] += delta * weight_b / weight_new;
+         acc[3 + 2 * ob] += other_cast.acc[3 + 2 * ob] + Sqr(delta) * weight_a * weight_b / weight_new;
+      };
+      acc[0] = weight_new;
+      acc[1] += other_cast.acc[1];
+   };
+
+   counts[0] += other_cast.counts[0];
+   n_events += other_cast.n_events;
+   return *this;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+void DistributionMoments::ResetDistribution(void)
+{
+   std::fill(acc.begin(), acc.end(), 0.0);
+   std::fill(counts.begin(), counts.end(), 0);
+   n_events = 0;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[out] size Size of an element of the accumulator
+\return Pointer to the accumulator
+*/
+void* DistributionMoments::GetDistroAddress(size_t& size)
+{
+   size = sizeof(double);
+   return acc.data();
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] file_name Distribution file name
+*/
+void DistributionMoments::Dump(const std::string& file_name) const
+{
+   unsigned int datalen, datasize;
+
+   std::ofstream distfile(file_name.c_str(), std::ofstream::binary);
+
+   datalen = class_name.length();
+   distfile.write((char*)&datalen, sizeof(datalen));
+   distfile.write(class_name.data(), datalen);
+
+   distfile.write((char*)&specie, sizeof(specie));
+
+   datasize = container.size();
+   distfile.write((char*)&datasize, sizeof(datasize));
+   datalen = container.length();
+   distfile.write((char*)&datalen, sizeof(datalen));
+   distfile.write((char*)container.data(), datalen);
+
+// Dump the accumulator
+   distfile.write((char*)&n_events, sizeof(n_events));
+   distfile.write((char*)counts.data(), counts.size() * sizeof(int));
+   distfile.write((char*)acc.data(), acc.size() * sizeof(double));
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] file_name Distribution file name
+*/
+void DistributionMoments::Restore(const std::string& file_name)
+{
+   unsigned int datalen, datasize;
+
+   std::ifstream distfile(file_name.c_str(), std::ifstream::binary);
+   if(!distfile.is_open()) return;
+
+   distfile.read((char*)&datalen, sizeof(datalen));
+   std::string class_name_in;
+   class_name_in.resize(datalen);
+   distfile.read((char*)class_name_in.data(), datalen);
+   if(class_name_in != class_name) return;
+
+   distfile.read((char*)&specie, sizeof(specie));
+
+   distfile.read((char*)&datasize, sizeof(datasize));
+   distfile.read((char*)&datalen, sizeof(datalen));
+   container.resize(datasize, datalen);
+   distfile.read((char*)container.data(), datalen);
+
+// Restore the accumulator
+   SetupDistribution(false);
+   distfile.read((char*)&n_events, sizeof(n_events));
+   distfile.read((char*)counts.data(), counts.size() * sizeof(int));
+   distfile.read((char*)acc.data(), acc.size() * sizeof(double));
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] ijk        Unused
+\param[in] dist_name  Distribution file name
+\param[in] phys_units Use physical units for output
+
+Each line contains the observable, its weighted mean, standard deviation, and the statistical error of the mean. The harmonics are labeled "Y(l,m)".
+*/
+void DistributionMoments::Print1D(int ijk, const std::string& dist_name, bool phys_units) const
+{
+   int ob, l, m;
+   double unit;
+   std::string label;
+
+   std::ofstream distfile(dist_name.c_str());
+   distfile << "# Total number of events: " << n_events << std::endl;
+   distfile << "# Total weight: " << acc[0] << " +- " << sqrt(acc[1]) << std::endl;
+   distfile << "# Effective number of events: " << EffectiveEvents() << std::endl << std::endl;
+
+   distfile << std::setprecision(10);
+   for(ob = 0; ob < n_obs; ob++) {
+      if(ob < quantities.size()) {
+         label = moment_quantity_names[quantities[ob]] + "^" + std::to_string(powers[ob]);
+         unit = (phys_units ? pow(moment_quantity_units[quantities[ob]], powers[ob]) : 1.0);
+      }
+      else {
+         l = (int)sqrt(ob - quantities.size() + 0.5);
+         m = ob - quantities.size() - l * l - l;
+         label = "Y(" + std::to_string(l) + "," + std::to_string(m) + ")";
+         unit = 1.0;
+      };
+
+      distfile << std::setw(12) << label;
+      distfile << std::setw(20) << Mean(ob) * unit;
+      distfile << std::setw(20) << sqrt(Variance(ob)) * unit;
+      distfile << std::setw(20) << MeanError(ob) * unit;
+      distfile << std::endl;
+   };
+};
+
+};
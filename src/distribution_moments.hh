@@ -0,0 +1,255 @@
+/*!
+\file distribution_moments.hh
+\brief Declares a binless distribution that accumulates weighted moments and directional harmonics of events
+\author Swati Sharma
+
+This file is part of the SPECTRUM suite of scientific numerical simulation codes. SPECTRUM stands for Space Plasma and Energetic Charged particle TRansport on Unstructured Meshes. The code simulates plasma or neutral particle flows using MHD equations on a grid, transport of cosmic rays using stochastic or grid based methods. The "unstructured" part refers to the use of a geodesic mesh providing a uniform coverage of the surface of a sphere.
+*/
+
+#ifndef SPECTRUM_DISTRIBUTION_MOMENTS_HH
+#define SPECTRUM_DISTRIBUTION_MOMENTS_HH
+
+#include "distribution_base.hh"
+
+namespace Spectrum {
+
+//! Quantity: time elapsed since the start of the trajectory
+const int MOMENT_TIME = 0;
+
+//! Quantity: x, y, or z component of the position
+const int MOMENT_POS_X = 1;
+const int MOMENT_POS_Y = 2;
+const int MOMENT_POS_Z = 3;
+
+//! Quantity: x, y, or z component of the displacement from the starting position
+const int MOMENT_DISP_X = 4;
+const int MOMENT_DISP_Y = 5;
+const int MOMENT_DISP_Z = 6;
+
+//! Quantity: distance from the origin
+const int MOMENT_RADIUS = 7;
+
+//! Quantity: momentum magnitude
+const int MOMENT_MOMENTUM = 8;
+
+//! Quantity: kinetic energy
+const int MOMENT_ENERGY = 9;
+
+//! Quantity: pitch angle cosine
+const int MOMENT_PITCH = 10;
+
+//! Number of quantities available for the moments
+const int MOMENT_QUANTITIES = 11;
+
+//! Readable names of the quantities
+const std::string moment_quantity_names[MOMENT_QUANTITIES] = {"t", "x", "y", "z", "dx", "dy", "dz", "r", "p", "T", "mu"};
+
+//! Largest degree of the directional harmonics
+const int moments_max_lmax = 8;
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// DistributionMoments class declaration
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+//! Readable name of the DistributionMoments class
+const std::string dist_name_moments = "DistributionMoments";
+
+/*!
+\brief Streaming weighted moments of event quantities and real spherical harmonic coefficients of the momentum direction
+\author Swati Sharma
+
+Instead of a histogram this class keeps, for each observable, the weighted mean and the weighted sum of squared deviations updated with West's online algorithm. Partial accumulators are combined with the parallel formula of Chan et al., so the result does not depend on how the events were split between workers and there is no loss of precision from subtracting large power sums. The total weight and the total squared weight are also kept, giving the effective sample size "W^2 / sum(w^2)" for the error bars.
+
+The observables are the user selected powers of the quantities listed above, followed by the real orthonormal spherical harmonics "Y_lm" of the momentum direction in the field-aligned frame (polar axis along "bhat"), for "l" up to "l_max". The mean of "Y_lm" is the coefficient "a_lm" of the directional distribution; for example, the first order anisotropy along the field is "3 <mu> = sqrt(12 pi) a_10". Guiding center trajectories are gyrotropic, so only the "m = 0" harmonics are accumulated for them; Parker trajectories are isotropic and all harmonics above "l = 0" are zero.
+
+The whole state is one array of doubles of a fixed length that is exchanged through "GetDistroAddress()" like the bins of a regular distribution. Events with a zero weight are counted, but do not affect the moments. Weights should not change sign.
+
+Type: binless
+Parameters: std::vector<int> quantities, std::vector<int> powers, int l_max, int val_time, double val_hot, double val_cold
+*/
+class DistributionMoments : public DistributionBase {
+
+protected:
+
+//! Quantity for each moment (persistent)
+   std::vector<int> quantities;
+
+//! Power of the quantity for each moment (persistent)
+   std::vector<int> powers;
+
+//! Largest degree of the harmonics, or -1 for no harmonics (persistent)
+   int l_max;
+
+//! Which coordinates to use for value: 0 initial, 1 final (persistent)
+   int val_time;
+
+//! Weight for the "hot" condition (persistent)
+   double val_hot;
+
+//! Weight for the "cold" condition (persistent)
+   double val_cold;
+
+//! Number of observables (persistent)
+   int n_obs;
+
+//! Normalization factors of the associated Legendre functions (persistent)
+   std::vector<double> norm_lm;
+
+//! Accumulator: total weight, total squared weight, then the mean and the sum of squared deviations for each observable (transient)
+   std::vector<double> acc;
+
+//! Values of the observables for the current event (transient)
+   std::vector<double> obs;
+
+//! Weight of the current event (transient)
+   double _weight;
+
+//! Set up the distribution accumulator based on "params"
+   void SetupDistribution(bool construct) override;
+
+//! Determine the values of the observables from a phase space position and other arguments
+   void EvaluateValue(void) override;
+
+//! Dispatch routine to call the appropriate weight function
+   void EvaluateWeight(int action_in) override;
+
+//! Add a single processed event
+   void AddEvent(void) override;
+
+//! Weight from a "hot" boundary
+   void MomentsHot(void);
+
+//! Weight from a "cold" boundary
+   void MomentsCold(void);
+
+//! Return the value of a quantity for the current event
+   double Quantity(int quantity) const;
+
+//! Compute the pitch angle cosine and the gyrophase of the current event
+   int Direction(double& mu, double& phi) const;
+
+//! Compute the real spherical harmonics of a direction
+   void Harmonics(double mu, double phi, int symmetry, double* ylm) const;
+
+public:
+
+//! Default constructor
+   DistributionMoments(void);
+
+//! Copy constructor
+   DistributionMoments(const DistributionMoments& other);
+
+//! Destructor
+   ~DistributionMoments() override = default;
+
+//! Clone function
+   CloneFunctionDistribution(DistributionMoments);
+
+//! Return the number of observables
+   int NObservables(void) const;
+
+//! Return the weighted mean of an observable
+   double Mean(int ob) const;
+
+//! Return the weighted variance of an observable
+   double Variance(int ob) const;
+
+//! Return the statistical error of the mean of an observable
+   double MeanError(int ob) const;
+
+//! Return the total weight
+   double TotalWeight(void) const;
+
+//! Return the effective number of events
+   double EffectiveEvents(void) const;
+
+//! Add another distribution to this
+   DistributionBase& operator +=(const DistributionBase& other) override;
+
+//! Clear the accumulator
+   void ResetDistribution(void) override;
+
+//! Return the address of the accumulator
+   void* GetDistroAddress(size_t& size) override;
+
+//! Dump the accumulator to a file
+   void Dump(const std::string& file_name) const override;
+
+//! Restore the accumulator from a dump file
+   void Restore(const std::string& file_name) override;
+
+//! Print the moments (the dimension argument is ignored)
+   void Print1D(int ijk, const std::string& file_name, bool phys_units) const override;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// DistributionMoments inline methods
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return Number of observables
+*/
+inline int DistributionMoments::NObservables(void) const
+{
+   return n_obs;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] ob Observable index
+\return Weighted mean
+*/
+inline double DistributionMoments::Mean(int ob) const
+{
+   return acc[2 + 2 * ob];
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] ob Observable index
+\return Weighted variance
+*/
+inline double DistributionMoments::Variance(int ob) const
+{
+   return (acc[0] != 0.0 ? acc[3 + 2 * ob] / acc[0] : 0.0);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return Total weight
+*/
+inline double DistributionMoments::TotalWeight(void) const
+{
+   return acc[0];
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return Effective number of events "W^2 / sum(w^2)"
+*/
+inline double DistributionMoments::EffectiveEvents(void) const
+{
+   return (acc[1] > 0.0 ? Sqr(acc[0]) / acc[1] : 0.0);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] ob Observable index
+\return Statistical error of the weighted mean
+*/
+inline double DistributionMoments::MeanError(int ob) const
+{
+   double n_eff = EffectiveEvents();
+   return (n_eff > 1.0 ? sqrt(Variance(ob) / (n_eff - 1.0)) : 0.0);
+};
+
+};
+
+#endif
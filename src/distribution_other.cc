@@ -9,6 +9,8 @@ This file is part of the SPECTRUM suite of scientific numerical simulation codes
 
 #include "distribution_other.hh"
 #include "common/physics.hh"
+#include <fstream>
+#include <iomanip>
 
 namespace Spectrum {
 
@@ -351,11 +353,11 @@ void DistributionMomentumUniform::EvaluateValue(void)
    this->_value[0] = momentum[2];
    this->_value[1] = 0.0;
    this->_value[2] = 0.0;
-#elif (TRAJ_TYPE == TRAJ_GUIDING) || (TRAJ_TYPE == TRAJ_GUIDING_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF_SCATT)
+#elif (TRAJ_TYPE == TRAJ_GUIDING) || (TRAJ_TYPE == TRAJ_GUIDING_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_BOUNCE)
    this->_value[0] = momentum.Norm();
    this->_value[1] = momentum[2] / this->_value[0];
    this->_value[2] = 0.0;
-#elif TRAJ_TYPE == TRAJ_LORENTZ
+#elif (TRAJ_TYPE == TRAJ_LORENTZ) || (TRAJ_TYPE == TRAJ_HYBRID)
    this->_value[0] = momentum.Norm();
    this->_value[1] = momentum * bhat / this->_value[0];
    this->_value[2] = 0.0;
@@ -446,11 +448,11 @@ void DistributionPositionMomentumUniform::EvaluateValue(void)
       this->_value[0] = momentum[2];
       this->_value[1] = 0.0;
       this->_value[2] = 0.0;
-#elif (TRAJ_TYPE == TRAJ_GUIDING) || (TRAJ_TYPE == TRAJ_GUIDING_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF_SCATT)
+#elif (TRAJ_TYPE == TRAJ_GUIDING) || (TRAJ_TYPE == TRAJ_GUIDING_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_BOUNCE)
       this->_value[0] = momentum.Norm();
       this->_value[1] = momentum[2] / this->_value[0];
       this->_value[2] = 0.0;
-#elif TRAJ_TYPE == TRAJ_LORENTZ
+#elif (TRAJ_TYPE == TRAJ_LORENTZ) || (TRAJ_TYPE == TRAJ_HYBRID)
       this->_value[0] = momentum.Norm();
       this->_value[1] = momentum * bhat / this->_value[0];
       this->_value[2] = 0.0;
@@ -467,7 +469,7 @@ void DistributionPositionMomentumUniform::EvaluateValue(void)
      }
 };
 
-#if TRAJ_TYPE == TRAJ_LORENTZ
+#if (TRAJ_TYPE == TRAJ_LORENTZ) || (TRAJ_TYPE == TRAJ_HYBRID)
 
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 // DistributionAnisotropyLISM methods
@@ -672,7 +674,7 @@ void DistributionSpectrumKineticEnergyPowerLaw::EvaluateValue(void)
    this->_value[0] = EnrKin(this->_mom[0], this->specie);
 #elif TRAJ_TYPE == TRAJ_FIELDLINE
    this->_value[0] = EnrKin(this->_mom[2], this->specie);
-#elif (TRAJ_TYPE == TRAJ_LORENTZ) || (TRAJ_TYPE == TRAJ_GUIDING) || (TRAJ_TYPE == TRAJ_GUIDING_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF_SCATT)
+#elif (TRAJ_TYPE == TRAJ_LORENTZ) || (TRAJ_TYPE == TRAJ_HYBRID) || (TRAJ_TYPE == TRAJ_GUIDING) || (TRAJ_TYPE == TRAJ_GUIDING_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_BOUNCE)
    this->_value[0] = EnrKin(this->_mom.Norm(), this->specie);
 #endif
 };
@@ -689,7 +691,7 @@ void DistributionSpectrumKineticEnergyPowerLaw::SpectrumKineticEnergyPowerLawHot
    mom2mag = this->_mom2[0];
 #elif TRAJ_TYPE == TRAJ_FIELDLINE
    mom2mag = this->_mom2[2];
-#elif (TRAJ_TYPE == TRAJ_LORENTZ) || (TRAJ_TYPE == TRAJ_GUIDING) || (TRAJ_TYPE == TRAJ_GUIDING_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF_SCATT)
+#elif (TRAJ_TYPE == TRAJ_LORENTZ) || (TRAJ_TYPE == TRAJ_HYBRID) || (TRAJ_TYPE == TRAJ_GUIDING) || (TRAJ_TYPE == TRAJ_GUIDING_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_BOUNCE)
    mom2mag = this->_mom2.Norm();
 #endif
    kin_energy = EnrKin(mom2mag, this->specie);
@@ -778,6 +780,192 @@ void DistributionSpectrumKineticEnergyBentPowerLaw::SpectrumKineticEnergyPowerLa
    this->_weight /= pow(1.0 + pow(kin_energy / T_b, pow_law_comb), bend_smoothness);
 };
 
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// DistributionSpectrumKineticEnergyPowerLawMulti
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+
+DistributionSpectrumKineticEnergyPowerLawMulti::DistributionSpectrumKineticEnergyPowerLawMulti(void)
+                                              : DistributionTemplated<double>(dist_name_spectrum_kinetic_energy_power_law_multi, 0, DISTRO_MOMENTUM)
+{
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] other Object to initialize from
+
+A copy constructor should first first call the Params' version to copy the data container and then check whether the other object has been set up. If yes, it should simply call the virtual method "SetupDistribution()" with the argument of "true".
+*/
+DistributionSpectrumKineticEnergyPowerLawMulti::DistributionSpectrumKineticEnergyPowerLawMulti(const DistributionSpectrumKineticEnergyPowerLawMulti& other)
+                                              : DistributionTemplated<double>(other)
+{
+   RAISE_BITS(this->_status, DISTRO_MOMENTUM);
+   if(BITS_RAISED(other._status, STATE_SETUP_COMPLETE)) SetupDistribution(true);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] construct Whether called from a copy constructor or separately
+*/
+void DistributionSpectrumKineticEnergyPowerLawMulti::SetupDistribution(bool construct)
+{
+   int set;
+   std::vector<double> T0;
+
+// The parent version must be called explicitly if not constructing
+   if(!construct) DistributionTemplated<double>::SetupDistribution(false);
+   if(BITS_LOWERED(this->_status, STATE_SETUP_COMPLETE)) return;
+
+   this->container.Read(&J0);
+   this->container.Read(&T0);
+   this->container.Read(&pow_law);
+   this->container.Read(&val_cold);
+
+// All parameter vectors must have the same, non-zero length
+   n_sets = J0.size();
+   if(!n_sets || (T0.size() != n_sets) || (pow_law.size() != n_sets)) {
+      LOWER_BITS(this->_status, STATE_SETUP_COMPLETE);
+      return;
+   };
+   log_T0.resize(n_sets);
+   for(set = 0; set < n_sets; set++) log_T0[set] = log(T0[set]);
+
+// Each bin holds one weight per parameter set
+   this->distro.resize(this->n_bins.Prod() * n_sets);
+   _weights.resize(n_sets);
+
+// Place the actions into the table
+   this->ActionTable.push_back([this]() {SpectrumKineticEnergyPowerLawMultiHot();});
+   this->ActionTable.push_back([this]() {SpectrumKineticEnergyPowerLawMultiCold();});
+
+// Check that ONLY the first dimension is active.
+   if(this->dims != 1) LOWER_BITS(this->_status, STATE_SETUP_COMPLETE);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+void DistributionSpectrumKineticEnergyPowerLawMulti::EvaluateValue(void)
+{
+#if (TRAJ_TYPE == TRAJ_FOCUSED) || (TRAJ_TYPE == TRAJ_PARKER)
+   this->_value[0] = EnrKin(this->_mom[0], this->specie);
+#elif TRAJ_TYPE == TRAJ_FIELDLINE
+   this->_value[0] = EnrKin(this->_mom[2], this->specie);
+#elif (TRAJ_TYPE == TRAJ_LORENTZ) || (TRAJ_TYPE == TRAJ_HYBRID) || (TRAJ_TYPE == TRAJ_GUIDING) || (TRAJ_TYPE == TRAJ_GUIDING_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_BOUNCE)
+   this->_value[0] = EnrKin(this->_mom.Norm(), this->specie);
+#endif
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+void DistributionSpectrumKineticEnergyPowerLawMulti::AddEvent(void)
+{
+   int set, lin_bin;
+
+// The bin is found once for all parameter sets
+   lin_bin = this->BinIdx();
+   if(lin_bin < 0) return;
+
+   for(set = 0; set < n_sets; set++) this->distro[lin_bin * n_sets + set] += _weights[set];
+   this->counts[lin_bin]++;
+   this->n_events++;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+
+The common factor and "log(T)" are computed once, then "(T/T0)^pow_law = exp(pow_law (log(T) - log(T0)))" for each set.
+*/
+void DistributionSpectrumKineticEnergyPowerLawMulti::SpectrumKineticEnergyPowerLawMultiHot(void)
+{
+   int set;
+   double mom2mag, log_kin_energy, factor;
+#if (TRAJ_TYPE == TRAJ_FOCUSED) || (TRAJ_TYPE == TRAJ_PARKER)
+   mom2mag = this->_mom2[0];
+#elif TRAJ_TYPE == TRAJ_FIELDLINE
+   mom2mag = this->_mom2[2];
+#elif (TRAJ_TYPE == TRAJ_LORENTZ) || (TRAJ_TYPE == TRAJ_HYBRID) || (TRAJ_TYPE == TRAJ_GUIDING) || (TRAJ_TYPE == TRAJ_GUIDING_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_BOUNCE)
+   mom2mag = this->_mom2.Norm();
+#endif
+   log_kin_energy = log(EnrKin(mom2mag, this->specie));
+
+#if DISTRO_KINETIC_ENERGY_POWER_LAW_TYPE == 0
+// Differential density, see "DistributionSpectrumKineticEnergyPowerLaw"
+   factor = Vel(mom2mag, this->specie) / Sqr(mom2mag);
+#elif DISTRO_KINETIC_ENERGY_POWER_LAW_TYPE == 1
+// Differential intensity
+   factor = 1.0 / Sqr(mom2mag);
+#else
+// Distribution function
+   factor = 1.0;
+#endif
+
+   for(set = 0; set < n_sets; set++) _weights[set] = J0[set] * factor * exp(pow_law[set] * (log_kin_energy - log_T0[set]));
+   this->_weight = _weights[0];
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+void DistributionSpectrumKineticEnergyPowerLawMulti::SpectrumKineticEnergyPowerLawMultiCold(void)
+{
+   std::fill(_weights.begin(), _weights.end(), val_cold);
+   this->_weight = val_cold;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[out] size Size of the block of weights in one bin
+\return Pointer to the distribution storage
+*/
+void* DistributionSpectrumKineticEnergyPowerLawMulti::GetDistroAddress(size_t& size)
+{
+   size = n_sets * sizeof(double);
+   return this->distro.data();
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] ijk        Which component to print (only 0 is active)
+\param[in] dist_name  Distribution file name
+\param[in] phys_units Use physical units for output
+
+Each line contains the bin center, the average and the total weight for each parameter set, and the number of events.
+*/
+void DistributionSpectrumKineticEnergyPowerLawMulti::Print1D(int ijk, const std::string& dist_name, bool phys_units) const
+{
+   int bin, set;
+   double unit = (phys_units ? this->unit_distro : 1.0);
+
+   if(ijk != 0) return;
+
+   std::ofstream distfile(dist_name.c_str());
+   distfile << "# Total number of events: " << this->n_events << std::endl << std::endl;
+
+   distfile << std::setprecision(10);
+   for(bin = 0; bin < this->n_bins[0]; bin++) {
+      distfile << std::setw(20) << this->BinCent(0, bin) * (phys_units ? this->unit_val[0] : 1.0);
+      for(set = 0; set < n_sets; set++) {
+         distfile << std::setw(20) << (this->counts[bin] ? this->distro[bin * n_sets + set] / this->counts[bin] : 0.0) * unit
+                  << std::setw(20) << this->distro[bin * n_sets + set] * unit;
+      };
+      distfile << std::setw(20) << this->counts[bin] << std::endl;
+   };
+};
+
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 // DistroPositionCumulativeO1
 //----------------------------------------------------------------------------------------------------------------------------------------------------
@@ -14,9 +14,6 @@ This file is part of the SPECTRUM suite of scientific numerical simulation codes
 
 namespace Spectrum {
 
-//! Clone function pattern
-#define CloneFunctionDistribution(T) std::shared_ptr<DistributionBase> Clone(void) const override {return std::make_shared<T>();};
-
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 // DistributionUniform class declaration
 //----------------------------------------------------------------------------------------------------------------------------------------------------
@@ -301,7 +298,7 @@ public:
    CloneFunctionDistribution(DistributionPositionMomentumUniform);
 };
 
-#if TRAJ_TYPE == TRAJ_LORENTZ
+#if (TRAJ_TYPE == TRAJ_LORENTZ) || (TRAJ_TYPE == TRAJ_HYBRID)
 
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 // DistributionAnisotropyLISM class declaration
@@ -488,6 +485,93 @@ public:
    CloneFunctionDistribution(DistributionSpectrumKineticEnergyBentPowerLaw);
 };
 
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// DistributionSpectrumKineticEnergyPowerLawMulti class declaration
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+//! Readable name of the DistributionSpectrumKineticEnergyPowerLawMulti class
+const std::string dist_name_spectrum_kinetic_energy_power_law_multi = "DistributionSpectrumKineticEnergyPowerLawMulti";
+
+/*!
+\brief Several power law spectra J(T) accumulated from the same events
+\author Swati Sharma
+
+Each parameter set (J0, T0, pow_law) has its own slot in every bin, so "distro" holds "n_sets" consecutive doubles per bin and a parameter study costs the same number of trajectories as a single spectrum. The bin index, kinetic energy, and its logarithm are computed once per event and each set only adds one "exp". The spectrum type is selected with "DISTRO_KINETIC_ENERGY_POWER_LAW_TYPE" as in the single spectrum class. Records, if kept, only contain the weight of the first set.
+
+Type: 1D momentum
+Parameters: (DistributionTemplated), std::vector<double> J0, std::vector<double> T0, std::vector<double> pow_law, double val_cold
+*/
+class DistributionSpectrumKineticEnergyPowerLawMulti : public DistributionTemplated<double> {
+
+protected:
+
+//! Number of parameter sets (persistent)
+   int n_sets;
+
+//! Normalizations for the "hot" boundary (persistent)
+   std::vector<double> J0;
+
+//! Logarithms of the characteristic energies (persistent)
+   std::vector<double> log_T0;
+
+//! Spectral power laws (persistent)
+   std::vector<double> pow_law;
+
+//! Constant value for the "cold" condition (persistent)
+   double val_cold;
+
+//! Weights for all parameter sets (transient)
+   std::vector<double> _weights;
+
+//! Set up the distribution accumulator based on "params"
+   void SetupDistribution(bool construct) override;
+
+//! Determine the value to be binned from a phase space position and other arguments
+   void EvaluateValue(void) override;
+
+//! Add a single processed event
+   void AddEvent(void) override;
+
+//! Weight from a "hot" boundary
+   void SpectrumKineticEnergyPowerLawMultiHot(void);
+
+//! Weight from a "cold" boundary
+   void SpectrumKineticEnergyPowerLawMultiCold(void);
+
+public:
+
+//! Default constructor
+   DistributionSpectrumKineticEnergyPowerLawMulti(void);
+
+//! Copy constructor
+   DistributionSpectrumKineticEnergyPowerLawMulti(const DistributionSpectrumKineticEnergyPowerLawMulti& other);
+
+//! Destructor
+   ~DistributionSpectrumKineticEnergyPowerLawMulti() override = default;
+
+//! Clone function
+   CloneFunctionDistribution(DistributionSpectrumKineticEnergyPowerLawMulti);
+
+//! Return the number of parameter sets
+   int NSets(void) const;
+
+//! Return the address of "distro"
+   void* GetDistroAddress(size_t& size) override;
+
+//! Print the spectra for all parameter sets
+   void Print1D(int ijk, const std::string& file_name, bool phys_units) const override;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return Number of parameter sets
+*/
+inline int DistributionSpectrumKineticEnergyPowerLawMulti::NSets(void) const
+{
+   return n_sets;
+};
+
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 // DistributionPositionCumulativeOrder1 class declaration
 //----------------------------------------------------------------------------------------------------------------------------------------------------
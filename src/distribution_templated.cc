@@ -11,9 +11,16 @@ This file is part of the SPECTRUM suite of scientific numerical simulation codes
 #include "common/print_warn.hh"
 #include <algorithm>
 #include <fstream>
+#include <charconv>
 
 namespace Spectrum {
 
+//! Width of a field in text output
+const int distro_field_width = 20;
+
+//! Number of significant digits in text output
+const int distro_field_precision = 10;
+
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 // DistributionBase methods
 //----------------------------------------------------------------------------------------------------------------------------------------------------
@@ -137,17 +144,17 @@ void DistributionTemplated<distroClass>::SetupDistribution(bool construct)
 };
 
 /*!
-\author Vladimir Florinski
-\author Juan G Alonso Guzman
-\date 08/27/2024
+\author Swati Sharma
+\date 10/17/2026
+\return Linear index of the bin, or -1 if the event falls outside and "bin_outside" is not set
 */
 template <class distroClass>
-void DistributionTemplated<distroClass>::AddEvent(void)
+int DistributionTemplated<distroClass>::BinIdx(void) const
 {
-   int ijk, lin_bin;
+   int ijk;
    MultiIndex bin = mi_zeros;
 
-// The event has been already processed and "_values" and "_weight" computed
+// The event has been already processed and "_values" computed
    for(ijk = 0; ijk < 3; ijk++) {
 
 // Skip if dimension is ignorable
@@ -157,16 +164,32 @@ void DistributionTemplated<distroClass>::AddEvent(void)
 // Check for outlying events
       if(bin[ijk] < 0) {
          if(bin_outside[ijk]) bin[ijk] = 0;
-         else return;
+         else return -1;
       }
       else if(bin[ijk] >= n_bins[ijk]) {
          if(bin_outside[ijk]) bin[ijk] = n_bins[ijk] - 1;
-         else return;
+         else return -1;
       };
    };
 
+   return n_bins.LinIdx(bin);
+};
+
+/*!
+\author Vladimir Florinski
+\author Juan G Alonso Guzman
+\date 08/27/2024
+*/
+template <class distroClass>
+void DistributionTemplated<distroClass>::AddEvent(void)
+{
+   int lin_bin;
+
+// The event has been already processed and "_values" and "_weight" computed
+   lin_bin = BinIdx();
+   if(lin_bin < 0) return;
+
 // Update the counts
-   lin_bin = n_bins.LinIdx(bin);
    distro[lin_bin] += _weight;
    counts[lin_bin]++;
    n_events++;
@@ -457,72 +480,221 @@ void DistributionTemplated<distroClass>::Restore(const std::string& file_name)
    distfile.read((char*)weights_record.data(), weights_record.size() * sizeof(distroClass));
 };
 
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] file_name  Export file name
+\param[in] phys_units Use physical units for output
+
+The file layout is described in "DistroExport". The weights are written as sums over events, so that exports from independent runs can be added. No variance is written because the squared weights are not accumulated. Multi-weight distributions keep several elements of "distro" per bin; these are exported as additional components.
+*/
+template <class distroClass>
+void DistributionTemplated<distroClass>::Export(const std::string& file_name, bool phys_units) const
+{
+   int ijk, bin, comp;
+   size_t idx;
+   DistroExportHeader header;
+   std::vector<double> edges;
+   const int n_comp_unit = sizeof(distroClass) / sizeof(double);
+   const int n_comp = n_comp_unit * (distro.size() / counts.size());
+   const double* unit_ptr = (const double*)&unit_distro;
+
+   std::memset(&header, 0, sizeof(header));
+   std::memcpy(header.magic, distro_export_magic, sizeof(header.magic));
+   header.n_comp = n_comp;
+   header.dims = dims;
+   header.phys_units = phys_units;
+   header.has_variance = 0;
+   header.n_events = n_events;
+   for(ijk = 0; ijk < 3; ijk++) {
+      header.n_bins[ijk] = n_bins[ijk];
+      header.log_bins[ijk] = log_bins[ijk];
+      header.unit_val[ijk] = unit_val[ijk];
+   };
+   for(comp = 0; comp < std::min(n_comp, 9); comp++) header.unit_distro[comp] = unit_ptr[comp % n_comp_unit];
+   class_name.copy(header.class_name, sizeof(header.class_name) - 1);
+
+// Bin edges
+   for(ijk = 0; ijk < 3; ijk++) {
+      for(bin = 0; bin < n_bins[ijk]; bin++) edges.push_back(BinLeft(ijk, bin) * (phys_units ? unit_val[ijk] : 1.0));
+      edges.push_back(BinRght(ijk, n_bins[ijk] - 1) * (phys_units ? unit_val[ijk] : 1.0));
+   };
+
+// Counts are stored as 64 bit integers and weights as plain doubles
+   std::vector<int64_t> counts_out(counts.begin(), counts.end());
+   std::vector<double> weights((const double*)distro.data(), (const double*)distro.data() + distro.size() * n_comp_unit);
+   if(phys_units) {
+      for(idx = 0; idx < counts.size(); idx++) {
+         for(comp = 0; comp < n_comp; comp++) weights[idx * n_comp + comp] *= unit_ptr[comp % n_comp_unit];
+      };
+   };
+
+   std::ofstream distfile(file_name.c_str(), std::ofstream::binary);
+   distfile.write((char*)&header, sizeof(header));
+   distfile.write((char*)edges.data(), edges.size() * sizeof(double));
+   distfile.write((char*)counts_out.data(), counts_out.size() * sizeof(int64_t));
+   distfile.write((char*)weights.data(), weights.size() * sizeof(double));
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in]  dims_2d   Dimensions whose 2D marginals are needed as a bitset (the bit is that of the collapsed dimension)
+\param[out] counts_1d Counts summed over the other two dimensions, one vector per dimension
+\param[out] distro_1d Weights summed over the other two dimensions, one vector per dimension
+\param[out] counts_2d Counts summed over one dimension, indexed by the collapsed dimension
+\param[out] distro_2d Weights summed over one dimension, indexed by the collapsed dimension
+
+The storage is traversed in the order of "MultiIndex::LinIdx()", so the linear index is simply incremented and each marginal bin is found from the loop counters. A 2D marginal is stored with the last of its two dimensions varying fastest. For multi-weight distributions only the first weight of each bin is summed.
+*/
+template <class distroClass>
+void DistributionTemplated<distroClass>::Marginals(uint8_t dims_2d, std::vector<long>* counts_1d, std::vector<distroClass>* distro_1d,
+                                                   std::vector<long>* counts_2d, std::vector<distroClass>* distro_2d) const
+{
+   int ijk, i, j, k, jk, ik, ij;
+   long lin_bin, count;
+   const int stride = distro.size() / counts.size();
+   distroClass zero;
+
+   zero = 0.0;
+   for(ijk = 0; ijk < 3; ijk++) {
+      counts_1d[ijk].assign(n_bins[ijk], 0);
+      distro_1d[ijk].assign(n_bins[ijk], zero);
+      if(BITS_RAISED(dims_2d, 1 << ijk)) {
+         counts_2d[ijk].assign(n_bins[(ijk + 1) % 3] * n_bins[(ijk + 2) % 3], 0);
+         distro_2d[ijk].assign(n_bins[(ijk + 1) % 3] * n_bins[(ijk + 2) % 3], zero);
+      };
+   };
+
+   lin_bin = 0;
+   for(i = 0; i < n_bins[0]; i++) {
+      for(j = 0; j < n_bins[1]; j++) {
+         ij = i * n_bins[1] + j;
+         for(k = 0; k < n_bins[2]; k++) {
+            jk = j * n_bins[2] + k;
+            ik = i * n_bins[2] + k;
+            count = counts[lin_bin];
+            const distroClass& weight = distro[lin_bin * stride];
+
+            counts_1d[0][i] += count;
+            counts_1d[1][j] += count;
+            counts_1d[2][k] += count;
+            distro_1d[0][i] += weight;
+            distro_1d[1][j] += weight;
+            distro_1d[2][k] += weight;
+
+            if(BITS_RAISED(dims_2d, 1)) {
+               counts_2d[0][jk] += count;
+               distro_2d[0][jk] += weight;
+            };
+            if(BITS_RAISED(dims_2d, 2)) {
+               counts_2d[1][ik] += count;
+               distro_2d[1][ik] += weight;
+            };
+            if(BITS_RAISED(dims_2d, 4)) {
+               counts_2d[2][ij] += count;
+               distro_2d[2][ij] += weight;
+            };
+            lin_bin++;
+         };
+      };
+   };
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[out] buffer Text buffer
+\param[in]  value  Number to append
+
+Produces the same text as a stream with "std::setw(distro_field_width)" and "std::setprecision(distro_field_precision)", but without the overhead of formatted stream output.
+*/
+static void AppendField(std::string& buffer, double value)
+{
+   char field[32];
+   int len = std::to_chars(field, field + sizeof(field), value, std::chars_format::general, distro_field_precision).ptr - field;
+   if(len < distro_field_width) buffer.append(distro_field_width - len, ' ');
+   buffer.append(field, len);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[out] buffer Text buffer
+\param[in]  value  Number to append
+*/
+static void AppendField(std::string& buffer, long value)
+{
+   char field[32];
+   int len = std::to_chars(field, field + sizeof(field), value).ptr - field;
+   if(len < distro_field_width) buffer.append(distro_field_width - len, ' ');
+   buffer.append(field, len);
+};
+
 /*!
 \author Vladimir Florinski
 \author Juan G Alonso Guzman
 \date 09/15/2022
-\param[in] distfile   Opened file to which to write the distribution
-\param[in] sum_counts Total counts after collapsing dimensions
-\param[in] sum_distro Total distro after collapsing dimensions
-\param[in] phys_units Use physical units for output
+\param[out] buffer     Text buffer to which to write the distribution
+\param[in]  sum_counts Total counts after collapsing dimensions
+\param[in]  sum_distro Total distro after collapsing dimensions
+\param[in]  phys_units Use physical units for output
 */
 template <class distroClass>
-void DistributionTemplated<distroClass>::PrintSumDistro(std::ofstream& distfile, long sum_counts, distroClass sum_distro, bool phys_units) const
+void DistributionTemplated<distroClass>::PrintSumDistro(std::string& buffer, long sum_counts, distroClass sum_distro, bool phys_units) const
 {
 // This template method should only work for <double> because of 0.0
-   distfile << std::setw(20) << (sum_counts ? sum_distro / sum_counts : 0.0) * (phys_units ? unit_distro : 1.0)
-            << std::setw(20) << sum_distro * (phys_units ? unit_distro : 1.0);
+   AppendField(buffer, (sum_counts ? sum_distro / sum_counts : 0.0) * (phys_units ? unit_distro : 1.0));
+   AppendField(buffer, sum_distro * (phys_units ? unit_distro : 1.0));
 };
 
 // Method specialization for GeoVector
 template <>
-void DistributionTemplated<GeoVector>::PrintSumDistro(std::ofstream& distfile, long sum_counts, GeoVector sum_distro, bool phys_units) const
+void DistributionTemplated<GeoVector>::PrintSumDistro(std::string& buffer, long sum_counts, GeoVector sum_distro, bool phys_units) const
 {
    int i;
 
    if(sum_counts) {
       if(phys_units) {
-         for(i = 0; i < 3; i++) distfile << std::setw(20) << sum_distro[i] / sum_counts * unit_distro[i];
-         for(i = 0; i < 3; i++) distfile << std::setw(20) << sum_distro[i] * unit_distro[i];
+         for(i = 0; i < 3; i++) AppendField(buffer, sum_distro[i] / sum_counts * unit_distro[i]);
+         for(i = 0; i < 3; i++) AppendField(buffer, sum_distro[i] * unit_distro[i]);
       }
       else {
-         for(i = 0; i < 3; i++) distfile << std::setw(20) << sum_distro[i] / sum_counts;
-         for(i = 0; i < 3; i++) distfile << std::setw(20) << sum_distro[i];
+         for(i = 0; i < 3; i++) AppendField(buffer, sum_distro[i] / sum_counts);
+         for(i = 0; i < 3; i++) AppendField(buffer, sum_distro[i]);
       };
    }
    else {
-      for(i = 0; i < 3; i++) distfile << std::setw(20) << 0.0;
-      for(i = 0; i < 3; i++) distfile << std::setw(20) << 0.0;
+      for(i = 0; i < 6; i++) AppendField(buffer, 0.0);
    };
 };
 
 // Method specialization for GeoMatrix
 template <>
-void DistributionTemplated<GeoMatrix>::PrintSumDistro(std::ofstream& distfile, long sum_counts, GeoMatrix sum_distro, bool phys_units) const
+void DistributionTemplated<GeoMatrix>::PrintSumDistro(std::string& buffer, long sum_counts, GeoMatrix sum_distro, bool phys_units) const
 {
    int i, j;
 
    if(sum_counts) {
       if(phys_units) {
          for(i = 0; i < 3; i++) {
-            for(j = 0; j < 3; j++) distfile << std::setw(20) << sum_distro[i][j] / sum_counts * unit_distro[i][j];
+            for(j = 0; j < 3; j++) AppendField(buffer, sum_distro[i][j] / sum_counts * unit_distro[i][j]);
          };
          for(i = 0; i < 3; i++) {
-            for(j = 0; j < 3; j++) distfile << std::setw(20) << sum_distro[i][j] * unit_distro[i][j];
+            for(j = 0; j < 3; j++) AppendField(buffer, sum_distro[i][j] * unit_distro[i][j]);
          };
       }
       else {
          for(i = 0; i < 3; i++) {
-            for(j = 0; j < 3; j++) distfile << std::setw(20) << sum_distro[i][j] / sum_counts;
+            for(j = 0; j < 3; j++) AppendField(buffer, sum_distro[i][j] / sum_counts);
          };
          for(i = 0; i < 3; i++) {
-            for(j = 0; j < 3; j++) distfile << std::setw(20) << sum_distro[i][j];
+            for(j = 0; j < 3; j++) AppendField(buffer, sum_distro[i][j]);
          };
       };
    }
    else {
-      for(i = 0; i < 9; i++) distfile << std::setw(20) << 0.0;
-      for(i = 0; i < 9; i++) distfile << std::setw(20) << 0.0;
+      for(i = 0; i < 18; i++) AppendField(buffer, 0.0);
    };
 };
 
@@ -537,37 +709,26 @@ void DistributionTemplated<GeoMatrix>::PrintSumDistro(std::ofstream& distfile, l
 template <class distroClass>
 void DistributionTemplated<distroClass>::Print1D(int ijk, const std::string& dist_name, bool phys_units) const
 {
-   int ijk1, ijk2;
-   long lin_bin, sum_counts;
-   distroClass sum_distro;
-   MultiIndex bin;
+   int bin;
+   std::vector<long> counts_1d[3], counts_2d[3];
+   std::vector<distroClass> distro_1d[3], distro_2d[3];
+   std::string buffer;
 
    if((ijk < 0) || (ijk >= 3)) return;
 
-   ijk1 = (ijk + 1) % 3;
-   ijk2 = (ijk + 2) % 3;
-
-   std::ofstream distfile(dist_name.c_str());
-   distfile << "# Total number of events: " << n_events << std::endl << std::endl;
-   
-   distfile << std::setprecision(10);
-   for(bin[ijk] = 0; bin[ijk] < n_bins[ijk]; bin[ijk]++) {
-      sum_counts = 0;
-      sum_distro = 0.0;
-
 // Collapse the remaining two dimensions
-      for(bin[ijk1] = 0; bin[ijk1] < n_bins[ijk1]; bin[ijk1]++) {
-         for(bin[ijk2] = 0; bin[ijk2] < n_bins[ijk2]; bin[ijk2]++) {
-            lin_bin = n_bins.LinIdx(bin);
-            sum_counts += counts[lin_bin];
-            sum_distro += distro[lin_bin];
-         };
-      };
-
-      distfile << std::setw(20) << BinCent(ijk, bin[ijk]) * (phys_units ? unit_val[ijk] : 1.0);
-      PrintSumDistro(distfile, sum_counts, sum_distro, phys_units);
-      distfile << std::setw(20) << sum_counts << std::endl;
+   Marginals(0, counts_1d, distro_1d, counts_2d, distro_2d);
+
+   buffer = "# Total number of events: " + std::to_string(n_events) + "\n\n";
+   for(bin = 0; bin < n_bins[ijk]; bin++) {
+      AppendField(buffer, BinCent(ijk, bin) * (phys_units ? unit_val[ijk] : 1.0));
+      PrintSumDistro(buffer, counts_1d[ijk][bin], distro_1d[ijk][bin], phys_units);
+      AppendField(buffer, counts_1d[ijk][bin]);
+      buffer += '\n';
    };
+
+   std::ofstream distfile(dist_name.c_str());
+   distfile << buffer;
 };
 
 /*!
@@ -582,10 +743,10 @@ void DistributionTemplated<distroClass>::Print1D(int ijk, const std::string& dis
 template <class distroClass>
 void DistributionTemplated<distroClass>::Print2D(int ijk1, int ijk2, const std::string& dist_name, bool phys_units) const
 {
-   int ijk;
-   long lin_bin, sum_counts;
-   distroClass sum_distro;
-   MultiIndex bin;
+   int ijk, bin1, bin2, idx;
+   std::vector<long> counts_1d[3], counts_2d[3];
+   std::vector<distroClass> distro_1d[3], distro_2d[3];
+   std::string buffer;
 
    if((ijk1 < 0) || (ijk1 >= 3) || (ijk2 < 0) || (ijk2 >= 3)) return;
 
@@ -599,27 +760,60 @@ void DistributionTemplated<distroClass>::Print2D(int ijk1, int ijk2, const std::
    else if((ijk1 != 2) && (ijk2 != 2)) ijk = 2;
    else return;
 
+// Collapse the remaining dimension
+   Marginals(1 << ijk, counts_1d, distro_1d, counts_2d, distro_2d);
+
+   buffer = "# Total number of events: " + std::to_string(n_events) + "\n\n";
+   for(bin1 = 0; bin1 < n_bins[ijk1]; bin1++) {
+      for(bin2 = 0; bin2 < n_bins[ijk2]; bin2++) {
+
+// The 2D marginal is stored with the higher dimension varying fastest
+         idx = (ijk1 < ijk2 ? bin1 * n_bins[ijk2] + bin2 : bin2 * n_bins[ijk1] + bin1);
+         AppendField(buffer, BinCent(ijk1, bin1) * (phys_units ? unit_val[ijk1] : 1.0));
+         AppendField(buffer, BinCent(ijk2, bin2) * (phys_units ? unit_val[ijk2] : 1.0));
+         PrintSumDistro(buffer, counts_2d[ijk][idx], distro_2d[ijk][idx], phys_units);
+         AppendField(buffer, counts_2d[ijk][idx]);
+         buffer += '\n';
+      };
+   };
+
    std::ofstream distfile(dist_name.c_str());
-   distfile << "# Total number of events: " << n_events << std::endl << std::endl;
-   
-   distfile << std::setprecision(10);
-   for(bin[ijk1] = 0; bin[ijk1] < n_bins[ijk1]; bin[ijk1]++) {
-      for(bin[ijk2] = 0; bin[ijk2] < n_bins[ijk2]; bin[ijk2]++) {
-         sum_counts = 0;
-         sum_distro = 0.0;
+   distfile << buffer;
+};
 
-// Collapse the remaining dimension
-         for(bin[ijk] = 0; bin[ijk] < n_bins[ijk]; bin[ijk]++) {
-            lin_bin = n_bins.LinIdx(bin);
-            sum_counts += counts[lin_bin];
-            sum_distro += distro[lin_bin];
-         };
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] file_name Marginals file name
 
-         distfile << std::setw(20) << BinCent(ijk1, bin[ijk1]) * (phys_units ? unit_val[ijk1] : 1.0)
-                  << std::setw(20) << BinCent(ijk2, bin[ijk2]) * (phys_units ? unit_val[ijk2] : 1.0);
-         PrintSumDistro(distfile, sum_counts, sum_distro, phys_units);
-         distfile << std::setw(20) << sum_counts << std::endl;
-      };
+All marginals are computed in one pass through the storage. The file contains the class name as in "Dump()", the number of events, the number of bins in each dimension, then the counts (long) and the weights of the three 1D marginals in the order of dimensions, followed by the counts and the weights of the three 2D marginals in the order of the collapsed dimension. The values are in code units.
+*/
+template <class distroClass>
+void DistributionTemplated<distroClass>::DumpMarginals(const std::string& file_name) const
+{
+   int ijk;
+   unsigned int datalen;
+   std::vector<long> counts_1d[3], counts_2d[3];
+   std::vector<distroClass> distro_1d[3], distro_2d[3];
+
+   Marginals(7, counts_1d, distro_1d, counts_2d, distro_2d);
+
+   std::ofstream distfile(file_name.c_str(), std::ofstream::binary);
+
+   datalen = class_name.length();
+   distfile.write((char*)&datalen, sizeof(datalen));
+   distfile.write(class_name.data(), datalen);
+
+   distfile.write((char*)&n_events, sizeof(n_events));
+   distfile.write((char*)n_bins.ijk, 3 * sizeof(int));
+
+   for(ijk = 0; ijk < 3; ijk++) {
+      distfile.write((char*)counts_1d[ijk].data(), counts_1d[ijk].size() * sizeof(long));
+      distfile.write((char*)distro_1d[ijk].data(), distro_1d[ijk].size() * sizeof(distroClass));
+   };
+   for(ijk = 0; ijk < 3; ijk++) {
+      distfile.write((char*)counts_2d[ijk].data(), counts_2d[ijk].size() * sizeof(long));
+      distfile.write((char*)distro_2d[ijk].data(), distro_2d[ijk].size() * sizeof(distroClass));
    };
 };
 
@@ -12,6 +12,7 @@ This file is part of the SPECTRUM suite of scientific numerical simulation codes
 
 #include "distribution_base.hh"
 #include "common/matrix.hh"
+#include "distribution_export.hh"
 
 namespace Spectrum {
 
@@ -60,6 +61,9 @@ protected:
 //! Dispatch routine to call the appropriate weight function
    void EvaluateWeight(int action_in) override;
 
+//! Return the linear index of the bin for the current event, or -1 if the event is outside the bins
+   int BinIdx(void) const;
+
 //! Add a single processed event
    void AddEvent(void) override;
 
@@ -69,8 +73,12 @@ protected:
 //! Obtain a normalized value in a bin
    distroClass operator [](const MultiIndex& bin) const;
 
+//! Sum the counts and weights over the collapsed dimensions in a single pass through the storage
+   void Marginals(uint8_t dims_2d, std::vector<long>* counts_1d, std::vector<distroClass>* distro_1d,
+                  std::vector<long>* counts_2d, std::vector<distroClass>* distro_2d) const;
+
 //! Class dependent portion of printing routines
-   void PrintSumDistro(std::ofstream& distfile, long sum_counts, distroClass sum_distro, bool phys_units) const;
+   void PrintSumDistro(std::string& buffer, long sum_counts, distroClass sum_distro, bool phys_units) const;
 
 //! Class dependent portion of record printing routines
    void PrintWeight(std::ofstream& distfile, int record, bool phys_units) const;
@@ -104,6 +112,12 @@ public:
 //! Restore the distribution from a dump file
    void Restore(const std::string& file_name) override;
 
+//! Export the distribution in the self-describing binary format
+   void Export(const std::string& file_name, bool phys_units) const override;
+
+//! Dump all 1D and 2D marginals of the distribution to a file
+   void DumpMarginals(const std::string& file_name) const override;
+
 //! Print the reduced distribution in 1D
    void Print1D(int ijk, const std::string& file_name, bool phys_units) const override;
 
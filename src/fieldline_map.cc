@@ -0,0 +1,380 @@
+/*!
+\file fieldline_map.cc
+\brief Defines a class to compute magnetic connectivity maps from a grid of seed points
+\author Swati Sharma
+
+This file is part of the SPECTRUM suite of scientific numerical simulation codes. SPECTRUM stands for Space Plasma and Energetic Charged particle TRansport on Unstructured Meshes. The code simulates plasma or neutral particle flows using MHD equations on a grid, transport of cosmic rays using stochastic or grid based methods. The "unstructured" part refers to the use of a geodesic mesh providing a uniform coverage of the surface of a sphere.
+*/
+
+#include "fieldline_map.hh"
+#include <iostream>
+#include <fstream>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace Spectrum {
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] pos    Start of the segment
+\param[in] seg    Segment vector
+\param[in] origin Center of the sphere
+\param[in] radius Radius of the sphere
+\param[in] larger Return the larger root (exit point) instead of the smaller one (entry point)
+\return Fraction of the segment at which it crosses the sphere, clamped to [0,1]
+*/
+static double SphereCrossing(const GeoVector& pos, const GeoVector& seg, const GeoVector& origin, double radius, bool larger)
+{
+   double a, b, c, disc, frac;
+   GeoVector rel = pos - origin;
+
+   a = seg * seg;
+   if(a < sp_tiny) return 0.0;
+   b = rel * seg;
+   c = rel * rel - Sqr(radius);
+   disc = sqrt(fmax(Sqr(b) - a * c, 0.0));
+   frac = (larger ? -b + disc : -b - disc) / a;
+   return fmin(fmax(frac, 0.0), 1.0);
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// FieldlineMap methods
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] background_in Background object of the desired type (only used as a prototype)
+\param[in] container_in  Parameters of the background
+*/
+FieldlineMap::FieldlineMap(const BackgroundBase& background_in, const DataContainer& container_in)
+            : bg_container(container_in)
+{
+   background = background_in.Clone();
+   background->SetupObject(bg_container);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] center  Center of the sphere
+\param[in] radius  Radius of the sphere
+\param[in] n_theta Number of seeds in colatitude
+\param[in] n_phi   Number of seeds in longitude
+
+The seeds are placed at the centers of a uniform (theta,phi) grid, so that the poles are avoided. Longitude varies fastest.
+*/
+void FieldlineMap::SetSeedsSphere(const GeoVector& center, double radius, int n_theta, int n_phi)
+{
+   int it, ip;
+   GeoVector pos;
+
+   seeds.clear();
+   seeds.reserve(n_theta * n_phi);
+   for(it = 0; it < n_theta; it++) {
+      for(ip = 0; ip < n_phi; ip++) {
+         pos = GeoVector(radius, M_PI * (it + 0.5) / n_theta, M_2PI * (ip + 0.5) / n_phi);
+         pos.RTP_XYZ();
+         seeds.push_back(center + pos);
+      };
+   };
+   dims[0] = n_theta;
+   dims[1] = n_phi;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] corner Corner of the patch
+\param[in] side1  First side of the patch
+\param[in] side2  Second side of the patch
+\param[in] n1     Number of seeds along the first side
+\param[in] n2     Number of seeds along the second side
+
+The seeds are placed at the centers of the cells. The second index varies fastest.
+*/
+void FieldlineMap::SetSeedsPlane(const GeoVector& corner, const GeoVector& side1, const GeoVector& side2, int n1, int n2)
+{
+   int i1, i2;
+
+   seeds.clear();
+   seeds.reserve(n1 * n2);
+   for(i1 = 0; i1 < n1; i1++) {
+      for(i2 = 0; i2 < n2; i2++) seeds.push_back(corner + ((i1 + 0.5) / n1) * side1 + ((i2 + 0.5) / n2) * side2);
+   };
+   dims[0] = n1;
+   dims[1] = n2;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] seeds_in Seed positions
+*/
+void FieldlineMap::SetSeeds(const std::vector<GeoVector>& seeds_in)
+{
+   seeds = seeds_in;
+   dims[0] = seeds.size();
+   dims[1] = 1;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] origin_in     Center of the inner and outer spheres
+\param[in] r_inner_in    Radius of the inner sphere
+\param[in] r_outer_in    Radius of the outer sphere
+\param[in] max_length_in Largest length of a line in one direction
+\param[in] max_steps_in  Largest number of steps in one direction
+*/
+void FieldlineMap::SetLimits(const GeoVector& origin_in, double r_inner_in, double r_outer_in, double max_length_in, int max_steps_in)
+{
+   origin = origin_in;
+   r_inner = r_inner_in;
+   r_outer = r_outer_in;
+   max_length = max_length_in;
+   max_steps = max_steps_in;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return Number of seeds
+*/
+int FieldlineMap::NSeeds(void) const
+{
+   return seeds.size();
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in]  evaluator  Background object used by this thread
+\param[in]  t          Time at which the field is traced
+\param[in]  n_lines    Number of seeds in the batch
+\param[in]  seed_pos   Seed positions
+\param[in]  phys_units Use physical units for output
+\param[out] records    Records for the seeds
+
+Line "2 * i + d" starts at seed "i" and is traced in the direction "2 * d - 1" relative to B. Only active lines are passed to the background, so the cost of a step decreases as the lines terminate.
+*/
+void FieldlineMap::TraceBatch(BackgroundBase* evaluator, double t, int n_lines, const GeoVector* seed_pos, bool phys_units, FieldlineMapRecord* records) const
+{
+   int i, d, xyz, ln, act, n_act, step;
+   double r, ds, frac;
+   int n_trace = 2 * n_lines;
+   std::vector<GeoVector> pos(n_trace), pos_eval(n_trace), pos_next(n_trace);
+   std::vector<double> length(n_trace, 0.0), ds_line(n_trace);
+   std::vector<int32_t> code(n_trace, FIELDLINE_END_STEPS);
+   std::vector<int> active, active_next;
+   std::vector<SpatialData> spdata(n_trace);
+   std::vector<uint16_t> status(n_trace);
+
+// Seeds outside of the region between the spheres terminate immediately
+   active.reserve(n_trace);
+   for(ln = 0; ln < n_trace; ln++) {
+      pos[ln] = seed_pos[ln / 2];
+      r = (pos[ln] - origin).Norm();
+      if(r <= r_inner) code[ln] = FIELDLINE_END_INNER;
+      else if(r >= r_outer) code[ln] = FIELDLINE_END_OUTER;
+      else active.push_back(ln);
+   };
+
+   for(step = 0; step < max_steps && active.size(); step++) {
+      n_act = active.size();
+
+// First stage: field direction at the start of the step
+      for(act = 0; act < n_act; act++) pos_eval[act] = pos[active[act]];
+      evaluator->GetFieldsArray(n_act, t, pos_eval.data(), BACKGROUND_B, spdata.data(), status.data());
+      for(act = 0; act < n_act; act++) {
+         ln = active[act];
+         if(status[act] != STATE_NONE) {
+            code[ln] = FIELDLINE_END_INVALID;
+            continue;
+         };
+         ds_line[ln] = (ln % 2 ? 1.0 : -1.0) * fmin(cfl_fieldline_map * spdata[act].dmax, max_length - length[ln]);
+         pos_eval[act] = pos[ln] + 0.5 * ds_line[ln] * spdata[act].bhat;
+      };
+
+// Second stage: field direction at the midpoint. Invalid lines from the first stage are evaluated again, but their result is ignored.
+      evaluator->GetFieldsArray(n_act, t, pos_eval.data(), BACKGROUND_B, spdata.data(), status.data());
+      active_next.clear();
+      for(act = 0; act < n_act; act++) {
+         ln = active[act];
+         if(code[ln] == FIELDLINE_END_INVALID) continue;
+         if(status[act] != STATE_NONE) {
+            code[ln] = FIELDLINE_END_INVALID;
+            continue;
+         };
+         pos_next[ln] = pos[ln] + ds_line[ln] * spdata[act].bhat;
+         ds = fabs(ds_line[ln]);
+
+// Crossing of the inner or outer sphere. The crossing point is found on the straight segment.
+         r = (pos_next[ln] - origin).Norm();
+         if(r <= r_inner || r >= r_outer) {
+            frac = SphereCrossing(pos[ln], pos_next[ln] - pos[ln], origin, (r <= r_inner ? r_inner : r_outer), r >= r_outer);
+            pos[ln] += frac * (pos_next[ln] - pos[ln]);
+            length[ln] += frac * ds;
+            code[ln] = (r <= r_inner ? FIELDLINE_END_INNER : FIELDLINE_END_OUTER);
+            continue;
+         };
+
+         pos[ln] = pos_next[ln];
+         length[ln] += ds;
+         if(length[ln] >= max_length) {
+            code[ln] = FIELDLINE_END_LENGTH;
+            continue;
+         };
+         active_next.push_back(ln);
+      };
+      active.swap(active_next);
+   };
+
+// Lines still active have code "FIELDLINE_END_STEPS"
+   double unit = (phys_units ? unit_length_fluid : 1.0);
+   for(i = 0; i < n_lines; i++) {
+      for(xyz = 0; xyz < 3; xyz++) records[i].seed[xyz] = seed_pos[i][xyz] * unit;
+      for(d = 0; d < 2; d++) {
+         ln = 2 * i + d;
+         for(xyz = 0; xyz < 3; xyz++) records[i].foot[d][xyz] = pos[ln][xyz] * unit;
+         records[i].length[d] = length[ln] * unit;
+         records[i].code[d] = code[ln];
+      };
+   };
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] file_base  Base name of the map files (without extension)
+\param[in] phys_units Use physical units for output
+\param[in] t          Time at which the field is traced
+\param[in] rank       Rank of this process among the processes sharing the work
+\param[in] n_ranks    Number of processes sharing the work
+*/
+void FieldlineMap::Trace(const std::string& file_base, bool phys_units, double t, int rank, int n_ranks)
+{
+   int n_threads, n_batches;
+   uint64_t n_seeds, seed_first, seed_last;
+   FieldlineMapHeader header;
+   std::string file_name;
+
+// Each rank takes a contiguous block of seeds
+   n_seeds = seeds.size();
+   seed_first = (n_seeds * rank) / n_ranks;
+   seed_last = (n_seeds * (rank + 1)) / n_ranks;
+   std::vector<FieldlineMapRecord> records(seed_last - seed_first);
+   n_batches = (records.size() + fieldline_map_batch - 1) / fieldline_map_batch;
+
+// Evaluators for each thread. The clones only share the persistent data, so this is only safe when the background does not use a server.
+   std::vector<std::unique_ptr<BackgroundBase>> clones;
+   std::vector<BackgroundBase*> evaluators(1, background.get());
+#if defined(_OPENMP) && (SERVER_TYPE == SERVER_SELF)
+   n_threads = omp_get_max_threads();
+   for(int thr = 1; thr < n_threads; thr++) {
+      clones.push_back(background->Clone());
+      clones.back()->SetupObject(bg_container);
+      evaluators.push_back(clones.back().get());
+   };
+#else
+   n_threads = 1;
+#endif
+
+// Lines have very different lengths, so the batches are distributed dynamically
+#pragma omp parallel for schedule(dynamic) num_threads(n_threads)
+   for(int batch = 0; batch < n_batches; batch++) {
+#if defined(_OPENMP) && (SERVER_TYPE == SERVER_SELF)
+      BackgroundBase* evaluator = evaluators[omp_get_thread_num()];
+#else
+      BackgroundBase* evaluator = evaluators[0];
+#endif
+      int first = batch * fieldline_map_batch;
+      int n_lines = std::min(fieldline_map_batch, (int)records.size() - first);
+      TraceBatch(evaluator, t, n_lines, seeds.data() + seed_first + first, phys_units, records.data() + first);
+   };
+
+// Write the records of this rank
+   std::memcpy(header.magic, fieldline_map_magic, 8);
+   header.dims[0] = dims[0];
+   header.dims[1] = dims[1];
+   header.n_seeds = n_seeds;
+   header.seed_first = seed_first;
+   header.n_records = records.size();
+   header.phys_units = phys_units;
+   header.record_size = sizeof(FieldlineMapRecord);
+
+   file_name = file_base + (n_ranks == 1 ? "" : "_" + std::to_string(rank)) + ".flm";
+   std::ofstream map_file(file_name, std::ofstream::binary);
+   if(!map_file.is_open()) {
+      std::cerr << "FieldlineMap: cannot open " << file_name << " for writing" << std::endl;
+      return;
+   };
+   map_file.write((char*)&header, sizeof(header));
+   map_file.write((char*)records.data(), records.size() * sizeof(FieldlineMapRecord));
+   map_file.close();
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] file_base Base name of the map files (without extension)
+\param[in] n_ranks   Number of processes that wrote the map
+\return True if all parts were found and are consistent
+
+The merged map is written to "<file_base>.flm". The part files are not removed.
+*/
+bool FieldlineMap::MergeParts(const std::string& file_base, int n_ranks)
+{
+   int rank;
+   uint64_t seed_next = 0;
+   FieldlineMapHeader header, header_part;
+   std::vector<FieldlineMapRecord> records, records_part;
+
+   for(rank = 0; rank < n_ranks; rank++) {
+      std::string file_name = file_base + "_" + std::to_string(rank) + ".flm";
+      std::ifstream part_file(file_name, std::ifstream::binary);
+      if(!part_file.is_open()) {
+         std::cerr << "FieldlineMap: cannot open " << file_name << " for reading" << std::endl;
+         return false;
+      };
+      part_file.read((char*)&header_part, sizeof(header_part));
+
+// The parts must follow each other without gaps
+      if(!part_file || std::memcmp(header_part.magic, fieldline_map_magic, 8) || header_part.record_size != sizeof(FieldlineMapRecord)
+         || header_part.seed_first != seed_next) {
+         std::cerr << "FieldlineMap: " << file_name << " is not a valid part of the map" << std::endl;
+         return false;
+      };
+      if(!rank) {
+         header = header_part;
+         records.reserve(header.n_seeds);
+      };
+
+      records_part.resize(header_part.n_records);
+      part_file.read((char*)records_part.data(), records_part.size() * sizeof(FieldlineMapRecord));
+      if(!part_file) {
+         std::cerr << "FieldlineMap: " << file_name << " is truncated" << std::endl;
+         return false;
+      };
+      records.insert(records.end(), records_part.begin(), records_part.end());
+      seed_next += header_part.n_records;
+   };
+
+   if(seed_next != header.n_seeds) {
+      std::cerr << "FieldlineMap: the parts cover " << seed_next << " out of " << header.n_seeds << " seeds" << std::endl;
+      return false;
+   };
+
+   header.seed_first = 0;
+   header.n_records = records.size();
+   std::ofstream map_file(file_base + ".flm", std::ofstream::binary);
+   if(!map_file.is_open()) return false;
+   map_file.write((char*)&header, sizeof(header));
+   map_file.write((char*)records.data(), records.size() * sizeof(FieldlineMapRecord));
+   map_file.close();
+   return true;
+};
+
+};
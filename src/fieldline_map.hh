@@ -0,0 +1,170 @@
+/*!
+\file fieldline_map.hh
+\brief Declares a class to compute magnetic connectivity maps from a grid of seed points
+\author Swati Sharma
+
+This file is part of the SPECTRUM suite of scientific numerical simulation codes. SPECTRUM stands for Space Plasma and Energetic Charged particle TRansport on Unstructured Meshes. The code simulates plasma or neutral particle flows using MHD equations on a grid, transport of cosmic rays using stochastic or grid based methods. The "unstructured" part refers to the use of a geodesic mesh providing a uniform coverage of the surface of a sphere.
+*/
+
+#ifndef SPECTRUM_FIELDLINE_MAP_HH
+#define SPECTRUM_FIELDLINE_MAP_HH
+
+#include "background_base.hh"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Spectrum {
+
+//! Identifier at the beginning of a connectivity map file
+const char fieldline_map_magic[8] = {'S', 'P', 'F', 'L', 'M', 'A', 'P', '1'};
+
+//! Tracing step as a fraction of "dmax"
+const double cfl_fieldline_map = 0.5;
+
+//! Number of seeds traced together by one thread
+const int fieldline_map_batch = 256;
+
+//! Termination code: the line reached the inner sphere (footpoint)
+const int32_t FIELDLINE_END_INNER = 0;
+
+//! Termination code: the line reached the outer sphere
+const int32_t FIELDLINE_END_OUTER = 1;
+
+//! Termination code: the maximum length was reached
+const int32_t FIELDLINE_END_LENGTH = 2;
+
+//! Termination code: the maximum number of steps was reached
+const int32_t FIELDLINE_END_STEPS = 3;
+
+//! Termination code: the fields could not be evaluated (outside of the domain or a null point)
+const int32_t FIELDLINE_END_INVALID = 4;
+
+/*!
+\brief File header of a connectivity map
+\author Swati Sharma
+*/
+struct FieldlineMapHeader {
+
+//! File identifier
+   char magic[8];
+
+//! Dimensions of the seed grid (the second dimension is 1 for a list of seeds)
+   uint32_t dims[2];
+
+//! Total number of seeds in the map
+   uint64_t n_seeds;
+
+//! Index of the first seed in this file
+   uint64_t seed_first;
+
+//! Number of records in this file
+   uint64_t n_records;
+
+//! Whether the coordinates and lengths are in physical units
+   uint32_t phys_units;
+
+//! Size of one record in bytes
+   uint32_t record_size;
+};
+
+/*!
+\brief Connectivity of one seed point
+\author Swati Sharma
+
+Index 0 refers to the line traced against the field direction and index 1 along the field direction.
+*/
+struct FieldlineMapRecord {
+
+//! Seed position
+   float seed[3];
+
+//! End points of the line
+   float foot[2][3];
+
+//! Lengths of the line from the seed to each end point
+   float length[2];
+
+//! Termination codes
+   int32_t code[2];
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// FieldlineMap class declaration
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\brief Traces magnetic field lines from a grid of seeds in both directions and records where they end
+\author Swati Sharma
+
+The seeds are split between ranks in contiguous blocks and between threads in batches of "fieldline_map_batch". All lines in a batch, in both directions, are advanced together with the midpoint method, so that each stage requires a single call to "BackgroundBase::GetFieldsArray()" for all active lines. The step is "cfl_fieldline_map * dmax". A line terminates when it crosses the inner or the outer sphere (the crossing point is found exactly on the last segment), exceeds the maximum length or number of steps, or enters a region where the fields cannot be evaluated.
+
+Each rank writes its records to "<file_base>_<rank>.flm" (or "<file_base>.flm" for a single rank). A file is a "FieldlineMapHeader" followed by the records in seed order. "MergeParts()" combines the rank files into one map.
+*/
+class FieldlineMap {
+
+protected:
+
+//! Background used to evaluate the field
+   std::unique_ptr<BackgroundBase> background;
+
+//! Parameters of the background (for cloning)
+   DataContainer bg_container;
+
+//! Seed positions
+   std::vector<GeoVector> seeds;
+
+//! Dimensions of the seed grid
+   uint32_t dims[2] = {0, 1};
+
+//! Center of the inner and outer spheres
+   GeoVector origin = gv_zeros;
+
+//! Radius of the inner sphere
+   double r_inner = 0.0;
+
+//! Radius of the outer sphere
+   double r_outer = sp_large;
+
+//! Largest length of a line in one direction
+   double max_length = sp_large;
+
+//! Largest number of steps in one direction
+   int max_steps = 100000;
+
+//! Trace the lines from a batch of seeds in both directions
+   void TraceBatch(BackgroundBase* evaluator, double t, int n_lines, const GeoVector* seed_pos, bool phys_units, FieldlineMapRecord* records) const;
+
+public:
+
+//! Default constructor (deleted)
+   FieldlineMap(void) = delete;
+
+//! Constructor with arguments
+   FieldlineMap(const BackgroundBase& background_in, const DataContainer& container_in);
+
+//! Seeds on a sphere, uniform in colatitude and longitude
+   void SetSeedsSphere(const GeoVector& center, double radius, int n_theta, int n_phi);
+
+//! Seeds on a rectangular patch of a plane
+   void SetSeedsPlane(const GeoVector& corner, const GeoVector& side1, const GeoVector& side2, int n1, int n2);
+
+//! Seeds from a list
+   void SetSeeds(const std::vector<GeoVector>& seeds_in);
+
+//! Set the termination conditions
+   void SetLimits(const GeoVector& origin_in, double r_inner_in, double r_outer_in, double max_length_in, int max_steps_in);
+
+//! Return the number of seeds
+   int NSeeds(void) const;
+
+//! Trace this rank's share of the seeds and write the records
+   void Trace(const std::string& file_base, bool phys_units, double t = 0.0, int rank = 0, int n_ranks = 1);
+
+//! Combine the files written by all ranks into one map
+   static bool MergeParts(const std::string& file_base, int n_ranks);
+};
+
+};
+
+#endif
@@ -11,7 +11,7 @@ This file is part of the SPECTRUM suite of scientific numerical simulation codes
 
 namespace Spectrum {
 
-#if (TRAJ_TYPE == TRAJ_LORENTZ) || (TRAJ_TYPE == TRAJ_FIELDLINE)
+#if (TRAJ_TYPE == TRAJ_LORENTZ) || (TRAJ_TYPE == TRAJ_HYBRID) || (TRAJ_TYPE == TRAJ_FIELDLINE)
 
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 // InitialMomentumFixed methods
@@ -137,7 +137,7 @@ void InitialMomentumBeam::SetupInitial(bool construct)
    if(!construct) InitialBase::SetupInitial(false);
    container.Read(&p0);
 
-#if (TRAJ_TYPE == TRAJ_GUIDING) || (TRAJ_TYPE == TRAJ_GUIDING_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF_SCATT)
+#if (TRAJ_TYPE == TRAJ_GUIDING) || (TRAJ_TYPE == TRAJ_GUIDING_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_BOUNCE)
    _mom = GeoVector(0.0, 0.0, p0);
 #elif TRAJ_TYPE == TRAJ_FOCUSED
    _mom = GeoVector(p0, 0.0, 0.0);
@@ -150,9 +150,9 @@ void InitialMomentumBeam::SetupInitial(bool construct)
 */
 void InitialMomentumBeam::EvaluateInitial(void)
 {
-#if (TRAJ_TYPE == TRAJ_GUIDING) || (TRAJ_TYPE == TRAJ_GUIDING_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF_SCATT) || (TRAJ_TYPE == TRAJ_FOCUSED)
+#if (TRAJ_TYPE == TRAJ_GUIDING) || (TRAJ_TYPE == TRAJ_GUIDING_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_BOUNCE) || (TRAJ_TYPE == TRAJ_FOCUSED)
 // Nothing to do - the value of "_mom" was assigned in "SetupInitial()"
-#elif (TRAJ_TYPE == TRAJ_LORENTZ)
+#elif (TRAJ_TYPE == TRAJ_LORENTZ) || (TRAJ_TYPE == TRAJ_HYBRID)
    _mom = p0 * axis;
 #endif
 };
@@ -208,7 +208,7 @@ void InitialMomentumRing::SetupInitial(bool construct)
    mu0 = cos(theta0);
    st0 = sin(theta0);
 
-#if (TRAJ_TYPE == TRAJ_GUIDING) || (TRAJ_TYPE == TRAJ_GUIDING_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF_SCATT)
+#if (TRAJ_TYPE == TRAJ_GUIDING) || (TRAJ_TYPE == TRAJ_GUIDING_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_BOUNCE)
    _mom = GeoVector(p0 * st0, 0.0, p0 * mu0);
 #elif TRAJ_TYPE == TRAJ_FOCUSED
    _mom = GeoVector(p0, mu0, 0.0);
@@ -221,9 +221,9 @@ void InitialMomentumRing::SetupInitial(bool construct)
 */
 void InitialMomentumRing::EvaluateInitial(void)
 {
-#if (TRAJ_TYPE == TRAJ_GUIDING) || (TRAJ_TYPE == TRAJ_GUIDING_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF_SCATT) || (TRAJ_TYPE == TRAJ_FOCUSED)
+#if (TRAJ_TYPE == TRAJ_GUIDING) || (TRAJ_TYPE == TRAJ_GUIDING_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_BOUNCE) || (TRAJ_TYPE == TRAJ_FOCUSED)
 // Nothing to do - the value of "_mom" was assigned in "SetupInitial()"
-#elif (TRAJ_TYPE == TRAJ_LORENTZ)
+#elif (TRAJ_TYPE == TRAJ_LORENTZ) || (TRAJ_TYPE == TRAJ_HYBRID)
 
    double phi = M_2PI * rng->GetUniform();
    GeoVector e1, e2;
@@ -297,7 +297,7 @@ void InitialMomentumShell::EvaluateInitial(void)
 {
 #if (TRAJ_TYPE == TRAJ_PARKER) || (TRAJ_TYPE == TRAJ_FIELDLINE)
 // Nothing to do - the value of "_mom" was assigned in "SetupInitial()"
-#elif (TRAJ_TYPE == TRAJ_GUIDING) || (TRAJ_TYPE == TRAJ_GUIDING_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF_SCATT) || (TRAJ_TYPE == TRAJ_FOCUSED)
+#elif (TRAJ_TYPE == TRAJ_GUIDING) || (TRAJ_TYPE == TRAJ_GUIDING_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_BOUNCE) || (TRAJ_TYPE == TRAJ_FOCUSED)
 
    double mu, st;
 
@@ -310,7 +310,7 @@ void InitialMomentumShell::EvaluateInitial(void)
    _mom = GeoVector(p0 * st, 0.0, p0 * mu);
 #endif
 
-#elif TRAJ_TYPE == TRAJ_LORENTZ
+#elif (TRAJ_TYPE == TRAJ_LORENTZ) || (TRAJ_TYPE == TRAJ_HYBRID)
 
    double mu, st, phi;
    mu = -1.0 + 2.0 * rng->GetUniform();
@@ -385,7 +385,7 @@ void InitialMomentumThickShell::EvaluateInitial(void)
    _mom = GeoVector(p, 0.0, 0.0);
 #elif TRAJ_TYPE == TRAJ_FIELDLINE
    _mom = GeoVector(0.0, 0.0, p);
-#elif (TRAJ_TYPE == TRAJ_GUIDING) || (TRAJ_TYPE == TRAJ_GUIDING_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF_SCATT) || (TRAJ_TYPE == TRAJ_FOCUSED)
+#elif (TRAJ_TYPE == TRAJ_GUIDING) || (TRAJ_TYPE == TRAJ_GUIDING_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_BOUNCE) || (TRAJ_TYPE == TRAJ_FOCUSED)
 
    double mu, st;
 
@@ -398,7 +398,7 @@ void InitialMomentumThickShell::EvaluateInitial(void)
    _mom = GeoVector(p * st, 0.0, p * mu);
 #endif
 
-#elif TRAJ_TYPE == TRAJ_LORENTZ
+#elif (TRAJ_TYPE == TRAJ_LORENTZ) || (TRAJ_TYPE == TRAJ_HYBRID)
 
    double mu, st, phi;
    mu = -1.0 + 2.0 * rng->GetUniform();
@@ -519,7 +519,7 @@ void InitialMomentumMaxwell::EvaluateInitial(void)
    double p_para = p0 + dp_para * rng->GetNormal();
    double p_perp = dp_perp * rng->GetRayleigh();
 
-#if TRAJ_TYPE == TRAJ_LORENTZ
+#if (TRAJ_TYPE == TRAJ_LORENTZ) || (TRAJ_TYPE == TRAJ_HYBRID)
 
    double phi = M_2PI * rng->GetUniform();
    GeoVector e1, e2;
@@ -527,7 +527,7 @@ void InitialMomentumMaxwell::EvaluateInitial(void)
    e2 = axis ^ e1;
    _mom = p_para * axis + p_perp * (cos(phi) * e1 + sin(phi) * e2);
 
-#elif (TRAJ_TYPE == TRAJ_GUIDING) || (TRAJ_TYPE == TRAJ_GUIDING_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF_SCATT)
+#elif (TRAJ_TYPE == TRAJ_GUIDING) || (TRAJ_TYPE == TRAJ_GUIDING_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF) || (TRAJ_TYPE == TRAJ_GUIDING_DIFF_SCATT) || (TRAJ_TYPE == TRAJ_GUIDING_BOUNCE)
    _mom = GeoVector(p_perp, 0.0, p_para);
 
 #else
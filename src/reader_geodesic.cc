@@ -0,0 +1,261 @@
+/*!
+\file reader_geodesic.cc
+\brief Implements a global structure of data reader for a geodesic grid
+\author Swati Sharma
+
+This file is part of the SPECTRUM suite of scientific numerical simulation codes. SPECTRUM stands for Space Plasma and Energetic Charged particle TRansport on Unstructured Meshes. The code simulates plasma or neutral particle flows using MHD equations on a grid, transport of cosmic rays using stochastic or grid based methods. The "unstructured" part refers to the use of a geodesic mesh providing a uniform coverage of the surface of a sphere.
+*/
+
+#include "reader_geodesic.hh"
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <algorithm>
+
+namespace Spectrum {
+
+//! Global geodesic data structure
+ReaderGeodesic GeoData;
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] slab Radial slab
+\return Pointer to the radial interfaces of the slab
+*/
+static inline const double* SlabInterfaces(int slab)
+{
+   return GeoData.r_in + slab * (GeoData.n_shells + 1);
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// ReaderGeodesic methods
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] data_filename null terminated character array containing the name of the data file
+\param[in] verbose       flag to output status messages (1) or not (0)
+*/
+void ReadGeodesicData(const char* data_filename, int verbose)
+{
+   int n_blocks;
+   std::ifstream data_file(data_filename, std::ios::binary);
+
+   if(!data_file.is_open()) {
+      std::cerr << "ReadGeodesicData Error: Could not open " << data_filename << std::endl;
+      return;
+   };
+
+// Read the dimensions
+   data_file.read((char*)&GeoData.verts_per_face, sizeof(int));
+   data_file.read((char*)&GeoData.n_sectors, sizeof(int));
+   data_file.read((char*)&GeoData.n_slabs, sizeof(int));
+   data_file.read((char*)&GeoData.n_faces, sizeof(int));
+   data_file.read((char*)&GeoData.n_shells, sizeof(int));
+   data_file.read((char*)&GeoData.ghost_height, sizeof(int));
+   data_file.read((char*)&GeoData.Nvar, sizeof(int));
+   data_file.read((char*)&GeoData.Rmin, sizeof(double));
+   data_file.read((char*)&GeoData.Rmax, sizeof(double));
+
+   n_blocks = GeoData.n_sectors * GeoData.n_slabs;
+   GeoData.data_block_size = GeoData.Nvar * GeoData.n_faces * GeoData.n_shells;
+
+   if(verbose) {
+      std::cerr << "Reading geodesic data file: " << data_filename << std::endl;
+      std::cerr << std::setw(8) << "Verts"
+                << std::setw(10) << "Sectors"
+                << std::setw(8) << "Slabs"
+                << std::setw(8) << "Faces"
+                << std::setw(8) << "Shells"
+                << std::setw(8) << "Vars"
+                << std::setw(16) << "Rmin"
+                << std::setw(16) << "Rmax"
+                << std::endl;
+      std::cerr << std::setw(8) << GeoData.verts_per_face
+                << std::setw(10) << GeoData.n_sectors
+                << std::setw(8) << GeoData.n_slabs
+                << std::setw(8) << GeoData.n_faces
+                << std::setw(8) << GeoData.n_shells
+                << std::setw(8) << GeoData.Nvar
+                << std::setw(16) << std::setprecision(6) << GeoData.Rmin
+                << std::setw(16) << std::setprecision(6) << GeoData.Rmax
+                << std::endl;
+   };
+
+// Allocate memory
+   GeoData.sector_corners = new GeoVector[GeoData.n_sectors * GeoData.verts_per_face];
+   GeoData.face_cent = new GeoVector[GeoData.n_sectors * GeoData.n_faces];
+   GeoData.ff = new int[GeoData.n_sectors * GeoData.n_faces * GeoData.verts_per_face];
+   GeoData.interior = new int[GeoData.n_sectors * GeoData.n_faces];
+   GeoData.r_in = new double[GeoData.n_slabs * (GeoData.n_shells + 1)];
+   GeoData.variables_by_block = new double[n_blocks * GeoData.data_block_size];
+
+// Read the sector geometry
+   for(auto sector = 0; sector < GeoData.n_sectors; sector++) {
+      data_file.read((char*)(GeoData.sector_corners + sector * GeoData.verts_per_face), GeoData.verts_per_face * sizeof(GeoVector));
+      data_file.read((char*)(GeoData.face_cent + sector * GeoData.n_faces), GeoData.n_faces * sizeof(GeoVector));
+      data_file.read((char*)(GeoData.ff + sector * GeoData.n_faces * GeoData.verts_per_face), GeoData.n_faces * GeoData.verts_per_face * sizeof(int));
+      data_file.read((char*)(GeoData.interior + sector * GeoData.n_faces), GeoData.n_faces * sizeof(int));
+   };
+
+// Read the radial grid and the variables
+   data_file.read((char*)GeoData.r_in, GeoData.n_slabs * (GeoData.n_shells + 1) * sizeof(double));
+   data_file.read((char*)GeoData.variables_by_block, n_blocks * GeoData.data_block_size * sizeof(double));
+
+   if(!data_file) std::cerr << "ReadGeodesicData Error: File " << data_filename << " is truncated\n";
+   data_file.close();
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+void ReadGeodesicClean(void)
+{
+   delete[] GeoData.sector_corners;
+   delete[] GeoData.face_cent;
+   delete[] GeoData.ff;
+   delete[] GeoData.interior;
+   delete[] GeoData.r_in;
+   delete[] GeoData.variables_by_block;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[out] domain_min Minimum domain coordinate
+\param[out] domain_max Maximum domain coordinate
+*/
+void ReadGeodesicGetDomain(double* domain_min_out, double* domain_max_out)
+{
+   for(auto xyz = 0; xyz < 3; xyz++) {
+      domain_min_out[xyz] = -GeoData.Rmax;
+      domain_max_out[xyz] = GeoData.Rmax;
+   };
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[out] dims Vertices per face, faces, shells, ghost shells, and variables
+*/
+void ReadGeodesicGetDimensions(int* dims)
+{
+   dims[0] = GeoData.verts_per_face;
+   dims[1] = GeoData.n_faces;
+   dims[2] = GeoData.n_shells;
+   dims[3] = GeoData.ghost_height;
+   dims[4] = GeoData.Nvar;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in]  pos     current position
+\param[out] node_id node ID containing pos, or -1 if outside the domain
+*/
+void ReadGeodesicGetNode(const double* pos, int* node_id)
+{
+   int sector, slab;
+   GeoVector v(pos);
+   double r = v.Norm();
+
+   *node_id = -1;
+   if((r < GeoData.Rmin) || (r > GeoData.Rmax)) {
+      std::cerr << "ReadGeodesicGetNode Error: Position outside of domain bounds.\n";
+      return;
+   };
+
+// Find the sector
+   for(sector = 0; sector < GeoData.n_sectors; sector++) {
+      if(InsideSphericalPolygon(GeoData.verts_per_face, GeoData.sector_corners + sector * GeoData.verts_per_face, v)) break;
+   };
+   if(sector == GeoData.n_sectors) return;
+
+// Find the slab. The slabs are ordered by radius, so the last slab whose inner boundary is below "r" is the owner.
+   for(slab = GeoData.n_slabs - 1; slab > 0; slab--) {
+      if(r >= SlabInterfaces(slab)[GeoData.ghost_height]) break;
+   };
+
+   *node_id = sector * GeoData.n_slabs + slab;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in]  pos   current position
+\param[out] vars  variables array
+\param[out] found flag to see if point was found
+\note This returns the values in the zone whose center is closest to the position.
+*/
+void ReadGeodesicGetBlockData(const double* pos, double* vars, int* found)
+{
+   int node, sector, slab, face, shell, best_face = -1;
+   double r, dot, best_dot = -2.0;
+   const double* r_in;
+   GeoVector v(pos);
+
+   ReadGeodesicGetNode(pos, &node);
+   *found = (node != -1);
+   if(!*found) return;
+
+   sector = node / GeoData.n_slabs;
+   slab = node % GeoData.n_slabs;
+
+// Closest face center among the interior faces of the sector
+   r = v.Norm();
+   v /= r;
+   for(face = 0; face < GeoData.n_faces; face++) {
+      if(!GeoData.interior[sector * GeoData.n_faces + face]) continue;
+      dot = GeoData.face_cent[sector * GeoData.n_faces + face] * v;
+      if(dot > best_dot) {
+         best_dot = dot;
+         best_face = face;
+      };
+   };
+
+// Shell containing the radius
+   r_in = SlabInterfaces(slab);
+   shell = std::upper_bound(r_in, r_in + GeoData.n_shells + 1, r) - r_in - 1;
+   shell = std::clamp(shell, GeoData.ghost_height, GeoData.n_shells - GeoData.ghost_height - 1);
+
+   memcpy(vars, GeoData.variables_by_block + GeoData.data_block_size * node + GeoData.Nvar * (best_face + GeoData.n_faces * shell),
+          GeoData.Nvar * sizeof(double));
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in]  node      node ID
+\param[out] corners   sector corners
+\param[out] face_cent face centers
+\param[out] ff        face neighbors
+\param[out] interior  interior face flags
+\param[out] r_in      radial interfaces
+*/
+void ReadGeodesicGetBlockGeometry(int node, double* corners, double* face_cent, int* ff, int* interior, double* r_in)
+{
+   int sector = node / GeoData.n_slabs;
+   int slab = node % GeoData.n_slabs;
+
+   memcpy(corners, GeoData.sector_corners + sector * GeoData.verts_per_face, GeoData.verts_per_face * sizeof(GeoVector));
+   memcpy(face_cent, GeoData.face_cent + sector * GeoData.n_faces, GeoData.n_faces * sizeof(GeoVector));
+   memcpy(ff, GeoData.ff + sector * GeoData.n_faces * GeoData.verts_per_face, GeoData.n_faces * GeoData.verts_per_face * sizeof(int));
+   memcpy(interior, GeoData.interior + sector * GeoData.n_faces, GeoData.n_faces * sizeof(int));
+   memcpy(r_in, SlabInterfaces(slab), (GeoData.n_shells + 1) * sizeof(double));
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in]  node       node ID
+\param[out] block_vars variables in the block
+*/
+void ReadGeodesicGetBlockData(int node, double* block_vars)
+{
+   memcpy(block_vars, GeoData.variables_by_block + GeoData.data_block_size * node, GeoData.data_block_size * sizeof(double));
+};
+
+};
@@ -0,0 +1,141 @@
+/*!
+\file reader_geodesic.hh
+\brief Defines a global structure of data reader for a geodesic grid
+\author Swati Sharma
+
+This file is part of the SPECTRUM suite of scientific numerical simulation codes. SPECTRUM stands for Space Plasma and Energetic Charged particle TRansport on Unstructured Meshes. The code simulates plasma or neutral particle flows using MHD equations on a grid, transport of cosmic rays using stochastic or grid based methods. The "unstructured" part refers to the use of a geodesic mesh providing a uniform coverage of the surface of a sphere.
+*/
+
+#ifndef SPECTRUM_READER_GEODESIC_HH
+#define SPECTRUM_READER_GEODESIC_HH
+
+#include "common/vectors.hh"
+
+namespace Spectrum {
+
+//! Number of integers describing the block dimensions (verts per face, faces, shells, ghost shells, variables)
+const int n_dims_geodesic = 5;
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// ReaderGeodesic structure declaration
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\brief Contents of a geodesic grid data file
+\author Swati Sharma
+
+The domain is a spherical shell partitioned into sectors (the faces of a coarse tesselation) and radial slabs. Each block is the intersection of a sector and a slab and is stored together with its ghost layers, so that interpolation never requires data from another block. All sectors have the same number of faces and all slabs have the same number of shells. The file is binary (native byte order) with the following layout:
+
+   int    verts_per_face, n_sectors, n_slabs, n_faces, n_shells, ghost_height, Nvar
+   double Rmin, Rmax
+   for each sector:
+      double corners[verts_per_face][3]       sector vertices on the unit sphere, counter-clockwise looking from outside
+      double face_cent[n_faces][3]            face centers on the unit sphere, including ghost faces
+      int    ff[n_faces][verts_per_face]      neighbor faces of each face (-1 if absent)
+      int    interior[n_faces]                1 for faces interior to the sector, 0 for ghost faces
+   for each slab:
+      double r_in[n_shells + 1]               radial interfaces, including ghost shells
+   for each block (sector major, slab minor):
+      double variables[n_shells][n_faces][Nvar]
+
+The block (node) index is "sector * n_slabs + slab".
+*/
+struct ReaderGeodesic {
+
+//! Number of vertices per face
+   int verts_per_face;
+
+//! Number of sectors
+   int n_sectors;
+
+//! Number of radial slabs
+   int n_slabs;
+
+//! Number of faces per sector, including ghost faces
+   int n_faces;
+
+//! Number of shells per slab, including ghost shells
+   int n_shells;
+
+//! Number of ghost shells on each side of a slab
+   int ghost_height;
+
+//! Number of variables per zone
+   int Nvar;
+
+//! Number of variables per block
+   int data_block_size;
+
+//! Inner radius of the domain
+   double Rmin;
+
+//! Outer radius of the domain
+   double Rmax;
+
+//! Sector corners, [sector][vertex]
+   GeoVector* sector_corners = nullptr;
+
+//! Face centers, [sector][face]
+   GeoVector* face_cent = nullptr;
+
+//! Face neighbors, [sector][face][vertex]
+   int* ff = nullptr;
+
+//! Interior face flags, [sector][face]
+   int* interior = nullptr;
+
+//! Radial interfaces, [slab][interface]
+   double* r_in = nullptr;
+
+//! Array with ALL geodesic variables organized by block
+   double* variables_by_block = nullptr;
+};
+
+/*!
+\brief Test whether a direction lies inside a spherical polygon with great circle edges
+\author Swati Sharma
+\date 10/17/2026
+\param[in] n       Number of vertices
+\param[in] corners Vertices of the polygon, counter-clockwise looking from outside
+\param[in] v       Direction to test (need not be normalized)
+\return True if "v" is inside or on the boundary
+*/
+inline bool InsideSphericalPolygon(int n, const GeoVector* corners, const GeoVector& v)
+{
+   for(auto iv = 0; iv < n; iv++) {
+      if(((corners[iv] ^ corners[(iv + 1) % n]) * v) < 0.0) return false;
+   };
+   return true;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// ReaderGeodesic structure global functions declaration
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+//! Read file containing geodesic data
+void ReadGeodesicData(const char* filename, int verbose);
+
+//! De-allocate global geodesic structure arrays
+void ReadGeodesicClean(void);
+
+//! Get domain coordinate limits
+void ReadGeodesicGetDomain(double* domain_min_out, double* domain_max_out);
+
+//! Get the block dimensions
+void ReadGeodesicGetDimensions(int* dims);
+
+//! Get node ID from position
+void ReadGeodesicGetNode(const double* pos, int* node_id);
+
+//! Get variables from position
+void ReadGeodesicGetBlockData(const double* pos, double* vars, int* found);
+
+//! Get the geometry of a block
+void ReadGeodesicGetBlockGeometry(int node, double* corners, double* face_cent, int* ff, int* interior, double* r_in);
+
+//! Get all variables of a block
+void ReadGeodesicGetBlockData(int node, double* block_vars);
+
+};
+
+#endif
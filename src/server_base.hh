@@ -261,8 +261,8 @@ public:
    void InvalidateCache(void);
 
 #ifdef NEED_SERVER
-//! Obtain the variables
-   virtual void GetVariables(double t, const GeoVector& pos, SpatialData& spdata) = 0;
+//! Obtain the variables, returning false if the position is outside of the domain
+   virtual bool GetVariables(double t, const GeoVector& pos, SpatialData& spdata) = 0;
 
 //! Obtain the gradients
    virtual void GetGradients(SpatialData& spdata) = 0;
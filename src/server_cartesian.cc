@@ -342,7 +342,7 @@ int ServerCartesianFront::BuildInterpolationStencil(const GeoVector& pos)
 \author Vladimir Florinski
 \author Juan G Alonso Guzman
 \date 12/01/2023
-\return Index of the block in "cache_line"
+\return Index of the block in "cache_line", or -1 if the server could not find the position
 */
 int ServerCartesianFront::RequestBlock(void)
 {
@@ -377,6 +377,9 @@ int ServerCartesianFront::RequestBlock(void)
 // Receive the block in 4 parts (member data plus 3 dynamic arrays). This is called even if SERVER_INTERP_ORDER is -1 to import the block dimensions
       MPI_Recv(block_new.get(), 1, MPIBlockType, 0, tag_sendblock, mpi_config->node_comm, MPI_STATUS_IGNORE);
 
+// The server could not find the position, so only the header was sent
+      if(block_new->GetNode() == -1) return -1;
+
 #if SERVER_INTERP_ORDER > -1
       MPI_Recv(block_new->GetVariablesAddress(), block_new->GetVariableCount() * block_new->GetZoneCount(), MPI_DOUBLE, 0,
                tag_sendblock, mpi_config->node_comm, MPI_STATUS_IGNORE);
@@ -672,8 +675,9 @@ void ServerCartesianFront::GetVariablesInterp1(const GeoVector& pos, SpatialData
 \param[in]  t      Time
 \param[in]  pos    Position
 \param[out] spdata Fields, dmax, etc.
+\return False if the position is outside of the domain
 */
-void ServerCartesianFront::GetVariables(double t, const GeoVector& pos, SpatialData& spdata)
+bool ServerCartesianFront::GetVariables(double t, const GeoVector& pos, SpatialData& spdata)
 {
    int bidx;
 
@@ -681,6 +685,7 @@ void ServerCartesianFront::GetVariables(double t, const GeoVector& pos, SpatialD
    _inquiry.type = 1;
    _inquiry.pos = pos;
    bidx = RequestBlock();
+   if(bidx == -1) return false;
 
 // If "block_pri" or "block_sec" is the position owner (based on the call to RequestBlock), we don't need to acccess the cache
    if(block_pri->GetNode() != bidx) {
@@ -711,6 +716,7 @@ void ServerCartesianFront::GetVariables(double t, const GeoVector& pos, SpatialD
    spdata.Bvec *= unit_magnetic_server / unit_magnetic_fluid;
    spdata.Evec *= unit_electric_server / unit_electric_fluid;
    spdata.p_ther *= unit_pressure_server / unit_pressure_fluid;
+   return true;
 };
 
 /*!
@@ -1052,7 +1058,14 @@ void ServerCartesianBack::HandleNeedBlockRequests(void)
       if(buf_needblock[cpu].type) {
          pos_cart = buf_needblock[cpu].pos / unit_length_server * unit_length_fluid;
          GetBlock(pos_cart.Data(), &buf_needblock[cpu].node);
-         if(buf_needblock[cpu].node == -1) throw ExServerError();
+
+// The position is outside of the domain. Only the block header with an invalid node is sent back, so that the worker can discard the trajectory.
+         if(buf_needblock[cpu].node == -1) {
+            block_served->SetNode(-1);
+            MPI_Send(block_served, 1, MPIBlockType, cpu, tag_sendblock, mpi_config->node_comm);
+            MPI_Irecv(&buf_needblock[cpu], 1, MPIInquiryType, cpu, tag_needblock, mpi_config->node_comm, &req_needblock[cpu]);
+            continue;
+         };
       };
 
       block_served->SetNode(buf_needblock[cpu].node);
@@ -150,14 +150,14 @@ public:
    void ServerFinish(void) override;
 
 #ifdef NEED_SERVER
-//! Obtain the variables
-   void GetVariables(double t, const GeoVector& pos, SpatialData& spdata) override;
+//! Obtain the variables, returning false if the position is outside of the domain
+   bool GetVariables(double t, const GeoVector& pos, SpatialData& spdata) override;
 
 //! Obtain the gradients
    void GetGradients(SpatialData& spdata) override;
 #else
-//! Obtain the variables
-   void GetVariables(double t, const GeoVector& pos, SpatialData& spdata);
+//! Obtain the variables, returning false if the position is outside of the domain
+   bool GetVariables(double t, const GeoVector& pos, SpatialData& spdata);
 
 //! Obtain the gradients
    void GetGradients(SpatialData& spdata);
@@ -19,6 +19,8 @@ This file is part of the SPECTRUM suite of scientific numerical simulation codes
 #include "server_cartesian.hh"
 #elif SERVER_TYPE == SERVER_BATL
 #include "server_batl.hh"
+#elif SERVER_TYPE == SERVER_GEODESIC
+#include "server_geodesic.hh"
 #else
 #error Unsupported Server type
 #endif
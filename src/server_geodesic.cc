@@ -0,0 +1,628 @@
+/*!
+\file server_geodesic.cc
+\brief Implements a class of a data server for a geodesic grid
+\author Swati Sharma
+
+This file is part of the SPECTRUM suite of scientific numerical simulation codes. SPECTRUM stands for Space Plasma and Energetic Charged particle TRansport on Unstructured Meshes. The code simulates plasma or neutral particle flows using MHD equations on a grid, transport of cosmic rays using stochastic or grid based methods. The "unstructured" part refers to the use of a geodesic mesh providing a uniform coverage of the surface of a sphere.
+*/
+
+#include "server_geodesic.hh"
+#include "block_geodesic.hh"
+#include <iostream>
+#include <iomanip>
+#include <utility>
+
+namespace Spectrum {
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// ServerGeodesic methods
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] block Block to send
+\param[in] cpu   Rank of the receiving worker
+*/
+void ServerGeodesic::SendBlock(BlockBase* block, int cpu)
+{
+   BlockGeodesic* block_geo = static_cast<BlockGeodesic*>(block);
+
+// Send the block in parts. We use blocking Sends to ensure that the buffers can be reused.
+   MPI_Send(block_geo->GetNodeAddress(), 1, MPI_INT, cpu, tag_sendblock, mpi_config->node_comm);
+
+// An invalid node means that the position was not found, and the rest of the block is not sent
+   if(block_geo->GetNode() == -1) return;
+   MPI_Send(block_geo->GetCornersAddress(), 3 * block_dims[0], MPI_DOUBLE, cpu, tag_sendblock, mpi_config->node_comm);
+   MPI_Send(block_geo->GetFaceCentAddress(), 3 * block_dims[1], MPI_DOUBLE, cpu, tag_sendblock, mpi_config->node_comm);
+   MPI_Send(block_geo->GetFFAddress(), block_dims[0] * block_dims[1], MPI_INT, cpu, tag_sendblock, mpi_config->node_comm);
+   MPI_Send(block_geo->GetInteriorAddress(), block_dims[1], MPI_INT, cpu, tag_sendblock, mpi_config->node_comm);
+   MPI_Send(block_geo->GetRadiiAddress(), block_dims[2] + 1, MPI_DOUBLE, cpu, tag_sendblock, mpi_config->node_comm);
+#if SERVER_INTERP_ORDER > -1
+   MPI_Send(block_geo->GetVariablesAddress(), block_geo->GetVariableCount() * block_geo->GetZoneCount(), MPI_DOUBLE, cpu,
+            tag_sendblock, mpi_config->node_comm);
+#endif
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[out] block Block to receive
+*/
+void ServerGeodesic::RecvBlock(BlockBase* block)
+{
+   BlockGeodesic* block_geo = static_cast<BlockGeodesic*>(block);
+
+   MPI_Recv(block_geo->GetNodeAddress(), 1, MPI_INT, 0, tag_sendblock, mpi_config->node_comm, MPI_STATUS_IGNORE);
+   if(block_geo->GetNode() == -1) return;
+   MPI_Recv(block_geo->GetCornersAddress(), 3 * block_dims[0], MPI_DOUBLE, 0, tag_sendblock, mpi_config->node_comm, MPI_STATUS_IGNORE);
+   MPI_Recv(block_geo->GetFaceCentAddress(), 3 * block_dims[1], MPI_DOUBLE, 0, tag_sendblock, mpi_config->node_comm, MPI_STATUS_IGNORE);
+   MPI_Recv(block_geo->GetFFAddress(), block_dims[0] * block_dims[1], MPI_INT, 0, tag_sendblock, mpi_config->node_comm, MPI_STATUS_IGNORE);
+   MPI_Recv(block_geo->GetInteriorAddress(), block_dims[1], MPI_INT, 0, tag_sendblock, mpi_config->node_comm, MPI_STATUS_IGNORE);
+   MPI_Recv(block_geo->GetRadiiAddress(), block_dims[2] + 1, MPI_DOUBLE, 0, tag_sendblock, mpi_config->node_comm, MPI_STATUS_IGNORE);
+#if SERVER_INTERP_ORDER > -1
+   MPI_Recv(block_geo->GetVariablesAddress(), block_geo->GetVariableCount() * block_geo->GetZoneCount(), MPI_DOUBLE, 0,
+            tag_sendblock, mpi_config->node_comm, MPI_STATUS_IGNORE);
+#endif
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// ServerGeodesicFront methods
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+void ServerGeodesicFront::ServerStart(void)
+{
+// No need to call the ServerBaseFront version because it merely calls the ServerBase version
+   ServerBase::ServerStart();
+
+   cache_line.Empty();
+   stencil_outcomes[0] = stencil_outcomes[1] = stencil_outcomes[2] = 0;
+   num_blocks_requested = 0;
+
+   MPI_Bcast(block_dims, n_dims_geodesic, MPI_INT, 0, mpi_config->node_comm);
+   MPI_Bcast(domain_min.Data(), 3, MPI_DOUBLE, 0, mpi_config->node_comm);
+   MPI_Bcast(domain_max.Data(), 3, MPI_DOUBLE, 0, mpi_config->node_comm);
+   n_variables = block_dims[4];
+   grads_pri = new double[3 * n_variables];
+
+// Prime "block_pri" and "block_sec" with stub blocks. A newly constructed block has an empty radial range, so the position tests always fail.
+   MakeSharedBlock(block_pri);
+   MakeSharedBlock(block_sec);
+   zone_pri = MultiIndex(-1, -1, 0);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+void ServerGeodesicFront::ServerFinish(void)
+{
+   delete[] grads_pri;
+   grads_pri = nullptr;
+   ServerBaseFront::ServerFinish();
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[out] block_new pointer to block type
+*/
+void ServerGeodesicFront::MakeSharedBlock(BlockPtrType &block_new)
+{
+   block_new = std::make_shared<BlockGeodesic>(block_dims);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] pos Interpolation point position
+\return Always 0
+*/
+int ServerGeodesicFront::BuildInterpolationStencil(const GeoVector& pos)
+{
+   return 0;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return Index of the block in "cache_line", or -1 if the server could not find the position
+*/
+int ServerGeodesicFront::RequestBlock(void)
+{
+   int bidx;
+   BlockPtrType block_new;
+
+// Test whether the block is cached. Either call will renew the block if it is present.
+   if(_inquiry.type) {
+      if(block_pri->PositionInside(_inquiry.pos)) bidx = block_pri->GetNode();
+      else if(block_sec->PositionInside(_inquiry.pos)) bidx = block_sec->GetNode();
+      else bidx = cache_line.PosOwner(_inquiry.pos);
+   }
+   else {
+      if(block_pri->GetNode() == _inquiry.node) bidx = block_pri->GetNode();
+      else if(block_sec->GetNode() == _inquiry.node) bidx = block_sec->GetNode();
+      else bidx = cache_line.Present(_inquiry.node);
+   };
+
+// Block is not in the cache, request it from the server. The geometry is always needed to locate positions.
+   if(bidx == -1) {
+      MPI_Send(&_inquiry, 1, MPIInquiryType, 0, tag_needblock, mpi_config->node_comm);
+      num_blocks_requested++;
+
+      MakeSharedBlock(block_new);
+      RecvBlock(block_new.get());
+      if(block_new->GetNode() == -1) return -1;
+
+// Insert the block into the cache
+      static_cast<BlockGeodesic*>(block_new.get())->ConfigureGeometry();
+      cache_line.AddBlock(block_new);
+      bidx = block_new->GetNode();
+   };
+
+   return bidx;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] pos Position inside "block_pri"
+*/
+void ServerGeodesicFront::LocateZone(const GeoVector& pos)
+{
+   const BlockGeodesic* block_geo = static_cast<const BlockGeodesic*>(block_pri.get());
+
+// Successive positions are usually close together, so the previous face is a good starting point for the walk
+   zone_pri.i = block_geo->FindFace(pos, zone_pri.i);
+   zone_pri.j = block_geo->FindShell(pos.Norm());
+   offset_pri = block_geo->ZoneOffset(zone_pri, pos);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in]  vars   Variables in server format
+\param[out] spdata Fields, dmax, etc.
+*/
+void ServerGeodesicFront::StoreVariables(const double* vars, SpatialData& spdata)
+{
+   int xyz;
+   double rho;
+
+// Mass density, if provided
+#ifdef SERVER_VAR_INDEX_RHO
+   rho = vars[SERVER_VAR_INDEX_RHO];
+#endif
+
+// Number density, if provided
+#ifdef SERVER_VAR_INDEX_DEN
+   spdata.n_dens = vars[SERVER_VAR_INDEX_DEN];
+#endif
+
+// Thermal pressure, if provided
+#ifdef SERVER_VAR_INDEX_PTH
+   spdata.p_ther = vars[SERVER_VAR_INDEX_PTH];
+#endif
+
+// Convert the variables to SPECTRUM format
+   for(xyz = 0; xyz < 3; xyz++) {
+
+// Bulk flow from mass density and momentum, if provided
+#if defined(SERVER_VAR_INDEX_MOM) && defined(SERVER_VAR_INDEX_RHO)
+      spdata.Uvec[xyz] = vars[SERVER_VAR_INDEX_MOM + xyz] / rho;
+// Bulk flow, if provided
+#elif defined(SERVER_VAR_INDEX_FLO)
+      spdata.Uvec[xyz] = vars[SERVER_VAR_INDEX_FLO + xyz];
+#else
+      spdata.Uvec[xyz] = 0.0;
+#endif
+
+// The magnetic field must be always provided
+      spdata.Bvec[xyz] = vars[SERVER_VAR_INDEX_MAG + xyz];
+
+// Electric field, if provided
+#if defined(SERVER_VAR_INDEX_ELE)
+      spdata.Evec[xyz] = vars[SERVER_VAR_INDEX_ELE + xyz];
+#elif !defined(SERVER_VAR_INDEX_FLO) && !(defined(SERVER_VAR_INDEX_MOM) && defined(SERVER_VAR_INDEX_RHO))
+      spdata.Evec[xyz] = 0.0;
+#endif
+
+   };
+
+// Electric field, if B and U provided
+#ifndef SERVER_VAR_INDEX_ELE
+#if defined(SERVER_VAR_INDEX_FLO) || (defined(SERVER_VAR_INDEX_MOM) && defined(SERVER_VAR_INDEX_RHO))
+   spdata.Evec = -(spdata.Uvec ^ spdata.Bvec) / c_code;
+#endif
+#endif
+
+// Region(s) indicator variable(s), if provided
+#ifdef SERVER_VAR_INDEX_REG
+   for(xyz = 0; xyz < SERVER_NUM_INDEX_REG; xyz++) spdata.region[xyz] = vars[SERVER_VAR_INDEX_REG + xyz];
+#else
+   spdata.region = gv_zeros;
+#endif
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[out] spdata Fields, dmax, etc.
+*/
+void ServerGeodesicFront::GetVariablesFromReader(SpatialData& spdata)
+{
+   double vars[n_variables] = {0.0};
+
+   MPI_Send(&_inquiry, 1, MPIInquiryType, 0, tag_needvars, mpi_config->node_comm);
+   MPI_Recv(vars, n_variables, MPI_DOUBLE, 0, tag_sendvars, mpi_config->node_comm, MPI_STATUS_IGNORE);
+   stencil_outcomes[2]++;
+
+   StoreVariables(vars, spdata);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in]  pos    Position
+\param[out] spdata Fields, dmax, etc.
+*/
+void ServerGeodesicFront::GetVariablesInterp0(const GeoVector& pos, SpatialData& spdata)
+{
+   double vars[n_variables];
+
+// Take the nearest zone value
+   for(auto vidx = 0; vidx < n_variables; vidx++) vars[vidx] = block_pri->GetValue(zone_pri, vidx);
+   stencil_outcomes[0]++;
+
+   StoreVariables(vars, spdata);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in]  pos    Position
+\param[out] spdata Fields, dmax, etc.
+
+\note The reconstruction is linear about the center of the nearest zone with the least squares gradients. Ghost zones have the same stencils as interior zones, so positions near the block boundary do not need a second block.
+*/
+void ServerGeodesicFront::GetVariablesInterp1(const GeoVector& pos, SpatialData& spdata)
+{
+   int vidx;
+   double vars[n_variables];
+   GeoVector Bvec;
+   const BlockGeodesic* block_geo = static_cast<const BlockGeodesic*>(block_pri.get());
+
+   block_geo->LeastSquaresGradients(zone_pri, grads_pri, gradBmag_pri);
+   if(zone_pri.j < block_dims[3] || zone_pri.j >= block_dims[2] - block_dims[3]) stencil_outcomes[1]++;
+   else stencil_outcomes[0]++;
+
+   for(vidx = 0; vidx < n_variables; vidx++) {
+      vars[vidx] = block_pri->GetValue(zone_pri, vidx) + GeoVector(grads_pri + 3 * vidx) * offset_pri;
+   };
+
+// B magnitude is reconstructed separately because it is not a linear function of the components
+   for(auto xyz = 0; xyz < 3; xyz++) Bvec[xyz] = block_pri->GetValue(zone_pri, SERVER_VAR_INDEX_MAG + xyz);
+   spdata.Bmag = Bvec.Norm() + gradBmag_pri * offset_pri;
+
+   StoreVariables(vars, spdata);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in]  t      Time
+\param[in]  pos    Position
+\param[out] spdata Fields, dmax, etc.
+\return False if the position is outside of the domain
+*/
+bool ServerGeodesicFront::GetVariables(double t, const GeoVector& pos, SpatialData& spdata)
+{
+   int bidx;
+
+// Request the block
+   _inquiry.type = 1;
+   _inquiry.pos = pos;
+   bidx = RequestBlock();
+   if(bidx == -1) return false;
+
+// Keep the previous primary block as the secondary one, since a particle near a sector boundary tends to alternate between two blocks
+   if(block_pri->GetNode() != bidx) {
+      if(block_sec->GetNode() == bidx) std::swap(block_pri, block_sec);
+      else {
+         block_sec = block_pri;
+         block_pri = cache_line[bidx];
+      };
+      zone_pri.i = -1;
+   };
+
+   LocateZone(pos);
+   spdata.dmax = fmin(spdata.dmax, static_cast<const BlockGeodesic*>(block_pri.get())->ZoneSize(zone_pri));
+
+#if SERVER_INTERP_ORDER == -1
+// Get variables directly from reader program
+   GetVariablesFromReader(spdata);
+#elif SERVER_INTERP_ORDER == 0
+// Get variables using 0th order interpolation
+   GetVariablesInterp0(pos, spdata);
+#elif SERVER_INTERP_ORDER == 1
+// Get variables using the least squares reconstruction
+   GetVariablesInterp1(pos, spdata);
+#else
+#error Unsupported interpolation order!
+#endif
+
+// Perform unit conversion for fields and region
+#ifdef SERVER_VAR_INDEX_DEN
+   spdata.region /= spdata.n_dens;
+#endif
+   spdata.n_dens *= unit_number_density_server / unit_number_density_fluid;
+   spdata.Uvec *= unit_velocity_server / unit_velocity_fluid;
+   spdata.Bvec *= unit_magnetic_server / unit_magnetic_fluid;
+   spdata.Evec *= unit_electric_server / unit_electric_fluid;
+   spdata.p_ther *= unit_pressure_server / unit_pressure_fluid;
+   return true;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[out] spdata Fields, dmax, etc.
+
+\note The gradients were computed in "GetVariablesInterp1()" for the same zone
+*/
+void ServerGeodesicFront::GetGradientsInterp1(SpatialData& spdata)
+{
+   int uvw, xyz;
+
+   LOWER_BITS(spdata._mask, BACKGROUND_grad_FAIL);
+   spdata.gradBmag = gradBmag_pri;
+
+// Convert the gradients to SPECTRUM format
+   for(uvw = 0; uvw < 3; uvw++) {
+      for(xyz = 0; xyz < 3; xyz++) {
+
+// Bulk flow from mass density and momentum, if provided
+#if defined(SERVER_VAR_INDEX_MOM) && defined(SERVER_VAR_INDEX_RHO)
+         spdata.gradUvec[uvw][xyz] = (grads_pri[3 * (SERVER_VAR_INDEX_MOM + xyz) + uvw] - spdata.Uvec[xyz] * grads_pri[3 * SERVER_VAR_INDEX_RHO + uvw])
+                                   / block_pri->GetValue(zone_pri, SERVER_VAR_INDEX_RHO);
+// Bulk flow, if provided
+#elif defined(SERVER_VAR_INDEX_FLO)
+         spdata.gradUvec[uvw][xyz] = grads_pri[3 * (SERVER_VAR_INDEX_FLO + xyz) + uvw];
+#else
+         spdata.gradUvec[uvw][xyz] = 0.0;
+#endif
+
+// The magnetic field must be always provided
+         spdata.gradBvec[uvw][xyz] = grads_pri[3 * (SERVER_VAR_INDEX_MAG + xyz) + uvw];
+
+// Electric field, if provided
+#ifdef SERVER_VAR_INDEX_ELE
+         spdata.gradEvec[uvw][xyz] = grads_pri[3 * (SERVER_VAR_INDEX_ELE + xyz) + uvw];
+#elif !defined(SERVER_VAR_INDEX_FLO) && !(defined(SERVER_VAR_INDEX_MOM) && defined(SERVER_VAR_INDEX_RHO))
+         spdata.gradEvec[uvw][xyz] = 0.0;
+#endif
+
+      };
+   };
+
+// Electric field, if B and U provided
+#ifndef SERVER_VAR_INDEX_ELE
+#if defined(SERVER_VAR_INDEX_FLO) || (defined(SERVER_VAR_INDEX_MOM) && defined(SERVER_VAR_INDEX_RHO))
+   spdata.gradEvec = -((spdata.gradUvec ^ spdata.Bvec) + (spdata.Uvec ^ spdata.gradBvec)) / c_code;
+#endif
+#endif
+
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[out] spdata Field gradients
+*/
+void ServerGeodesicFront::GetGradients(SpatialData& spdata)
+{
+#if SERVER_INTERP_ORDER == -1
+// Gradients must be computed numerically
+   RAISE_BITS(spdata._mask, BACKGROUND_grad_FAIL);
+   return;
+#elif SERVER_INTERP_ORDER == 0
+// All gradients are explicitly set to zero, and the background must not attempt to compute them using "NumericalDerivatives()"
+   spdata.gradUvec = gm_zeros;
+   spdata.gradBvec = gm_zeros;
+   spdata.gradBmag = gv_zeros;
+   spdata.gradEvec = gm_zeros;
+#elif SERVER_INTERP_ORDER == 1
+// Gradients are available from the least squares reconstruction
+   GetGradientsInterp1(spdata);
+#else
+#error Unsupported interpolation order!
+#endif
+
+// Perform unit conversion for gradients
+   spdata.gradUvec *= unit_velocity_server / unit_velocity_fluid;
+   spdata.gradBvec *= unit_magnetic_server / unit_magnetic_fluid;
+   spdata.gradEvec *= unit_electric_server / unit_electric_fluid;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+void ServerGeodesicFront::PrintStencilOutcomes(void)
+{
+   std::cerr << "Stencil outcomes: " << std::setw(10) << stencil_outcomes[0]
+                                     << std::setw(10) << stencil_outcomes[1]
+                                     << std::setw(10) << stencil_outcomes[2] << std::endl;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+void ServerGeodesicFront::PrintNumBlocksRequested(void)
+{
+   std::cerr << "Number of blocks requested: " << std::setw(10) << num_blocks_requested << std::endl;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// ServerGeodesicBack methods
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] file_name_pattern_in A string describing the file naming pattern
+*/
+ServerGeodesicBack::ServerGeodesicBack(const std::string& file_name_pattern_in)
+                  : ServerBaseBack(file_name_pattern_in)
+{
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+void ServerGeodesicBack::ServerStart(void)
+{
+   ServerBaseBack::ServerStart();
+
+// Read the data into memory
+   std::string data_file = file_name_pattern + ".geo";
+   ReadGeodesicData(data_file.c_str(), 1);
+   ReadGeodesicGetDimensions(block_dims);
+   ReadGeodesicGetDomain(domain_min.Data(), domain_max.Data());
+   n_variables = block_dims[4];
+   domain_min *= unit_length_server / unit_length_fluid;
+   domain_max *= unit_length_server / unit_length_fluid;
+
+   block_served = new BlockGeodesic(block_dims);
+
+   MPI_Bcast(block_dims, n_dims_geodesic, MPI_INT, 0, mpi_config->node_comm);
+   MPI_Bcast(domain_min.Data(), 3, MPI_DOUBLE, 0, mpi_config->node_comm);
+   MPI_Bcast(domain_max.Data(), 3, MPI_DOUBLE, 0, mpi_config->node_comm);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+void ServerGeodesicBack::ServerFinish(void)
+{
+   ReadGeodesicClean();
+   delete block_served;
+   ServerBaseBack::ServerFinish();
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return Number of clients that completed their tasks during this cycle
+*/
+int ServerGeodesicBack::ServerFunctions(void)
+{
+#if SERVER_INTERP_ORDER == -1
+// Handle "needvars" requests
+   HandleNeedVarsRequests();
+#endif
+// Handle "needblock" requests
+   HandleNeedBlockRequests();
+// Handle "stopserve" requests
+   return HandleStopServeRequests();
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+void ServerGeodesicBack::HandleNeedVarsRequests(void)
+{
+   GeoVector pos_geo;
+   double vars[n_variables];
+   int found, cpu, cpu_idx, count_needvars = 0;
+
+// Service the "needvars" requests
+   MPI_Testsome(mpi_config->node_comm_size, req_needvars, &count_needvars, index_needvars, MPI_STATUSES_IGNORE);
+
+   for(cpu_idx = 0; cpu_idx < count_needvars; cpu_idx++) {
+      cpu = index_needvars[cpu_idx];
+
+// Obtain the variables requested
+      pos_geo = buf_needvars[cpu].pos / unit_length_server * unit_length_fluid;
+      ReadGeodesicGetBlockData(pos_geo.Data(), vars, &found);
+      if(!found) std::cerr << "Position not found\n";
+
+// Send the variables to a worker. We use a blocking Send to ensure that the buffer can be reused.
+      MPI_Send(vars, n_variables, MPI_DOUBLE, cpu, tag_sendvars, mpi_config->node_comm);
+
+// Post the receive for the next variables request from this worker.
+      MPI_Irecv(&buf_needvars[cpu], 1, MPIInquiryType, cpu, tag_needvars, mpi_config->node_comm, &req_needvars[cpu]);
+   };
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+void ServerGeodesicBack::HandleNeedBlockRequests(void)
+{
+   GeoVector pos_geo;
+   int cpu, cpu_idx, count_needblock = 0;
+
+// Service the "needblock" requests
+   MPI_Testsome(mpi_config->node_comm_size, req_needblock, &count_needblock, index_needblock, MPI_STATUSES_IGNORE);
+
+// Load the block requested. If the requestor does not know the node, figure it out.
+   for(cpu_idx = 0; cpu_idx < count_needblock; cpu_idx++) {
+      cpu = index_needblock[cpu_idx];
+
+      if(buf_needblock[cpu].type) {
+         pos_geo = buf_needblock[cpu].pos / unit_length_server * unit_length_fluid;
+         ReadGeodesicGetNode(pos_geo.Data(), &buf_needblock[cpu].node);
+      };
+
+// If the position is outside of the domain, only the invalid node is sent back, so that the worker can discard the trajectory
+      block_served->SetNode(buf_needblock[cpu].node);
+      if(buf_needblock[cpu].node != -1) {
+         block_served->LoadDimensions(unit_length_server);
+#if SERVER_INTERP_ORDER > -1
+         block_served->LoadVariables();
+#endif
+      };
+      SendBlock(block_served, cpu);
+
+// Post the receive for the next block request from this worker
+      MPI_Irecv(&buf_needblock[cpu], 1, MPIInquiryType, cpu, tag_needblock, mpi_config->node_comm, &req_needblock[cpu]);
+   };
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return Number of clients that completed their tasks during this cycle
+*/
+int ServerGeodesicBack::HandleStopServeRequests(void)
+{
+   int cpu, cpu_idx, count_stopserve = 0;
+
+// Service the "stopserve" requests. We assume that each worker sends a single request at the end of the simulation.
+   MPI_Testsome(mpi_config->node_comm_size, req_stopserve, &count_stopserve, index_stopserve, MPI_STATUSES_IGNORE);
+
+// Cancel all outstanding receive requests from the cpus that have finished.
+   for(cpu_idx = 0; cpu_idx < count_stopserve; cpu_idx++) {
+      cpu = index_stopserve[cpu_idx];
+      MPI_Cancel(&req_needblock[cpu]);
+      MPI_Cancel(&req_needstencil[cpu]);
+      MPI_Cancel(&req_needvars[cpu]);
+      MPI_Request_free(&req_needblock[cpu]);
+      MPI_Request_free(&req_needstencil[cpu]);
+      MPI_Request_free(&req_needvars[cpu]);
+   };
+
+   return count_stopserve;
+};
+
+};
@@ -0,0 +1,204 @@
+/*!
+\file server_geodesic.hh
+\brief Defines a class of a data server for a geodesic grid
+\author Swati Sharma
+
+This file is part of the SPECTRUM suite of scientific numerical simulation codes. SPECTRUM stands for Space Plasma and Energetic Charged particle TRansport on Unstructured Meshes. The code simulates plasma or neutral particle flows using MHD equations on a grid, transport of cosmic rays using stochastic or grid based methods. The "unstructured" part refers to the use of a geodesic mesh providing a uniform coverage of the surface of a sphere.
+*/
+
+#ifndef SPECTRUM_SERVER_GEODESIC_HH
+#define SPECTRUM_SERVER_GEODESIC_HH
+
+#include "server_base.hh"
+#include "reader_geodesic.hh"
+
+namespace Spectrum {
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// ServerGeodesic class declaration
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\brief Common functions of the geodesic server frontend and backend
+\author Swati Sharma
+
+The blocks have a variable size that is only known after the data file is read, so instead of a derived MPI data type the block is transmitted as a sequence of arrays: node, geometry, and variables. The dimensions are broadcast once by the backend at startup.
+*/
+class ServerGeodesic : virtual public ServerBase {
+
+protected:
+
+//! Block dimensions (vertices per face, faces, shells, ghost shells, variables)
+   int block_dims[n_dims_geodesic];
+
+//! Default constructor
+   ServerGeodesic(void) = default;
+
+//! Send a block to a worker
+   void SendBlock(BlockBase* block, int cpu);
+
+//! Receive a block from the backend
+   void RecvBlock(BlockBase* block);
+
+public:
+
+//! Destructor
+   virtual ~ServerGeodesic() = default;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// ServerGeodesicFront class declaration
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\brief Geodesic server frontend
+\author Swati Sharma
+*/
+class ServerGeodesicFront : virtual public ServerGeodesic, virtual public ServerBaseFront {
+
+protected:
+
+//! Counts of different stencil outcomes (reconstruction in interior zones, ghost zones, values from the reader)
+   int stencil_outcomes[3];
+
+//! Count of total blocks requested
+   int num_blocks_requested;
+
+//! Primary block pointer
+   BlockPtrType block_pri;
+
+//! Secondary block pointer
+   BlockPtrType block_sec;
+
+//! Zone of the most recent position, used as the starting point of the next search
+   MultiIndex zone_pri;
+
+//! Displacement of the most recent position from the center of "zone_pri"
+   GeoVector offset_pri;
+
+//! Least squares gradients of the variables in "zone_pri", [var][xyz]
+   double* grads_pri = nullptr;
+
+//! Least squares gradient of |B| in "zone_pri"
+   GeoVector gradBmag_pri;
+
+//! Make shared block
+   void MakeSharedBlock(BlockPtrType &block_new);
+
+//! Find the zone and the offset in the primary block
+   void LocateZone(const GeoVector& pos);
+
+//! Convert an array of variables to SPECTRUM format
+   void StoreVariables(const double* vars, SpatialData& spdata);
+
+#ifdef NEED_SERVER
+//! Not used because all stencils are local to the block
+   int BuildInterpolationStencil(const GeoVector& pos) override;
+
+//! Find block order in the cache or get a block from the server if not in the cache
+   int RequestBlock(void) override;
+#else
+//! Not used because all stencils are local to the block
+   int BuildInterpolationStencil(const GeoVector& pos);
+
+//! Find block order in the cache or get a block from the server if not in the cache
+   int RequestBlock(void);
+#endif
+
+//! Get variables directly from data reader
+   void GetVariablesFromReader(SpatialData& spdata);
+
+//! Get variables using 0th order interpolation
+   void GetVariablesInterp0(const GeoVector& pos, SpatialData& spdata);
+
+//! Get variables using the least squares linear reconstruction
+   void GetVariablesInterp1(const GeoVector& pos, SpatialData& spdata);
+
+//! Get gradients from the least squares linear reconstruction
+   void GetGradientsInterp1(SpatialData& spdata);
+
+public:
+
+//! Default constructor
+   ServerGeodesicFront(void) = default;
+
+//! Destructor
+   ~ServerGeodesicFront() override = default;
+
+//! Front end set up prior to main loop
+   void ServerStart(void) override;
+
+//! Front end clean up tasks after the main loop
+   void ServerFinish(void) override;
+
+#ifdef NEED_SERVER
+//! Obtain the variables, returning false if the position is outside of the domain
+   bool GetVariables(double t, const GeoVector& pos, SpatialData& spdata) override;
+
+//! Obtain the gradients
+   void GetGradients(SpatialData& spdata) override;
+#else
+//! Obtain the variables, returning false if the position is outside of the domain
+   bool GetVariables(double t, const GeoVector& pos, SpatialData& spdata);
+
+//! Obtain the gradients
+   void GetGradients(SpatialData& spdata);
+#endif
+
+//! Print how many times each reconstruction type was used
+   void PrintStencilOutcomes(void);
+
+//! Print how many blocks were requested
+   void PrintNumBlocksRequested(void);
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// ServerGeodesicBack class declaration
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\brief Geodesic server backend
+\author Swati Sharma
+*/
+class ServerGeodesicBack : virtual public ServerGeodesic, virtual public ServerBaseBack {
+
+public:
+
+//! Default constructor
+   ServerGeodesicBack(void) = default;
+
+//! Constructor with arguments
+   ServerGeodesicBack(const std::string& file_name_pattern_in);
+
+//! Destructor
+   ~ServerGeodesicBack() override = default;
+
+//! Back end set up prior to main loop
+   void ServerStart(void) override;
+
+//! Back end clean up tasks after the main loop
+   void ServerFinish(void) override;
+
+//! Backend tasks during the main loop
+   int ServerFunctions(void) override;
+
+//! Handle "needvars" requests
+   void HandleNeedVarsRequests(void);
+
+//! Handle "needblock" requests
+   void HandleNeedBlockRequests(void);
+
+//! Handle "stopserve" requests
+   int HandleStopServeRequests(void);
+};
+
+//! Server types
+#if SERVER_TYPE == SERVER_GEODESIC
+typedef ServerGeodesic ServerType;
+typedef ServerGeodesicFront ServerFrontType;
+typedef ServerGeodesicBack ServerBackType;
+#endif
+
+};
+
+#endif
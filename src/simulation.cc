@@ -49,6 +49,9 @@ SimulationWorker::SimulationWorker(std::shared_ptr<MPI_Config> mpi_config_in)
 // Create a unique trajectory object based on the user preference stored in "traj_config.hh".
    trajectory = std::make_unique<TrajectoryType>();
    trajectory->ConnectRNG(rng);
+
+// The full record is only needed if trajectories are printed or dumped
+   trajectory->SetRecording(print_last_trajectory || dump_trajectories ? TRAJ_RECORD_ALL : TRAJ_RECORD_NONE);
 };
 
 /*!
@@ -167,6 +170,17 @@ void SimulationWorker::AddBackground(const BackgroundBase& background_in, const
 #endif
 
    trajectory->AddBackground(background_in, container_mpi);
+
+// Replace any random persistent state with the master's copy. The size of the state only depends on the parameters, so it is the same on all processes.
+   if(broadcast_background_setup) {
+      std::vector<double> state;
+      trajectory->PackBackgroundState(state);
+      if(state.size()) {
+         MPI_Bcast(state.data(), state.size(), MPI_DOUBLE, 0, mpi_config->glob_comm);
+         if(!mpi_config->is_master) trajectory->UnpackBackgroundState(state);
+      };
+   };
+
    PrintMessage(__FILE__, __LINE__, "Background object added", mpi_config->is_master);
 };
 
@@ -241,6 +255,10 @@ void SimulationWorker::SendDataToMaster(void)
    MPI_Send(&shortest_sim_time, 1, MPI_DOUBLE, 0, tag_distrdata, mpi_config->work_comm);
    MPI_Send(&longest_sim_time , 1, MPI_DOUBLE, 0, tag_distrdata, mpi_config->work_comm);
    MPI_Send(&elapsed_time     , 1, MPI_DOUBLE, 0, tag_distrdata, mpi_config->work_comm);
+
+// Send discard statistics to master and reset
+   MPI_Send(discard_counts, TRAJ_DISCARD_REASONS, MPI_INT, 0, tag_distrdata, mpi_config->work_comm);
+   std::fill_n(discard_counts, TRAJ_DISCARD_REASONS, 0);
 };
 
 /*!
@@ -259,6 +277,15 @@ void SimulationWorker::WorkerStart(void)
 #endif
    longest_sim_time = 0.0;
    elapsed_time = 0.0;
+   std::fill_n(discard_counts, TRAJ_DISCARD_REASONS, 0);
+
+// Open the trajectory store
+   if(dump_trajectories && !traj_store) {
+      std::string rank_str = std::to_string(mpi_config->work_comm_rank);
+      std::string size_str = std::to_string(mpi_config->work_comm_size);
+      rank_str.insert(0, size_str.size() - rank_str.size(), '0');
+      traj_store = std::make_unique<TrajectoryStore>("trajectories_rank_" + rank_str + ".trj", dump_trajectories_output, true, false);
+   };
 
 // Signal the master (with an empty message) that this CPU is available and receive confirmation to do more work.
    if(is_parallel) {
@@ -285,6 +312,9 @@ void SimulationWorker::WorkerFinish(void)
       trajectory->InterpretStatus();
    };
 
+// Write the index of the trajectory store
+   if(traj_store) traj_store->Close();
+
 #ifdef NEED_SERVER
    trajectory->StopBackground();
 #endif
@@ -310,7 +340,19 @@ void SimulationWorker::WorkerDuties(void)
       try {
          trajectory->SetStart();
          trajectory->Integrate();
+
+// A discarded trajectory is counted by reason and replaced with a new one
+         if(BITS_RAISED(trajectory->GetStatus(), TRAJ_DISCARD)) {
+            discard_counts[trajectory->DiscardReason()]++;
+#ifdef GEO_DEBUG
+            std::cerr << "Trajectory discarded by worker with rank " << mpi_config->work_comm_rank
+                      << ": " << traj_discard_names[trajectory->DiscardReason()] << std::endl;
+#endif
+            continue;
+         };
+
          traj_elapsed_time = trajectory->ElapsedTime();
+         if(traj_store) trajectory->WriteTrajectory(*traj_store, traj_dumped++, (dump_trajectories_dt > 0.0 ? 0 : 1), dump_trajectories_dt);
 #if TRAJ_TIME_FLOW == TRAJ_TIME_FLOW_FORWARD
          if(shortest_sim_time > traj_elapsed_time) shortest_sim_time = traj_elapsed_time;
          if(longest_sim_time < traj_elapsed_time) longest_sim_time = traj_elapsed_time;
@@ -321,6 +363,7 @@ void SimulationWorker::WorkerDuties(void)
          traj_count++;
       }
       catch(std::exception& exception) {
+         discard_counts[trajectory->DiscardReason() == TRAJ_DISCARD_NONE ? TRAJ_DISCARD_OTHER : trajectory->DiscardReason()]++;
          std::cerr << "Trajectory discarded by worker with rank " << mpi_config->work_comm_rank
                    << ": " << exception.what() << std::endl;
       }
@@ -376,6 +419,17 @@ void SimulationWorker::PrintDistro1D(int distro, int ijk, const std::string& fil
 {
 };
 
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] distro which distribution to export
+\param[in] file_name filename
+\param[in] phys_units whether to export in physical units or not
+*/
+void SimulationWorker::ExportDistro(int distro, const std::string& file_name, bool phys_units) const
+{
+};
+
 /*!
 \author Juan G Alonso Guzman
 \author Vladimir Florinski
@@ -634,6 +688,7 @@ void SimulationMaster::DecrementTrajectoryCount(void)
 // Save the partial distributions
       for(distro = 0; distro < local_distros.size(); distro++) {
          local_distros[distro]->Dump(distro_file_name + std::to_string(distro) + ".out");
+         if(dump_marginals) local_distros[distro]->DumpMarginals(distro_file_name + std::to_string(distro) + "_marginals.out");
       };
 
 // Estimate the remaining silumation time
@@ -664,7 +719,8 @@ void SimulationMaster::DecrementTrajectoryCount(void)
 */
 void SimulationMaster::RecvDataFromWorker(int cpu)
 {
-   int n_events_partial, n_records_partial;
+   int n_events_partial, n_records_partial, reason;
+   int discard_counts_cpu[TRAJ_DISCARD_REASONS];
    double shortest_sim_time_cpu, longest_sim_time_cpu;
    size_t distro_size, w_records_size;
    void * distro_addr, * w_records_addr;
@@ -705,6 +761,10 @@ void SimulationMaster::RecvDataFromWorker(int cpu)
 #endif
    MPI_Recv(&elapsed_time, 1, MPI_DOUBLE, cpu, tag_distrdata, mpi_config->work_comm, MPI_STATUS_IGNORE);
    time_spent_processing[cpu] += elapsed_time;
+
+// Receive discard statistics and add to the totals
+   MPI_Recv(discard_counts_cpu, TRAJ_DISCARD_REASONS, MPI_INT, cpu, tag_distrdata, mpi_config->work_comm, MPI_STATUS_IGNORE);
+   for(reason = 0; reason < TRAJ_DISCARD_REASONS; reason++) discard_counts[reason] += discard_counts_cpu[reason];
 };
 
 /*!
@@ -740,6 +800,7 @@ void SimulationMaster::MasterStart(void)
 #endif
    longest_sim_time = 0.0;
    elapsed_time = 0.0;
+   std::fill_n(discard_counts, TRAJ_DISCARD_REASONS, 0);
 
 // Post an initial receive for workers to respond with availability
    if(is_parallel) {
@@ -788,7 +849,7 @@ void SimulationMaster::MasterDuties(void)
 */
 void SimulationMaster::MasterFinish(void)
 {
-   int distro, cpu;
+   int distro, cpu, reason, discarded = 0;
    std::chrono::seconds sim_time_elapsed;
    std::chrono::system_clock::time_point sim_current_time;
    PrintMessage(__FILE__, __LINE__, "Simulation completed", mpi_config->is_master);
@@ -806,6 +867,7 @@ void SimulationMaster::MasterFinish(void)
 // Save the final distributions
    for(distro = 0; distro < local_distros.size(); distro++) {
       local_distros[distro]->Dump(distro_file_name + std::to_string(distro) + ".out");
+      if(dump_marginals) local_distros[distro]->DumpMarginals(distro_file_name + std::to_string(distro) + "_marginals.out");
    };
 
 // Print shortest and longest simulated time
@@ -821,6 +883,13 @@ void SimulationMaster::MasterFinish(void)
       std::cerr << "Time per trajectory integration = " << elapsed_time / n_trajectories_total << " ms" << std::endl;
    };
 
+// Print discard statistics by reason
+   for(reason = 0; reason < TRAJ_DISCARD_REASONS; reason++) discarded += discard_counts[reason];
+   std::cerr << "Discarded trajectories = " << discarded << std::endl;
+   for(reason = 1; reason < TRAJ_DISCARD_REASONS; reason++) {
+      if(discard_counts[reason]) std::cerr << "\t" << traj_discard_names[reason] << " = " << discard_counts[reason] << std::endl;
+   };
+
    sim_current_time = std::chrono::system_clock::now();
    sim_time_elapsed = std::chrono::duration_cast<std::chrono::seconds>(sim_current_time - sim_start_time);
    std::cerr << "Total time of this simulation: " << std::setw(20) << sim_time_elapsed.count() << " seconds." << std::endl;
@@ -874,6 +943,18 @@ void SimulationMaster::PrintDistro1D(int distro, int ijk, const std::string& fil
    local_distros[distro]->Print1D(ijk, file_name, phys_units);
 };
 
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] distro which distribution to export
+\param[in] file_name filename
+\param[in] phys_units whether to export in physical units or not
+*/
+void SimulationMaster::ExportDistro(int distro, const std::string& file_name, bool phys_units) const
+{
+   local_distros[distro]->Export(file_name, phys_units);
+};
+
 /*!
 \author Juan G Alonso Guzman
 \author Vladimir Florinski
@@ -22,6 +22,21 @@ namespace Spectrum {
 //! Whether to print the last trajectory
 const bool print_last_trajectory = false;
 
+//! Whether to write all trajectories to a binary store (one file per worker)
+const bool dump_trajectories = false;
+
+//! Which quantities to write to the trajectory store, see "TrajectoryBase::PrintTrajectory()"
+const unsigned int dump_trajectories_output = 0x01 | 0x02 | 0x04 | 0x08 | 0x80;
+
+//! Time interval between points in the trajectory store, or zero to store every recorded point
+const double dump_trajectories_dt = 0.0;
+
+//! Whether all processes should use the background realization generated by the master (otherwise each process draws its own)
+const bool broadcast_background_setup = true;
+
+//! Whether to also dump the 1D and 2D marginals of each distribution at checkpoints, see "DistributionBase::DumpMarginals()"
+const bool dump_marginals = false;
+
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 // SimulationWorker (base) class
 //----------------------------------------------------------------------------------------------------------------------------------------------------
@@ -53,6 +68,12 @@ protected:
 //! Trajectory object
    std::unique_ptr<TrajectoryBase> trajectory = nullptr;
 
+//! Binary store for trajectory dumps
+   std::unique_ptr<TrajectoryStore> traj_store = nullptr;
+
+//! Number of trajectories written to the store
+   int64_t traj_dumped = 0;
+
 //! Number of trajectories in this batch
    int current_batch_size;
 
@@ -68,6 +89,9 @@ protected:
 //! Elapsed time (both virtual and real)
    double elapsed_time;
 
+//! Number of discarded trajectories for each discard reason
+   int discard_counts[TRAJ_DISCARD_REASONS];
+
 //! Send data to master
    void SendDataToMaster(void);
 
@@ -134,6 +158,9 @@ public:
 //! Print the reduced distribution (stub)
    virtual void PrintDistro1D(int distro, int ijk, const std::string& file_name, bool phys_units) const;
 
+//! Export the distribution in the self-describing binary format (stub)
+   virtual void ExportDistro(int distro, const std::string& file_name, bool phys_units) const;
+
 //! Print the reduced distribution in 2D (stub)
    virtual void PrintDistro2D(int distro, int ijk1, int ijk2, const std::string& file_name, bool phys_units) const;
 
@@ -289,6 +316,9 @@ public:
 //! Print the reduced distribution
    void PrintDistro1D(int distro, int ijk, const std::string& file_name, bool phys_units) const override;
 
+//! Export the distribution in the self-describing binary format
+   void ExportDistro(int distro, const std::string& file_name, bool phys_units) const override;
+
 //! Print the reduced distribution in 2D
    void PrintDistro2D(int distro, int ijk1, int ijk2, const std::string& file_name, bool phys_units) const override;
 
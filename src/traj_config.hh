@@ -28,6 +28,10 @@ This file is part of the SPECTRUM suite of scientific numerical simulation codes
 #include "trajectory_focused.hh"
 #elif TRAJ_TYPE == TRAJ_PARKER
 #include "trajectory_parker.hh"
+#elif TRAJ_TYPE == TRAJ_GUIDING_BOUNCE
+#include "trajectory_guiding_bounce.hh"
+#elif TRAJ_TYPE == TRAJ_HYBRID
+#include "trajectory_hybrid.hh"
 #else
 #error Unsupported Trajectory type
 #endif
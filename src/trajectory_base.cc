@@ -39,26 +39,61 @@ TrajectoryBase::TrajectoryBase(void)
 \param[in] specie_in  Particle's specie
 \param[in] presize_in Initial lengths of the containers
 */
-TrajectoryBase::TrajectoryBase(const std::string& name_in, unsigned int specie_in, uint16_t status_in, bool presize_in)
+TrajectoryBase::TrajectoryBase(const std::string& name_in, unsigned int specie_in, uint16_t status_in, unsigned int presize_in)
               : Params(name_in, specie_in, status_in)
 {
-   PreSize(presize_in);
+   presize = presize_in;
 };
 
 /*!
 \author Vladimir Florinski
 \date 04/15/2022
 \param[in] init_cap Initial array capacity
+\note The arrays are never shrunk, so they serve as an arena that is reused by every trajectory computed by this object
 */
 void TrajectoryBase::PreSize(int init_cap)
 {
    traj_t.clear();
    traj_pos.clear();
    traj_mom.clear();
-   presize = init_cap;
-   traj_t.reserve(presize);
-   traj_pos.reserve(presize);
-   traj_mom.reserve(presize);
+   traj_t.reserve(init_cap);
+   traj_pos.reserve(init_cap);
+   traj_mom.reserve(init_cap);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return Number of trajectory points that the recording policy could keep at once
+\note For "TRAJ_RECORD_ALL" and "TRAJ_RECORD_STRIDE" this is an estimate based on "presize" and the arrays may still grow during the first few trajectories.
+*/
+unsigned int TrajectoryBase::RecordCapacity(void) const
+{
+   switch(record_mode) {
+   case TRAJ_RECORD_NONE:
+      return 2;
+   case TRAJ_RECORD_STRIDE:
+      return presize / record_param + 2;
+   case TRAJ_RECORD_LAST:
+      return 2 * record_param + 1;
+   default:
+      return presize;
+   };
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] mode  Recording policy, one of "TRAJ_RECORD_NONE", "TRAJ_RECORD_STRIDE", "TRAJ_RECORD_LAST", or "TRAJ_RECORD_ALL"
+\param[in] param Stride for "TRAJ_RECORD_STRIDE" or the number of points to keep for "TRAJ_RECORD_LAST" (ignored otherwise)
+*/
+void TrajectoryBase::SetRecording(int mode, unsigned int param)
+{
+   record_mode = mode;
+   record_param = std::max(param, 1U);
+
+// The arena is sized for the largest policy used so far
+   PreSize(RecordCapacity());
 };
 
 /*!
@@ -232,12 +267,12 @@ try {
 }
 
 catch(ExUninitialized& exception) {
-   RAISE_BITS(_status, TRAJ_DISCARD);
+   Discard(TRAJ_DISCARD_UNINITIALIZED);
    throw;
 }
 
 catch(ExBoundaryError& exception) {
-   RAISE_BITS(_status, TRAJ_DISCARD);
+   Discard(TRAJ_DISCARD_BOUNDARY);
    throw;
 };
 
@@ -247,28 +282,8 @@ catch(ExBoundaryError& exception) {
 \date 10/08/2024
 */
 void TrajectoryBase::CommonFields(void)
-try {
-   background->GetFields(_t, _pos, ConvertMomentum(), _spdata);
-}
-
-catch(ExUninitialized& exception) {
-   RAISE_BITS(_status, TRAJ_DISCARD);
-   throw;
-}
-
-catch(ExCoordinates& exception) {
-   RAISE_BITS(_status, TRAJ_DISCARD);
-   throw;
-}
-
-catch(ExFieldError& exception) {
-   RAISE_BITS(_status, TRAJ_DISCARD);
-   throw;
-}
-
-catch(ExServerError& exception) {
-   RAISE_BITS(_status, TRAJ_DISCARD);
-   throw;
+{
+   if(!TryCommonFields()) ThrowDiscard();
 };
 
 /*!
@@ -281,28 +296,26 @@ catch(ExServerError& exception) {
 \param[out] spdata Spatial data at t_in and pos_in for output
 */
 void TrajectoryBase::CommonFields(double t_in, const GeoVector& pos_in, const GeoVector& mom_in, SpatialData& spdata)
-try {
-   background->GetFields(t_in, pos_in, mom_in, spdata);
-}
-
-catch(ExUninitialized& exception) {
-   RAISE_BITS(_status, TRAJ_DISCARD);
-   throw;
-}
-
-catch(ExCoordinates& exception) {
-   RAISE_BITS(_status, TRAJ_DISCARD);
-   throw;
-}
+{
+   int fields_status = background->TryGetFields(t_in, pos_in, mom_in, spdata);
+   if(fields_status != FIELDS_OK) {
+      Discard(fields_status);
+      ThrowDiscard();
+   };
+};
 
-catch(ExFieldError& exception) {
-   RAISE_BITS(_status, TRAJ_DISCARD);
-   throw;
-}
+/*!
+\author Swati Sharma
+\date 10/17/2026
 
-catch(ExServerError& exception) {
-   RAISE_BITS(_status, TRAJ_DISCARD);
-   throw;
+The exception type matches the one "BackgroundBase::GetFields()" would throw for the recorded discard reason.
+*/
+void TrajectoryBase::ThrowDiscard(void) const
+{
+   if(discard_reason == TRAJ_DISCARD_UNINITIALIZED) throw ExUninitialized();
+   else if(discard_reason == TRAJ_DISCARD_COORDINATES) throw ExCoordinates();
+   else if(discard_reason == TRAJ_DISCARD_SERVER) throw ExServerError();
+   else throw ExFieldError();
 };
 
 /*!
@@ -335,8 +348,8 @@ bool TrajectoryBase::RKSlopes(void)
 // If an exit spatial boundary was crossed, the fields may no longer be available, so the full RK step cannot be completed. In that case the function should return immediately and the last recorded position and momentum will be saved as if the step has completed. A check for momentum boundary is not needed; if one was crossed it will be recorded at the end of the step.
       if(SpaceTerminateCheck()) return true;
 
-// Obtain the fields at the new position. We can now compute p_perp and velocity even when using MM conservation.
-      CommonFields();
+// Obtain the fields at the new position. We can now compute p_perp and velocity even when using MM conservation. If the fields are unavailable the trajectory is already marked as discarded.
+      if(!TryCommonFields()) return true;
 
 // Compute/Recompute relevant momentum components based on transport
       MomentumCorrection();
@@ -559,7 +572,7 @@ bool TrajectoryBase::RKAdvance(void)
 
 // If trajectory is not finished (in particular, spatial boundary not crossed), the fields can be computed and momentum corrected
    if(BITS_LOWERED(_status, TRAJ_FINISH)) {
-      CommonFields();
+      if(!TryCommonFields()) return true;
       MomentumCorrection();
    };
 
@@ -798,14 +811,9 @@ GeoVector TrajectoryBase::GetPosition(double t_in) const
    int pt;
    double weight;
 
-#ifdef RECORD_TRAJECTORY
    GetIdx(t_in, pt, weight);
    if(pt < 0) return traj_pos[0];
    else return weight * traj_pos[pt] + (1.0 - weight) * traj_pos[pt + 1];
-#else
-   std::cout << "Cannot get position with respect to time because it is not being recorded." << std::endl;
-   return gv_zeros;
-#endif
 };
 
 /*!
@@ -819,7 +827,6 @@ GeoVector TrajectoryBase::GetVelocity(double t_in) const
    int pt;
    double weight, mom1, vel1, mom2, vel2;
 
-#ifdef RECORD_TRAJECTORY
    GetIdx(t_in, pt, weight);
    if(pt < 0) {
       mom1 = traj_mom[0].Norm();
@@ -835,10 +842,6 @@ GeoVector TrajectoryBase::GetVelocity(double t_in) const
       vel2 = Vel(mom2, specie);
       return weight * (vel1 / mom1) * traj_mom[pt] + (1.0 - weight) * (vel2 / mom2) * traj_mom[pt + 1];
    };
-#else
-   std::cout << "Cannot get velocity with respect to time because it is not being recorded." << std::endl;
-   return gv_zeros;
-#endif
 };
 
 /*!
@@ -852,14 +855,9 @@ double TrajectoryBase::GetEnergy(double t_in) const
    int pt;
    double weight;
 
-#ifdef RECORD_TRAJECTORY
    GetIdx(t_in, pt, weight);
    if(pt < 0) return EnrKin(traj_mom[0].Norm(), specie);
    else return weight * EnrKin(traj_mom[pt].Norm(), specie) + (1.0 - weight) * EnrKin(traj_mom[pt + 1].Norm(), specie);
-#else
-   std::cout << "Cannot get energy with respect to time because it is not being recorded." << std::endl;
-   return 0.0;
-#endif
 };
 
 /*!
@@ -874,7 +872,6 @@ double TrajectoryBase::GetDistance(double t_in) const
    double weight, length = 0.0;
    GeoVector pos_final;
 
-#ifdef RECORD_TRAJECTORY
    GetIdx(t_in, pt, weight);
    if(pt >= 0) {
       for(ipt = 0; ipt < pt; ipt++) length += (traj_pos[ipt + 1] - traj_pos[ipt]).Norm();
@@ -883,10 +880,6 @@ double TrajectoryBase::GetDistance(double t_in) const
    };
 
    return length;
-#else
-   std::cout << "Cannot get distance along trajectory because it is not being recorded." << std::endl;
-   return 0.0;
-#endif
 };
 
 /*!
@@ -909,7 +902,10 @@ try {
 // Obtain the fields for that position
    _spdata._mask = BACKGROUND_ALL | BACKGROUND_gradALL | BACKGROUND_dALLdt;
    spdata0._mask = BACKGROUND_ALL | BACKGROUND_gradALL | BACKGROUND_dALLdt;
-   CommonFields();
+   discard_reason = TRAJ_DISCARD_NONE;
+
+// If the fields are unavailable the trajectory is returned with the TRAJ_DISCARD flag raised and "Integrate()" will not advance it.
+   if(!TryCommonFields()) return;
 
 // Record the initial spatial data for distribution purposes.
    spdata0 = _spdata;
@@ -926,18 +922,15 @@ try {
 // Adaptive step must be large at first so that "dt" starts with a physical step.
    dt_adaptive = sp_large * _spdata.dmax / c_code;
 
-// Re-initialize the trajectory arrays
-#ifdef RECORD_TRAJECTORY
-   PreSize(presize);
-#else
-   PreSize(1);
+// Re-initialize the trajectory arrays. The capacity is retained from the previous trajectory, so normally no memory is allocated here.
+   PreSize(RecordCapacity());
    n_segs = 0;
-#endif
 
 // The first element of traj_* arrays is necessary even if trajectories are not being recorded because it is used by the distributions in "ProcessTrajectory"
    traj_t.push_back(_t);
    traj_pos.push_back(_pos);
    traj_mom.push_back(_mom);
+   keep_last = true;
    
 // Lower all flags
    LOWER_BITS(_status, STATE_INVALID);
@@ -957,12 +950,12 @@ try {
 }
 
 catch(ExUninitialized& exception) {
-   RAISE_BITS(_status, TRAJ_DISCARD);
+   Discard(TRAJ_DISCARD_UNINITIALIZED);
    throw;
 }
 
 catch(ExFieldError& exception) {
-   RAISE_BITS(_status, TRAJ_DISCARD);
+   Discard(TRAJ_DISCARD_FIELD);
    throw;
 };
 
@@ -970,6 +963,8 @@ catch(ExFieldError& exception) {
 \author Vladimir Florinski
 \author Juan G Alonso Guzman
 \date 12/17/2020
+
+A failed step does not throw. A trajectory that cannot be completed is returned with the TRAJ_DISCARD flag raised and the cause is available from "DiscardReason()". Auxiliary field evaluations performed by some trajectory types still throw, but the reason is recorded before the exception propagates.
 */
 void TrajectoryBase::Integrate(void)
 {
@@ -992,8 +987,8 @@ void TrajectoryBase::Integrate(void)
 #if TRAJ_ADV_SAFETY_LEVEL > 1
 // Too many steps were taken - terminate
       if(Segments() > max_trajectory_steps) {
-         RAISE_BITS(_status, TRAJ_DISCARD);
-         throw ExMaxStepsReached();
+         Discard(TRAJ_DISCARD_MAX_STEPS);
+         return;
       };
 
 // Too many time adaptations were performed - terminate
@@ -1001,8 +996,8 @@ void TrajectoryBase::Integrate(void)
       else {
          time_step_adaptations++;
          if(time_step_adaptations > max_time_adaptations) {
-            RAISE_BITS(_status, TRAJ_DISCARD);
-            throw ExMaxTimeAdaptsReached();
+            Discard(TRAJ_DISCARD_MAX_ADAPTS);
+            return;
          };
       };
 #endif
@@ -1010,12 +1005,12 @@ void TrajectoryBase::Integrate(void)
 #if TRAJ_ADV_SAFETY_LEVEL > 0
 // Time step is too small - terminate
       if(dt < sp_tiny * _spdata.dmax / c_code) {
-         RAISE_BITS(_status, TRAJ_DISCARD);
-         throw ExTimeStepTooSmall();
+         Discard(TRAJ_DISCARD_DT_SMALL);
+         return;
       }
       else if(!std::isnormal(dt)) {
-         RAISE_BITS(_status, TRAJ_DISCARD);
-         throw ExTimeStepNan();
+         Discard(TRAJ_DISCARD_DT_NAN);
+         return;
       };
 #endif
 
@@ -1032,6 +1027,26 @@ void TrajectoryBase::StopBackground(void)
    background->StopServerFront();
 };
 
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[out] state Persistent state of the background
+*/
+void TrajectoryBase::PackBackgroundState(std::vector<double>& state) const
+{
+   background->PackState(state);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] state Persistent state of the background
+*/
+void TrajectoryBase::UnpackBackgroundState(const std::vector<double>& state)
+{
+   background->UnpackState(state);
+};
+
 /*!
 \author Juan G Alonso Guzman
 \author Vladimir Florinski
@@ -1062,59 +1077,109 @@ int TrajectoryBase::Crossings(unsigned int output, unsigned int bnd) const
 void TrajectoryBase::PrintTrajectory(const std::string traj_name, bool phys_units, unsigned int output, 
                                      unsigned int stride, double dt_out) const
 {
-   unsigned int pt, iter_out = 0, max_out = 1000000;
-   double mom_mag, vm_ratio, t_out = 0.0, engkin_t;
-   GeoVector pos_t, vel_t;
+   int bit;
+   unsigned int n_cols = 0, row, col;
+   std::vector<double> values;
    std::ofstream trajfile;
 
-#ifdef RECORD_TRAJECTORY
+   for(bit = 0; bit < traj_output_bits; bit++) {
+      if(output & (1 << bit)) n_cols++;
+   };
+   SampleTrajectory(phys_units, output, stride, dt_out, values);
+   if(!n_cols) return;
+
    trajfile.open(traj_name.c_str());
 
 // Generate multiple column output
    trajfile << std::setprecision(12);
+   for(row = 0; row < values.size() / n_cols; row++) {
+      for(col = 0; col < n_cols; col++) trajfile << std::setw(20) << values[row * n_cols + col];
+      trajfile << "\n";
+   };
+
+   trajfile.close();
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in]  phys_units Use physical units for output
+\param[in]  output     Which coordinates to sample, see "PrintTrajectory()"
+\param[in]  stride     Distance between the sampled points. If stride = 0, sample at multiples of "dt_out".
+\param[in]  dt_out     Time increment at which to sample when stride = 0
+\param[out] values     Row-major table of the sampled quantities, one row per output point
+
+In the time-based mode the trajectory is resampled in a single forward sweep over the recorded points, which is equivalent to calling "GetPosition()", "GetVelocity()", and "GetEnergy()" for every output time, but without the search.
+*/
+void TrajectoryBase::SampleTrajectory(bool phys_units, unsigned int output, unsigned int stride, double dt_out, std::vector<double>& values) const
+{
+   unsigned int pt, n_out, max_out = 1000000;
+   double mom1, mom2, vm_ratio1, vm_ratio2, weight, t_out;
+
+   values.clear();
+
+// Add one row with the selected quantities
+   auto AddRow = [&](double t, const GeoVector& pos, const GeoVector& vel, double engkin) {
+      if(output & 0x01) values.push_back(t * (phys_units ? unit_time_fluid : 1.0));
+      if(output & 0x02) values.push_back(pos[0] * (phys_units ? unit_length_fluid : 1.0));
+      if(output & 0x04) values.push_back(pos[1] * (phys_units ? unit_length_fluid : 1.0));
+      if(output & 0x08) values.push_back(pos[2] * (phys_units ? unit_length_fluid : 1.0));
+      if(output & 0x10) values.push_back(vel[0] * (phys_units ? unit_velocity_fluid : 1.0));
+      if(output & 0x20) values.push_back(vel[1] * (phys_units ? unit_velocity_fluid : 1.0));
+      if(output & 0x40) values.push_back(vel[2] * (phys_units ? unit_velocity_fluid : 1.0));
+      if(output & 0x80) values.push_back(engkin * (phys_units ? unit_energy_particle : 1.0));
+   };
 
    if(stride) {
       for(pt = 0; pt < traj_t.size(); pt += stride) {
 //FIXME: This computation of momentum magnitude is not guaranteed to work for focused transport. It is only approximately correct when magnitude (_mom[0]) >> pitch angle cosine (_mom[1]).
-         mom_mag = traj_mom[pt].Norm();
-         vm_ratio = Vel(mom_mag, specie) / mom_mag;
-
-         if(output & 0x01) trajfile << std::setw(20) << traj_t[pt] * (phys_units ? unit_time_fluid : 1.0);
-         if(output & 0x02) trajfile << std::setw(20) << traj_pos[pt][0] * (phys_units ? unit_length_fluid : 1.0);
-         if(output & 0x04) trajfile << std::setw(20) << traj_pos[pt][1] * (phys_units ? unit_length_fluid : 1.0);
-         if(output & 0x08) trajfile << std::setw(20) << traj_pos[pt][2] * (phys_units ? unit_length_fluid : 1.0);
-         if(output & 0x10) trajfile << std::setw(20) << vm_ratio * traj_mom[pt][0] * (phys_units ? unit_velocity_fluid : 1.0);
-         if(output & 0x20) trajfile << std::setw(20) << vm_ratio * traj_mom[pt][1] * (phys_units ? unit_velocity_fluid : 1.0);
-         if(output & 0x40) trajfile << std::setw(20) << vm_ratio * traj_mom[pt][2] * (phys_units ? unit_velocity_fluid : 1.0);
-         if(output & 0x80) trajfile << std::setw(20) << EnrKin(mom_mag, specie) * (phys_units ? unit_energy_particle : 1.0);
-         trajfile << std::endl;
-      };
-   }
-   else {
-      while(t_out < traj_t.back() && iter_out < max_out) {
-         pos_t = GetPosition(t_out);
-         vel_t = GetVelocity(t_out);
-         engkin_t = GetEnergy(t_out);
-
-         if(output & 0x01) trajfile << std::setw(20) << t_out * (phys_units ? unit_time_fluid : 1.0);
-         if(output & 0x02) trajfile << std::setw(20) << pos_t[0] * (phys_units ? unit_length_fluid : 1.0);
-         if(output & 0x04) trajfile << std::setw(20) << pos_t[1] * (phys_units ? unit_length_fluid : 1.0);
-         if(output & 0x08) trajfile << std::setw(20) << pos_t[2] * (phys_units ? unit_length_fluid : 1.0);
-         if(output & 0x10) trajfile << std::setw(20) << vel_t[0] * (phys_units ? unit_velocity_fluid : 1.0);
-         if(output & 0x20) trajfile << std::setw(20) << vel_t[1] * (phys_units ? unit_velocity_fluid : 1.0);
-         if(output & 0x40) trajfile << std::setw(20) << vel_t[2] * (phys_units ? unit_velocity_fluid : 1.0);
-         if(output & 0x80) trajfile << std::setw(20) << engkin_t * (phys_units ? unit_energy_particle : 1.0);
-         trajfile << std::endl;
-
-         t_out += dt_out;
+         mom1 = traj_mom[pt].Norm();
+         vm_ratio1 = Vel(mom1, specie) / mom1;
+         AddRow(traj_t[pt], traj_pos[pt], vm_ratio1 * traj_mom[pt], EnrKin(mom1, specie));
       };
+      return;
    };
 
-   trajfile.close();
-#else
-   std::cout << "Cannot print trajectory because it is not being recorded." << std::endl;
-   return;
-#endif
+// A single point cannot be interpolated
+   if(traj_t.size() < 2) {
+      mom1 = traj_mom[0].Norm();
+      AddRow(traj_t[0], traj_pos[0], (Vel(mom1, specie) / mom1) * traj_mom[0], EnrKin(mom1, specie));
+      return;
+   };
+
+   pt = 0;
+   t_out = 0.0;
+   for(n_out = 0; t_out < traj_t.back() && n_out < max_out; n_out++) {
+
+// The bracketing interval only moves forward because "t_out" is increasing
+      while(pt + 2 < traj_t.size() && traj_t[pt + 1] <= t_out) pt++;
+      weight = (traj_t[pt + 1] - t_out) / (traj_t[pt + 1] - traj_t[pt]);
+      weight = std::clamp(weight, 0.0, 1.0);
+
+      mom1 = traj_mom[pt].Norm();
+      vm_ratio1 = Vel(mom1, specie) / mom1;
+      mom2 = traj_mom[pt + 1].Norm();
+      vm_ratio2 = Vel(mom2, specie) / mom2;
+      AddRow(t_out, weight * traj_pos[pt] + (1.0 - weight) * traj_pos[pt + 1],
+             weight * vm_ratio1 * traj_mom[pt] + (1.0 - weight) * vm_ratio2 * traj_mom[pt + 1],
+             weight * EnrKin(mom1, specie) + (1.0 - weight) * EnrKin(mom2, specie));
+
+      t_out += dt_out;
+   };
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] store   Trajectory store, which determines the columns and units
+\param[in] traj_id Identifier of this trajectory in the store
+\param[in] stride  Distance between the stored points. If stride = 0, store at multiples of "dt_out".
+\param[in] dt_out  Time increment at which to store when stride = 0
+*/
+void TrajectoryBase::WriteTrajectory(TrajectoryStore& store, int64_t traj_id, unsigned int stride, double dt_out)
+{
+   SampleTrajectory(store.PhysUnits(), store.Output(), stride, dt_out, sample_buffer);
+   store.Append(traj_id, sample_buffer);
 };
 
 /*!
@@ -1129,7 +1194,6 @@ void TrajectoryBase::PrintCSV(const std::string traj_name, bool phys_units, unsi
    unsigned int pt;
    std::ofstream trajfile;
 
-#ifdef RECORD_TRAJECTORY
    trajfile.open(traj_name.c_str());
 
 // Generate CSV output
@@ -1140,14 +1204,10 @@ void TrajectoryBase::PrintCSV(const std::string traj_name, bool phys_units, unsi
       trajfile << std::setw(20) << traj_pos[pt][1] * (phys_units ? unit_length_fluid : 1.0);
       trajfile << ",";
       trajfile << std::setw(20) << traj_pos[pt][2] * (phys_units ? unit_length_fluid : 1.0);
-      trajfile << std::endl;
+      trajfile << "\n";
    };
 
    trajfile.close();
-#else
-   std::cout << "Cannot print trajectory because it is not being recorded." << std::endl;
-   return;
-#endif
 };
 
 /*!
@@ -1157,7 +1217,7 @@ void TrajectoryBase::PrintCSV(const std::string traj_name, bool phys_units, unsi
 void TrajectoryBase::InterpretStatus(void) const
 {
    std::cerr << "Trajectory status: ";
-   if(BITS_RAISED(_status, TRAJ_DISCARD)) std::cerr << "discarded\n";
+   if(BITS_RAISED(_status, TRAJ_DISCARD)) std::cerr << "discarded (" << traj_discard_names[discard_reason] << ")\n";
 
 // These three states correspond to an absorbing boundary leading to a termination. The status is preserved and can be checked after a trajectory completion.
    else if(BITS_RAISED(_status, TRAJ_FINISH)) {
@@ -16,6 +16,7 @@ This file is part of the SPECTRUM suite of scientific numerical simulation codes
 #include "diffusion_base.hh"
 #include "boundary_base.hh"
 #include "initial_base.hh"
+#include "trajectory_store.hh"
 #include "common/rk_config.hh"
 
 #ifndef TRAJ_TYPE
@@ -24,9 +25,6 @@ This file is part of the SPECTRUM suite of scientific numerical simulation codes
 
 namespace Spectrum {
 
-//! Record trajectory flag
-#define RECORD_TRAJECTORY
-
 //! Record |B| extrema flag
 // #define RECORD_BMAG_EXTREMA
 
@@ -56,6 +54,59 @@ const uint16_t TRAJ_MOMENTUM_CROSSED = 0x0080;
 //! Trajectory is invalid and must be discarded
 const uint16_t TRAJ_DISCARD = 0x0100;
 
+//! Discard reason: the trajectory was not discarded
+const int TRAJ_DISCARD_NONE = FIELDS_OK;
+
+//! Discard reason: an object was not set up (same as the field error code)
+const int TRAJ_DISCARD_UNINITIALIZED = FIELDS_ERR_UNINITIALIZED;
+
+//! Discard reason: the trajectory left the domain of the background (same as the field error code)
+const int TRAJ_DISCARD_COORDINATES = FIELDS_ERR_COORDINATES;
+
+//! Discard reason: the fields could not be computed (same as the field error code)
+const int TRAJ_DISCARD_FIELD = FIELDS_ERR_FIELD;
+
+//! Discard reason: the server could not provide the fields (same as the field error code)
+const int TRAJ_DISCARD_SERVER = FIELDS_ERR_SERVER;
+
+//! Discard reason: a boundary could not be evaluated
+const int TRAJ_DISCARD_BOUNDARY = 5;
+
+//! Discard reason: the maximum number of steps was reached
+const int TRAJ_DISCARD_MAX_STEPS = 6;
+
+//! Discard reason: the maximum number of time step adaptations was reached
+const int TRAJ_DISCARD_MAX_ADAPTS = 7;
+
+//! Discard reason: the time step became too small
+const int TRAJ_DISCARD_DT_SMALL = 8;
+
+//! Discard reason: the time step became nan
+const int TRAJ_DISCARD_DT_NAN = 9;
+
+//! Discard reason: an exception thrown elsewhere
+const int TRAJ_DISCARD_OTHER = 10;
+
+//! Number of discard reasons
+const int TRAJ_DISCARD_REASONS = 11;
+
+//! Readable discard reasons
+const std::string traj_discard_names[TRAJ_DISCARD_REASONS] = {"none", "uninitialized", "outside of domain", "field error", "server error",
+                                                              "boundary error", "too many steps", "too many time adaptations",
+                                                              "time step too small", "time step nan", "other"};
+
+//! Recording policy: keep only the first and the most recent points
+const int TRAJ_RECORD_NONE = 0;
+
+//! Recording policy: keep every Nth point, plus the first and the most recent points
+const int TRAJ_RECORD_STRIDE = 1;
+
+//! Recording policy: keep at least the last K points (and at most 2K), plus the first point
+const int TRAJ_RECORD_LAST = 2;
+
+//! Recording policy: keep every point
+const int TRAJ_RECORD_ALL = 3;
+
 //! Clone function pattern
 #define CloneFunctionTrajectory(T) std::unique_ptr<TrajectoryBase> Clone(void) const override {return std::make_unique<T>();};
 
@@ -162,6 +213,8 @@ inline const char* ExTimeStepNan::what(void) const noexcept
 A trajectory should be thought of as a self-contained simulation. There are four ingredients to a trajectory: (a) the transport physics that is built into the class itself, (b) the background u, E, B fields provided through "background", (c) the boundary conditions contained in "bcond_t", "bcond_s", and "bcond_m", and (d) the initial conditions provided by "icond_s" and "icond_m". The trajectory is responsible for computing the derived transport coefficients. This is done for efficiency purposes because a separate transport class hierarchy would have to interact with the other components and exchanging different kinds of transport parameters must be done through a container, hence require extra load/store operations.
 
 A trajectory object is considered initialized if (a) background is assigned, (b) at least one time boundary is assigned, (c) the space initial condition is assigned, and (d) the momentum initial condition is assigned.
+
+How much of the trajectory is kept in "traj_t", "traj_pos", and "traj_mom" is controlled at run time by "SetRecording()". The first and the most recent points are always available, which is all the distributions need. The time-dependent getters and the print functions work with whatever points were kept.
 */
 class TrajectoryBase : public Params {
 
@@ -170,6 +223,12 @@ protected:
 //! Initial length of trajectory containers (persistent)
    unsigned int presize = 1;
 
+//! Trajectory recording policy (persistent)
+   int record_mode = TRAJ_RECORD_ALL;
+
+//! Stride or window length of the recording policy (persistent)
+   unsigned int record_param = 1;
+
 //! Particle's charge (persistent)
    double q;
 
@@ -211,10 +270,11 @@ protected:
 //! Momentum along trajectory (transient)
    std::vector <GeoVector> traj_mom;
 
-#ifndef RECORD_TRAJECTORY
 //! Number of trajectory segments (transient)
    int n_segs;
-#endif
+
+//! Whether the most recent point must be kept when the next one is stored (transient)
+   bool keep_last;
 
 //! Number of reflections (transient)
    int n_refl;
@@ -222,6 +282,9 @@ protected:
 //! Number of mirrorings (transient)
    int n_mirr;
 
+//! Reason for discarding the trajectory (transient)
+   int discard_reason = TRAJ_DISCARD_NONE;
+
 //! Active time boundary (transient)
    int bactive_t;
 
@@ -267,17 +330,23 @@ protected:
 //! Time step from the adaptive scheme (transient)
    double dt_adaptive;
 
+//! Buffer for sampled output (transient)
+   std::vector <double> sample_buffer;
+
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 
 //! Default constructor (protected, class not designed to be instantiated)
    TrajectoryBase(void);
 
 //! Constructor with arguments (to speed up construction of derived classes)
-   TrajectoryBase(const std::string& name_in, unsigned int specie_in, uint16_t status_in, bool presize_in);
+   TrajectoryBase(const std::string& name_in, unsigned int specie_in, uint16_t status_in, unsigned int presize_in);
 
 //! Clear the content and set the initial container capacity to improve performance
    void PreSize(int init_cap);
 
+//! Container capacity needed by the recording policy
+   unsigned int RecordCapacity(void) const;
+
 //! Find the nearest time point
    void GetIdx(double t_in, int& pt, double& weight) const;
 
@@ -320,6 +389,15 @@ protected:
 //! Overloaded CommonFields for custom time and position, and output field
    void CommonFields(double t_in, const GeoVector& pos_in, const GeoVector& mom_in, SpatialData& spdata);
 
+//! Compute the common fields, discarding the trajectory instead of throwing on failure
+   bool TryCommonFields(void);
+
+//! Mark the trajectory as discarded for a given reason
+   void Discard(int reason);
+
+//! Throw the exception corresponding to the discard reason
+   void ThrowDiscard(void) const;
+
 //! Compute the RK slopes
    virtual void Slopes(GeoVector& slope_pos_istage, GeoVector& slope_mom_istage) = 0;
 
@@ -366,6 +444,9 @@ public:
 //! Set the particle specie
    void SetSpecie(unsigned int specie_in);
 
+//! Set the trajectory recording policy
+   void SetRecording(int mode, unsigned int param = 1);
+
 //! Connect to an existing distribution object 
    void ConnectDistribution(const std::shared_ptr<DistributionBase> distribution_in);
 
@@ -419,9 +500,18 @@ public:
 //! Return the time elapsed
    double ElapsedTime(void) const;
 
+//! Return the reason for discarding the trajectory
+   int DiscardReason(void) const;
+
 //! Signals the background that its services are no longer needed
    void StopBackground(void);
 
+//! Pack the persistent state of the background (passthrough to background)
+   void PackBackgroundState(std::vector<double>& state) const;
+
+//! Restore the persistent state of the background (passthrough to background)
+   void UnpackBackgroundState(const std::vector<double>& state);
+
 //! Clear the trajectory and start a new one
    virtual void SetStart(void);
 
@@ -434,6 +524,12 @@ public:
 //! Print various quantities along the trajectory
    void PrintTrajectory(const std::string traj_name, bool phys_units, unsigned int output, unsigned int stride = 1, double dt_out = 0.0) const;
 
+//! Sample various quantities along the trajectory
+   void SampleTrajectory(bool phys_units, unsigned int output, unsigned int stride, double dt_out, std::vector<double>& values) const;
+
+//! Append the trajectory to a binary store
+   void WriteTrajectory(TrajectoryStore& store, int64_t traj_id, unsigned int stride = 1, double dt_out = 0.0);
+
 //! Print a trajectory as CSV
    void PrintCSV(const std::string traj_name, bool phys_units, unsigned int stride = 1) const;
 
@@ -485,27 +581,58 @@ inline void TrajectoryBase::DisconnectDistribution(int distro)
 */
 inline void TrajectoryBase::Load(void)
 {
-#ifdef RECORD_TRAJECTORY
    _t = traj_t.back();
    _pos = traj_pos.back();
    _mom = traj_mom.back();
-#endif
    _vel = Vel(_mom, specie);
 };
 
 /*!
 \author Vladimir Florinski
-\date 09/25/2020
+\author Swati Sharma
+\date 10/17/2026
+
+The most recent point is always stored at the end of the arrays. Unless the recording policy requires the previous point to be kept, it is overwritten in place, so that the arrays only grow as much as the policy requires.
 */
 inline void TrajectoryBase::Store(void)
 {
-#ifdef RECORD_TRAJECTORY
-   traj_t.push_back(_t);
-   traj_pos.push_back(_pos);
-   traj_mom.push_back(_mom);
-#else
    n_segs++;
-#endif
+
+   if(keep_last) {
+      traj_t.push_back(_t);
+      traj_pos.push_back(_pos);
+      traj_mom.push_back(_mom);
+   }
+   else {
+      traj_t.back() = _t;
+      traj_pos.back() = _pos;
+      traj_mom.back() = _mom;
+   };
+
+   switch(record_mode) {
+   case TRAJ_RECORD_NONE:
+      keep_last = false;
+      break;
+   case TRAJ_RECORD_STRIDE:
+      keep_last = (n_segs % record_param == 0);
+      break;
+   case TRAJ_RECORD_LAST:
+
+// When the window is full, the last "record_param" points are moved to the front (after the first point), so the cost per step is constant on average
+      if(traj_t.size() == 2 * record_param + 1) {
+         std::copy(traj_t.end() - record_param, traj_t.end(), traj_t.begin() + 1);
+         std::copy(traj_pos.end() - record_param, traj_pos.end(), traj_pos.begin() + 1);
+         std::copy(traj_mom.end() - record_param, traj_mom.end(), traj_mom.begin() + 1);
+         traj_t.resize(record_param + 1);
+         traj_pos.resize(record_param + 1);
+         traj_mom.resize(record_param + 1);
+      };
+      keep_last = true;
+      break;
+   default:
+      keep_last = true;
+      break;
+   };
 };
 
 /*!
@@ -550,11 +677,7 @@ inline GeoVector TrajectoryBase::ConvertMomentum(void) const
 */
 inline int TrajectoryBase::Segments(void) const
 {
-#ifdef RECORD_TRAJECTORY
-   return traj_t.size() - 1;
-#else
    return n_segs;
-#endif
 };
 
 /*!
@@ -584,11 +707,43 @@ inline int TrajectoryBase::Mirrorings(void) const
 */
 inline double TrajectoryBase::ElapsedTime(void) const
 {
-#ifdef RECORD_TRAJECTORY
    return traj_t.back();
-#else
-   return _t;
-#endif
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return One of the TRAJ_DISCARD_* codes
+*/
+inline int TrajectoryBase::DiscardReason(void) const
+{
+   return discard_reason;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] reason One of the TRAJ_DISCARD_* codes
+*/
+inline void TrajectoryBase::Discard(int reason)
+{
+   RAISE_BITS(_status, TRAJ_DISCARD);
+   discard_reason = reason;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return True if the fields were computed, false if the trajectory was discarded
+
+This version is used in the integration loop, where a failure should end the trajectory without unwinding the stack. The fields in "_spdata" are not modified on failure.
+*/
+inline bool TrajectoryBase::TryCommonFields(void)
+{
+   int fields_status = background->TryGetFields(_t, _pos, ConvertMomentum(), _spdata);
+   if(fields_status == FIELDS_OK) return true;
+   Discard(fields_status);
+   return false;
 };
 
 };
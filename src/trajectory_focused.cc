@@ -30,9 +30,9 @@ TrajectoryFocused::TrajectoryFocused(void)
 \param[in] name_in   Readable name of the class
 \param[in] specie_in Particle's specie
 \param[in] status_in Initial status
-\param[in] presize_in Whether to pre-allocate memory for trajectory arrays
+\param[in] presize_in Initial lengths of the containers
 */
-TrajectoryFocused::TrajectoryFocused(const std::string& name_in, unsigned int specie_in, uint16_t status_in, bool presize_in)
+TrajectoryFocused::TrajectoryFocused(const std::string& name_in, unsigned int specie_in, uint16_t status_in, unsigned int presize_in)
                  : TrajectoryBase(name_in, specie_in, status_in, presize_in)
 {
 };
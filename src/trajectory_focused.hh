@@ -86,7 +86,7 @@ public:
    TrajectoryFocused(void);
 
 //! Constructor with arguments (to speed up construction of derived classes)
-   TrajectoryFocused(const std::string& name_in, unsigned int specie_in, uint16_t status_in, bool presize_in);
+   TrajectoryFocused(const std::string& name_in, unsigned int specie_in, uint16_t status_in, unsigned int presize_in);
 
 //! Copy constructor (class not copyable)
    TrajectoryFocused(const TrajectoryFocused& other) = delete;
@@ -112,11 +112,9 @@ public:
 */
 inline void TrajectoryFocused::Load(void)
 {
-#ifdef RECORD_TRAJECTORY
    _t = traj_t.back();
    _pos = traj_pos.back();
    _mom = traj_mom.back();
-#endif
    _vel[0] = Vel(_mom[0], specie);
    _vel[1] = _mom[1];
    _vel[2] = 0.0;
@@ -31,9 +31,9 @@ TrajectoryGuiding::TrajectoryGuiding(void)
 \param[in] name_in   Readable name of the class
 \param[in] specie_in Particle's specie
 \param[in] status_in Initial status
-\param[in] presize_in Whether to pre-allocate memory for trajectory arrays
+\param[in] presize_in Initial lengths of the containers
 */
-TrajectoryGuiding::TrajectoryGuiding(const std::string& name_in, unsigned int specie_in, uint16_t status_in, bool presize_in)
+TrajectoryGuiding::TrajectoryGuiding(const std::string& name_in, unsigned int specie_in, uint16_t status_in, unsigned int presize_in)
                  : TrajectoryBase(name_in, specie_in, status_in, presize_in)
 {
 };
@@ -84,7 +84,7 @@ public:
    TrajectoryGuiding(void);
 
 //! Constructor with arguments (to speed up construction of derived classes)
-   TrajectoryGuiding(const std::string& name_in, unsigned int specie_in, uint16_t status_in, bool presize_in);
+   TrajectoryGuiding(const std::string& name_in, unsigned int specie_in, uint16_t status_in, unsigned int presize_in);
 
 //! Copy constructor (class not copyable)
    TrajectoryGuiding(const TrajectoryGuiding& other) = delete;
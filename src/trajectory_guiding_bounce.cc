@@ -0,0 +1,283 @@
+/*!
+\file trajectory_guiding_bounce.cc
+\brief Defines a class for trajectory based on bounce-averaged guiding center equations
+\author Swati Sharma
+
+This file is part of the SPECTRUM suite of scientific numerical simulation codes. SPECTRUM stands for Space Plasma and Energetic Charged particle TRansport on Unstructured Meshes. The code simulates plasma or neutral particle flows using MHD equations on a grid, transport of cosmic rays using stochastic or grid based methods. The "unstructured" part refers to the use of a geodesic mesh providing a uniform coverage of the surface of a sphere.
+*/
+
+#include "trajectory_guiding_bounce.hh"
+#include "common/print_warn.hh"
+
+namespace Spectrum {
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// TrajectoryGuidingBounce methods
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+TrajectoryGuidingBounce::TrajectoryGuidingBounce(void)
+                       : TrajectoryGuiding(traj_name_guidingbounce, 0, STATE_NONE, defsize_guidingbounce)
+{
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in]  pos        Position on the field line
+\param[in]  mom_mag    Momentum magnitude
+\param[in]  B_mirror   Magnetic field at the mirror points
+\param[out] gfac       The value of "1 - B / B_mirror", or "(p_para / p)^2"
+\param[out] drift_perp Perpendicular component of the guiding center drift velocity
+\param[out] power      Rate of change of kinetic energy due to the perpendicular drift
+
+The fields are computed into "_spdata" and the local momentum is stored in "_mom" and "_vel". The calling function must save and restore the state.
+*/
+void TrajectoryGuidingBounce::BouncePoint(const GeoVector& pos, double mom_mag, double B_mirror, double& gfac, GeoVector& drift_perp, double& power)
+{
+   _pos = pos;
+   CommonFields();
+
+   gfac = fmax(1.0 - _spdata.Bmag / B_mirror, 0.0);
+   _mom = GeoVector(mom_mag * sqrt(1.0 - gfac), 0.0, mom_mag * sqrt(gfac));
+   _vel = Vel(_mom, specie);
+
+   DriftCoeff();
+   drift_perp = drift_vel - (drift_vel * _spdata.bhat) * _spdata.bhat;
+   power = q * (_spdata.Evec * drift_perp);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in]  pos     A point on the field line between the mirror points
+\param[in]  mom_mag Momentum magnitude
+\param[out] avg     Bounce averages on the field line
+\return True if both mirror points were found
+*/
+bool TrajectoryGuidingBounce::BounceAverage(const GeoVector& pos, double mom_mag, BounceAverages& avg)
+{
+   int dir, step;
+   bool mirrored, success = true;
+   double B_mirror, vel_mag, ds, frac, weight, time_half, B_eq;
+   double g_this, g_next, power_this, power_next, power_sum;
+   GeoVector pos_this, pos_next, pos_mid, drift_this, drift_next, drift_sum;
+
+// The tracing changes the transient state of the object, so it must be saved and restored
+   double t_saved = _t;
+   GeoVector pos_saved = _pos;
+   GeoVector mom_saved = _mom;
+   GeoVector vel_saved = _vel;
+   SpatialData spdata_saved = _spdata;
+
+// The mirror field follows from the conservation of the magnetic moment
+   B_mirror = MagneticMoment(mom_mag, 1.0, specie) / mag_mom;
+   vel_mag = Vel(mom_mag, specie);
+
+   try {
+      BouncePoint(pos, mom_mag, B_mirror, g_this, drift_this, power_this);
+      avg.pos_eq = pos;
+      B_eq = _spdata.Bmag;
+      avg.adiabaticity = LarmorRadius(mom_mag * sqrt(1.0 - g_this), B_eq, specie) * _spdata.gradBmag.Norm() / B_eq;
+
+// A particle with a 90 degree pitch angle at the local minimum of |B| does not bounce
+      if(g_this < sp_tiny) {
+         time_half = 0.0;
+         drift_sum = drift_this;
+         power_sum = power_this;
+      }
+      else {
+         time_half = 0.0;
+         drift_sum = gv_zeros;
+         power_sum = 0.0;
+
+// Trace in both directions from the starting point. The weight of each step is the integral of "ds / v_para" assuming a linear variation of "gfac" over the step.
+         for(dir = -1; dir <= 1; dir += 2) {
+            BouncePoint(pos, mom_mag, B_mirror, g_this, drift_this, power_this);
+            pos_this = pos;
+            mirrored = false;
+
+            for(step = 0; !mirrored && step < bounce_max_steps; step++) {
+               ds = bounce_ds_frac * _spdata.dmax;
+
+// Midpoint tracing of the field line
+               pos_mid = pos_this + 0.5 * dir * ds * _spdata.bhat;
+               _pos = pos_mid;
+               CommonFields();
+               pos_next = pos_this + dir * ds * _spdata.bhat;
+               BouncePoint(pos_next, mom_mag, B_mirror, g_next, drift_next, power_next);
+
+// The mirror point is located inside this step
+               if(g_next <= 0.0) {
+                  frac = g_this / (g_this - (1.0 - _spdata.Bmag / B_mirror));
+                  weight = 2.0 * frac * ds / (vel_mag * sqrt(g_this));
+                  drift_next = drift_this;
+                  power_next = power_this;
+                  mirrored = true;
+               }
+               else weight = 2.0 * ds / (vel_mag * (sqrt(g_this) + sqrt(g_next)));
+
+               time_half += weight;
+               drift_sum += 0.5 * weight * (drift_this + drift_next);
+               power_sum += 0.5 * weight * (power_this + power_next);
+
+// Keep track of the equator
+               if(!mirrored && _spdata.Bmag < B_eq) {
+                  B_eq = _spdata.Bmag;
+                  avg.pos_eq = pos_next;
+                  avg.adiabaticity = LarmorRadius(mom_mag * sqrt(1.0 - g_next), B_eq, specie) * _spdata.gradBmag.Norm() / B_eq;
+               };
+
+               pos_this = pos_next;
+               g_this = g_next;
+               drift_this = drift_next;
+               power_this = power_next;
+            };
+
+            if(!mirrored) success = false;
+         };
+      };
+   }
+
+// Leaving the domain while tracing is not a reason to discard the trajectory
+   catch(std::exception& exception) {
+      LOWER_BITS(_status, TRAJ_DISCARD);
+      success = false;
+   };
+
+   _t = t_saved;
+   _pos = pos_saved;
+   _mom = mom_saved;
+   _vel = vel_saved;
+   _spdata = spdata_saved;
+
+   if(!success) return false;
+
+   avg.period = 2.0 * time_half;
+   if(time_half > 0.0) {
+      avg.drift_vel = drift_sum / time_half;
+      avg.power = power_sum / time_half;
+   }
+   else {
+      avg.drift_vel = drift_sum;
+      avg.power = power_sum;
+   };
+   return true;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] mom_mag Momentum magnitude
+\note "avg_pri" must be up to date
+*/
+void TrajectoryGuidingBounce::MoveToEquator(double mom_mag)
+{
+   double mom_perp;
+
+   _pos = avg_pri.pos_eq;
+   CommonFields();
+   mom_perp = fmin(PerpMomentum(mag_mom, _spdata.Bmag, specie), mom_mag);
+   _mom = GeoVector(mom_perp, 0.0, sqrt(Sqr(mom_mag) - Sqr(mom_perp)));
+   _vel = Vel(_mom, specie);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return True if a step was taken
+*/
+bool TrajectoryGuidingBounce::FallBack(void)
+{
+   bounce_mode = false;
+
+// Resume from the last stored point
+   Load();
+   CommonFields();
+   return TrajectoryGuiding::Advance();
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+void TrajectoryGuidingBounce::SetStart(void)
+{
+// Call the base version of this function.
+   TrajectoryGuiding::SetStart();
+
+   bounce_mode = false;
+   bounce_phase = 0.0;
+   if(BITS_RAISED(_status, TRAJ_DISCARD)) return;
+
+// The bounce averaging is only used if the particle is trapped and the motion is adiabatic. The stored starting point is not changed.
+   if(!BounceAverage(_pos, _mom.Norm(), avg_pri)) return;
+   if(avg_pri.adiabaticity > bounce_adiabatic_limit) return;
+
+   bounce_mode = true;
+   MoveToEquator(_mom.Norm());
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return True if a step was taken
+
+The drift is integrated with the second order midpoint method. The averages at the start of the step were computed at the end of the previous step, so each step requires two field line traces.
+*/
+bool TrajectoryGuidingBounce::Advance(void)
+{
+   if(!bounce_mode) return TrajectoryGuiding::Advance();
+
+   double mom_mag = _mom.Norm();
+   double t_start = _t;
+   GeoVector pos_start = _pos;
+   BounceAverages avg_mid;
+
+// Time step from the averaged drift
+   dt_physical = cfl_adv_tg * _spdata.dmax / (avg_pri.drift_vel.Norm() + sp_tiny);
+   dt = fmin(dt_physical, dt_adaptive);
+   TimeBoundaryProximityCheck();
+
+#if TRAJ_TIME_FLOW == TRAJ_TIME_FLOW_FORWARD
+   _t = t_start + 0.5 * dt;
+   if(!BounceAverage(pos_start + 0.5 * dt * avg_pri.drift_vel, mom_mag, avg_mid)) return FallBack();
+   _t = t_start + dt;
+   _pos = pos_start + dt * avg_mid.drift_vel;
+   mom_mag = Mom(EnrKin(mom_mag, specie) + dt * avg_mid.power, specie);
+#else
+   _t = t_start - 0.5 * dt;
+   if(!BounceAverage(pos_start - 0.5 * dt * avg_pri.drift_vel, mom_mag, avg_mid)) return FallBack();
+   _t = t_start - dt;
+   _pos = pos_start - dt * avg_mid.drift_vel;
+   mom_mag = Mom(EnrKin(mom_mag, specie) - dt * avg_mid.power, specie);
+#endif
+
+// The averages on the new field line are also needed for the next step
+   if(!BounceAverage(_pos, mom_mag, avg_pri)) return FallBack();
+   MoveToEquator(mom_mag);
+
+// Mirror events are counted from the elapsed fraction of the bounce period
+   if(avg_mid.period > 0.0) {
+      bounce_phase += 2.0 * dt / avg_mid.period;
+      n_mirr += int(bounce_phase);
+      bounce_phase -= int(bounce_phase);
+   };
+
+// Handle boundaries
+   HandleBoundaries();
+   if(BITS_LOWERED(_status, TRAJ_FINISH) && !TryCommonFields()) return true;
+
+// Add the new point to the trajectory.
+   Store();
+
+// Continue with the full equations from this point if the motion is no longer adiabatic
+   if(avg_pri.adiabaticity > bounce_adiabatic_limit) bounce_mode = false;
+
+   return true;
+};
+
+};
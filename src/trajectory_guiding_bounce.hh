@@ -0,0 +1,133 @@
+/*!
+\file trajectory_guiding_bounce.hh
+\brief Declares a class for trajectory based on bounce-averaged guiding center equations
+\author Swati Sharma
+
+This file is part of the SPECTRUM suite of scientific numerical simulation codes. SPECTRUM stands for Space Plasma and Energetic Charged particle TRansport on Unstructured Meshes. The code simulates plasma or neutral particle flows using MHD equations on a grid, transport of cosmic rays using stochastic or grid based methods. The "unstructured" part refers to the use of a geodesic mesh providing a uniform coverage of the surface of a sphere.
+*/
+
+#ifndef SPECTRUM_TRAJECTORY_GUIDING_BOUNCE_HH
+#define SPECTRUM_TRAJECTORY_GUIDING_BOUNCE_HH
+
+#include "trajectory_guiding.hh"
+
+namespace Spectrum {
+
+//! Readable name of the TrajectoryGuidingBounce class
+const std::string traj_name_guidingbounce = "TrajectoryGuidingBounce";
+
+//! Default initial size
+const unsigned int defsize_guidingbounce = 10000;
+
+//! Field line tracing step as a fraction of "dmax"
+const double bounce_ds_frac = 0.1;
+
+//! Largest number of tracing steps between the starting point and a mirror point
+const int bounce_max_steps = 10000;
+
+//! Largest ratio of the Larmor radius to the field gradient scale at the equator for which the bounce averaging is used
+const double bounce_adiabatic_limit = 0.1;
+
+/*!
+\brief Bounce-averaged quantities on a field line
+\author Swati Sharma
+*/
+struct BounceAverages {
+
+//! Point of the smallest |B| between the mirror points
+   GeoVector pos_eq;
+
+//! Bounce period
+   double period;
+
+//! Bounce-averaged drift velocity (perpendicular to B)
+   GeoVector drift_vel;
+
+//! Bounce-averaged rate of change of kinetic energy
+   double power;
+
+//! Ratio of the Larmor radius to the field gradient scale at "pos_eq"
+   double adiabaticity;
+};
+
+/*!
+\brief Trajectory tracer for the bounce-averaged relativistic guiding center equations
+\author Swati Sharma
+
+In a trapping field the guiding center is kept at the point of the smallest |B| on its field line (the "equator") and is advanced with the drift velocity averaged over one bounce, so that a single step spans many bounce periods. The averages are computed by tracing the field line in both directions to the mirror points, where |B| equals the mirror field "p^2 / (2 m mu)". The guiding center drift ("TrajectoryGuiding::DriftCoeff()") is evaluated along the line with the local parallel momentum and integrated with the weight "ds / v_para", where each tracing step is integrated exactly assuming that "1 - B / B_mirror" varies linearly, so that the inverse square root singularity at the mirror points is handled without special treatment. The averages computed at the end of a step (on the new field line) are reused at the start of the next one.
+
+The class falls back to the full guiding center motion of the parent class for the remainder of the trajectory if the mirror points cannot be found (open field line or the domain boundary is reached) or if the adiabaticity parameter at the equator exceeds "bounce_adiabatic_limit".
+
+Components of "traj_mom" are: p_perp (x), unused (y), p_para (z)
+*/
+class TrajectoryGuidingBounce : public TrajectoryGuiding {
+
+protected:
+
+//! Whether the bounce-averaged equations are used (transient)
+   bool bounce_mode;
+
+//! Averages on the current field line (transient)
+   BounceAverages avg_pri;
+
+//! Fraction of a half-bounce elapsed since the last mirror event (transient)
+   double bounce_phase;
+
+//! Field evaluation at one point of the field line
+   void BouncePoint(const GeoVector& pos, double mom_mag, double B_mirror, double& gfac, GeoVector& drift_perp, double& power);
+
+//! Compute the bounce averages on the field line passing through a given point
+   bool BounceAverage(const GeoVector& pos, double mom_mag, BounceAverages& avg);
+
+//! Place the guiding center at the equator of the current field line
+   void MoveToEquator(double mom_mag);
+
+//! Switch to the full guiding center equations
+   bool FallBack(void);
+
+//! Take a step
+   bool Advance(void) override;
+
+public:
+
+//! Default constructor
+   TrajectoryGuidingBounce(void);
+
+//! Copy constructor (class not copyable)
+   TrajectoryGuidingBounce(const TrajectoryGuidingBounce& other) = delete;
+
+//! Destructor
+   ~TrajectoryGuidingBounce() override = default;
+
+//! Clone function
+   CloneFunctionTrajectory(TrajectoryGuidingBounce);
+
+//! Clear the trajectory and start a new one with specified position and momentum
+   void SetStart(void) override;
+
+//! Return whether the bounce-averaged equations are in use
+   bool BounceAveraged(void) const;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// TrajectoryGuidingBounce inline methods
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return True if the bounce-averaged equations are in use
+*/
+inline bool TrajectoryGuidingBounce::BounceAveraged(void) const
+{
+   return bounce_mode;
+};
+
+//! Trajectory type
+#if TRAJ_TYPE == TRAJ_GUIDING_BOUNCE
+typedef TrajectoryGuidingBounce TrajectoryType;
+#endif
+
+};
+
+#endif
@@ -32,9 +32,9 @@ TrajectoryGuidingDiff::TrajectoryGuidingDiff(void)
 \param[in] name_in   Readable name of the class
 \param[in] specie_in Particle's specie
 \param[in] status_in Initial status
-\param[in] presize_in Whether to pre-allocate memory for trajectory arrays
+\param[in] presize_in Initial lengths of the containers
 */
-TrajectoryGuidingDiff::TrajectoryGuidingDiff(const std::string& name_in, unsigned int specie_in, uint16_t status_in, bool presize_in)
+TrajectoryGuidingDiff::TrajectoryGuidingDiff(const std::string& name_in, unsigned int specie_in, uint16_t status_in, unsigned int presize_in)
                      : TrajectoryGuiding(name_in, specie_in, status_in, presize_in)
 {
 };
@@ -102,12 +102,13 @@ catch(ExFieldError& exception) {
 */
 void TrajectoryGuidingDiff::EulerPerpDiffSlopes(void)
 {
-   double dWx, dWy;
+   double dW[2], dWx, dWy;
    GeoVector mom_conv = ConvertMomentum();
 
 // Generate stochastic factors
-   dWx = sqrt(dt) * rng->GetNormal();
-   dWy = sqrt(dt) * rng->GetNormal();
+   rng->GetNormals(dW, 2);
+   dWx = sqrt(dt) * dW[0];
+   dWy = sqrt(dt) * dW[1];
 
 // Recompute Dperp at the beginning of the step
    Dperp = diffusion->GetComponent(0, _t, _pos, mom_conv, _spdata);
@@ -128,14 +129,15 @@ void TrajectoryGuidingDiff::EulerPerpDiffSlopes(void)
 */
 void TrajectoryGuidingDiff::MilsteinPerpDiffSlopes(void)
 {
-   double dWx, dWy, Vxy, random, Dperp_new;
+   double dW[2], dWx, dWy, Vxy, random, Dperp_new;
    double dbdx, dbdy, dx, dy, slope_Dperp;
    GeoVector mom_conv = ConvertMomentum(), pos_new, xhat, yhat;
    SpatialData spdata_new;
 
 // Generate stochastic factors
-   dWx = sqrt(dt) * rng->GetNormal();
-   dWy = sqrt(dt) * rng->GetNormal();
+   rng->GetNormals(dW, 2);
+   dWx = sqrt(dt) * dW[0];
+   dWy = sqrt(dt) * dW[1];
 
 // Recompute Dperp at the beginning of the step
    Dperp = diffusion->GetComponent(0, _t, _pos, mom_conv, _spdata);
@@ -181,7 +183,7 @@ void TrajectoryGuidingDiff::MilsteinPerpDiffSlopes(void)
 */
 bool TrajectoryGuidingDiff::RK2PerpDiffSlopes(void)
 {
-   double dWx, dWy, Rx, Ry, Vxy, random;
+   double dW[2], dWx, dWy, Rx, Ry, Vxy, random;
    double dbdx, dbdy, d2bdx2, d2bdy2, d2bdxdy, dx, dy;
    double slope_Dperp[3], Dperp_newx, Dperp_newy, Dperp_new;
    double gambar = 1.0 / sqrt(3.0);
@@ -189,8 +191,9 @@ bool TrajectoryGuidingDiff::RK2PerpDiffSlopes(void)
    SpatialData spdata_new;
 
 // Generate stochastic factors
-   dWx = sqrt(dt) * rng->GetNormal();
-   dWy = sqrt(dt) * rng->GetNormal();
+   rng->GetNormals(dW, 2);
+   dWx = sqrt(dt) * dW[0];
+   dWy = sqrt(dt) * dW[1];
 
 // Compute first contribution to stochastic slope
    Dperp = diffusion->GetComponent(0, _t, _pos, mom_conv, _spdata);
@@ -370,7 +373,7 @@ bool TrajectoryGuidingDiff::Advance(void)
 
 // If trajectory is not finished (in particular, spatial boundary not crossed), the fields can be computed and momentum corrected
    if(BITS_LOWERED(_status, TRAJ_FINISH)) {
-      CommonFields();
+      if(!TryCommonFields()) return true;
       MomentumCorrection();
    };
 
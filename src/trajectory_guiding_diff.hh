@@ -85,7 +85,7 @@ public:
    TrajectoryGuidingDiff(void);
 
 //! Constructor with arguments (to speed up construction of derived classes)
-   TrajectoryGuidingDiff(const std::string& name_in, unsigned int specie_in, uint16_t status_in, bool presize_in);
+   TrajectoryGuidingDiff(const std::string& name_in, unsigned int specie_in, uint16_t status_in, unsigned int presize_in);
 
 //! Destructor
    ~TrajectoryGuidingDiff() override = default;
@@ -97,6 +97,8 @@ bool TrajectoryGuidingDiffScatt::Advance(void)
    MilsteinPitchAngleScatt(0);
 #elif STOCHASTIC_METHOD_MU == 2
    RK2PitchAngleScatt(0);
+#elif STOCHASTIC_METHOD_MU == 3
+   LegendrePitchAngleScatt(0);
 #endif
 
 // Store position and momentum locally
@@ -142,7 +144,7 @@ bool TrajectoryGuidingDiffScatt::Advance(void)
    if(SpaceTerminateCheck()) return true;
 
 // Compute diffusion coefficients
-   CommonFields();
+   if(!TryCommonFields()) return true;
    TrajectoryGuidingScatt::DiffusionCoeff();
 
 // Perform second half of PA scattering
@@ -152,6 +154,8 @@ bool TrajectoryGuidingDiffScatt::Advance(void)
    MilsteinPitchAngleScatt(1);
 #elif STOCHASTIC_METHOD_MU == 2
    RK2PitchAngleScatt(1);
+#elif STOCHASTIC_METHOD_MU == 3
+   LegendrePitchAngleScatt(1);
 #endif
 
 #endif
@@ -163,7 +167,7 @@ bool TrajectoryGuidingDiffScatt::Advance(void)
 
 // If trajectory is not finished (in particular, spatial boundary not crossed), the fields can be computed and momentum corrected
    if(BITS_LOWERED(_status, TRAJ_FINISH)) {
-      CommonFields();
+      if(!TryCommonFields()) return true;
       MomentumCorrection();
    };
 
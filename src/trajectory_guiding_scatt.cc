@@ -32,9 +32,9 @@ TrajectoryGuidingScatt::TrajectoryGuidingScatt(void)
 \param[in] name_in   Readable name of the class
 \param[in] specie_in Particle's specie
 \param[in] status_in Initial status
-\param[in] presize_in Whether to pre-allocate memory for trajectory arrays
+\param[in] presize_in Initial lengths of the containers
 */
-TrajectoryGuidingScatt::TrajectoryGuidingScatt(const std::string& name_in, unsigned int specie_in, uint16_t status_in, bool presize_in)
+TrajectoryGuidingScatt::TrajectoryGuidingScatt(const std::string& name_in, unsigned int specie_in, uint16_t status_in, unsigned int presize_in)
                       : TrajectoryGuiding(name_in, specie_in, status_in, presize_in)
 {
 };
@@ -244,6 +244,78 @@ void TrajectoryGuidingScatt::RK2PitchAngleScatt(bool second)
    _vel = Vel(_mom, specie);
 };
 
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] second True if this is the second step of a split scheme
+
+For "Dmumu = D0 * (1 - mu^2)" the pitch angle distribution evolves as a series of Legendre polynomials, each decaying as "exp(-l(l+1) D0 t)". Starting from a delta function at "mu", the probability to arrive at "mu'" is "sum_l (2l+1)/2 P_l(mu) P_l(mu') exp(-l(l+1) D0 dt)", which is sampled by inverting its cumulative distribution. The step size is not restricted, and "Vmu" is already included in the propagator. For other scattering models "D0" is taken at the current "mu", which is accurate if "Dmumu / (1 - mu^2)" varies slowly.
+*/
+void TrajectoryGuidingScatt::LegendrePitchAngleScatt(bool second)
+{
+   int l, l_max, it;
+   double mu, mu_new, mu_lo, mu_hi, D0, tau, u, cdf, p_prev, p_this, p_next, dt_local;
+   GeoVector mom_conv = ConvertMomentum();
+
+#ifdef SPLIT_SCATT
+   dt_local = (second ? 1.0 - alpha : alpha) * dt;
+#else
+   dt_local = dt;
+#endif
+
+// Near |mu| = 1 the isotropic rate cannot be obtained from "Dmumu" at the current "mu"
+   mu = mom_conv[1];
+   if(1.0 - Sqr(mu) > sp_small) D0 = Dmumu / (1.0 - Sqr(mu));
+   else {
+      mom_conv[1] = 0.0;
+      D0 = diffusion->GetComponent(2, _t, _pos, mom_conv, _spdata);
+   };
+   tau = D0 * dt_local;
+
+// For short steps the series converges slowly, but the Euler method is accurate
+   if(tau < tau_min_legendre) {
+      EulerPitchAngleScatt(second);
+      return;
+   };
+
+// Coefficients "P_l(mu) exp(-l(l+1) tau) / 2", truncated when the exponential becomes negligible
+   l_max = sqrt(-log(tol_legendre) / tau) + 1;
+   legendre_coeff.resize(l_max + 1);
+   legendre_coeff[0] = 0.5;
+   p_prev = 1.0;
+   p_this = mu;
+   for(l = 1; l <= l_max; l++) {
+      legendre_coeff[l] = 0.5 * p_this * exp(-l * (l + 1) * tau);
+      p_next = ((2 * l + 1) * mu * p_this - l * p_prev) / (l + 1);
+      p_prev = p_this;
+      p_this = p_next;
+   };
+
+// The cumulative distribution is "(1 + mu') / 2 + sum_l c_l [P_{l+1}(mu') - P_{l-1}(mu')]". It is monotonic, so bisection always converges.
+   u = rng->GetUniform();
+   mu_lo = -1.0;
+   mu_hi = 1.0;
+   for(it = 0; it < n_bisect_legendre; it++) {
+      mu_new = 0.5 * (mu_lo + mu_hi);
+      cdf = 0.5 * (1.0 + mu_new);
+      p_prev = 1.0;
+      p_this = mu_new;
+      for(l = 1; l <= l_max; l++) {
+         p_next = ((2 * l + 1) * mu_new * p_this - l * p_prev) / (l + 1);
+         cdf += legendre_coeff[l] * (p_next - p_prev);
+         p_prev = p_this;
+         p_this = p_next;
+      };
+      if(cdf < u) mu_lo = mu_new;
+      else mu_hi = mu_new;
+   };
+   mu_new = 0.5 * (mu_lo + mu_hi);
+
+   _mom[0] = mom_conv[0] * sqrt(1 - Sqr(mu_new));
+   _mom[2] = mom_conv[0] * mu_new;
+   _vel = Vel(_mom, specie);
+};
+
 /*!
 \author Vladimir Florinski
 \author Juan G Alonso Guzman
@@ -251,11 +323,14 @@ void TrajectoryGuidingScatt::RK2PitchAngleScatt(bool second)
 */
 void TrajectoryGuidingScatt::PhysicalStep(void)
 {
+// The exact propagator does not restrict the time step
+#if STOCHASTIC_METHOD_MU != 3
 #if CONST_DMUMAX == 0
    double dmumax = sqrt(1 - fabs(_mom[2] / _mom.Norm())) * dthetamax + 0.5 * fabs(_mom[2] / _mom.Norm()) * Sqr(dthetamax);
 #endif
    dt_physical = fmin(dt_physical, cfl_pa_gs * Sqr(dmumax) / Dmumu);
    dt_physical = fmin(dt_physical, cfl_pa_gs * dmumax / fabs(Vmu));
+#endif
 };
 
 /*!
@@ -291,6 +366,8 @@ bool TrajectoryGuidingScatt::Advance(void)
    MilsteinPitchAngleScatt(0);
 #elif STOCHASTIC_METHOD_MU == 2
    RK2PitchAngleScatt(0);
+#elif STOCHASTIC_METHOD_MU == 3
+   LegendrePitchAngleScatt(0);
 #endif
 
 // Store position and momentum locally
@@ -324,7 +401,7 @@ bool TrajectoryGuidingScatt::Advance(void)
    if(SpaceTerminateCheck()) return true;
 
 // Compute diffusion coefficients (including PA advection term)
-   CommonFields();
+   if(!TryCommonFields()) return true;
    DiffusionCoeff();
 
 // Perform second half of PA scattering
@@ -334,6 +411,8 @@ bool TrajectoryGuidingScatt::Advance(void)
    MilsteinPitchAngleScatt(1);
 #elif STOCHASTIC_METHOD_MU == 2
    RK2PitchAngleScatt(1);
+#elif STOCHASTIC_METHOD_MU == 3
+   LegendrePitchAngleScatt(1);
 #endif
 
 #endif
@@ -345,7 +424,7 @@ bool TrajectoryGuidingScatt::Advance(void)
 
 // If trajectory is not finished (in particular, spatial boundary not crossed), the fields can be computed and momentum corrected
    if(BITS_LOWERED(_status, TRAJ_FINISH)) {
-      CommonFields();
+      if(!TryCommonFields()) return true;
       MomentumCorrection();
    };
 
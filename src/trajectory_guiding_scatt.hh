@@ -20,7 +20,7 @@ namespace Spectrum {
 //! Whether to use constant dmumax or constant dthetamax, 0 = constant dthetamax, 1 = constant dmumax
 #define CONST_DMUMAX 0
 
-//! Which stochastic method to use for PA scattering, 0 = Euler, 1 = Milstein, 2 = RK2
+//! Which stochastic method to use for PA scattering, 0 = Euler, 1 = Milstein, 2 = RK2, 3 = exact propagator for isotropic scattering
 #define STOCHASTIC_METHOD_MU 0
 
 //! Readable name of the TrajectoryGuidingScatt class
@@ -45,6 +45,15 @@ const double dthetamax = 2.0 * M_PI / 180.0;
 //! CFL condition for pitch angle scattering
 const double cfl_pa_gs = 0.5;
 
+//! Smallest "Dmumu * dt / (1 - mu^2)" for which the exact propagator is used (below it the Euler step is accurate)
+const double tau_min_legendre = 1.0e-3;
+
+//! Truncation threshold for the Legendre series of the exact propagator
+const double tol_legendre = 1.0e-8;
+
+//! Number of bisections to invert the propagator
+const int n_bisect_legendre = 40;
+
 //----------------------------------------------------------------------------------------------------------------------------------------------------
 // TrajectoryGuidingScatt class declaration
 //----------------------------------------------------------------------------------------------------------------------------------------------------
@@ -64,6 +73,9 @@ protected:
 //! Rate of change of Dmumu with mu (transient)
    double Vmu;
 
+//! Coefficients of the Legendre series of the propagator (transient)
+   std::vector<double> legendre_coeff;
+
 #ifdef GEO_DEBUG
 //! Number of times |mu| > 1
    int Nabsmugt1 = 0;
@@ -81,6 +93,9 @@ protected:
 //! Performs RK2 pitch angle scattering (weak order 2, strong order 1?)
    void RK2PitchAngleScatt(bool second);
 
+//! Performs pitch angle scattering by sampling the exact propagator for isotropic scattering (any time step)
+   void LegendrePitchAngleScatt(bool second);
+
 //! Compute the physical time step
    void PhysicalStep(void) override;
 
@@ -96,7 +111,7 @@ public:
    TrajectoryGuidingScatt(void);
 
 //! Constructor with arguments (to speed up construction of derived classes)
-   TrajectoryGuidingScatt(const std::string& name_in, unsigned int specie_in, uint16_t status_in, bool presize_in);
+   TrajectoryGuidingScatt(const std::string& name_in, unsigned int specie_in, uint16_t status_in, unsigned int presize_in);
 
 //! Destructor
    ~TrajectoryGuidingScatt() override = default;
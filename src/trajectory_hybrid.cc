@@ -0,0 +1,236 @@
+/*!
+\file trajectory_hybrid.cc
+\brief Defines a class for trajectory switching between the Newton-Lorentz and guiding center equations
+\author Swati Sharma
+
+This file is part of the SPECTRUM suite of scientific numerical simulation codes. SPECTRUM stands for Space Plasma and Energetic Charged particle TRansport on Unstructured Meshes. The code simulates plasma or neutral particle flows using MHD equations on a grid, transport of cosmic rays using stochastic or grid based methods. The "unstructured" part refers to the use of a geodesic mesh providing a uniform coverage of the surface of a sphere.
+*/
+
+#include "trajectory_hybrid.hh"
+
+namespace Spectrum {
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// TrajectoryHybrid methods
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+TrajectoryHybrid::TrajectoryHybrid(void)
+                : TrajectoryGuiding(traj_name_hybrid, 0, STATE_NONE, defsize_hybrid)
+{
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+void TrajectoryHybrid::SetStart(void)
+{
+// Call the base version of this function. The guiding center version cannot be used because the initial momentum is in the Cartesian format.
+   TrajectoryBase::SetStart();
+
+// The gradient of |B| is needed to evaluate the adiabaticity in both modes
+   _spdata._mask = BACKGROUND_ALL | BACKGROUND_gradB | BACKGROUND_dBdt;
+   spdata0._mask = BACKGROUND_ALL | BACKGROUND_gradB | BACKGROUND_dBdt;
+
+// The trajectory always starts as a full orbit. If the motion is adiabatic, the switch will occur at the end of the first step.
+   gc_mode = false;
+   gc_form = false;
+   gyro_phase = 0.0;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+void TrajectoryHybrid::ReverseMomentum(void)
+{
+   _mom *= -1.0;
+
+// Reversal of the perpendicular momentum shifts the gyrophase by pi
+   if(gc_mode) {
+      mom_gc[2] = -mom_gc[2];
+      gyro_phase += M_PI;
+   };
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[out] slope_pos_istage RK slope for position
+\param[out] slope_mom_istage RK slope for momentum
+*/
+void TrajectoryHybrid::Slopes(GeoVector& slope_pos_istage, GeoVector& slope_mom_istage)
+{
+   if(gc_form) TrajectoryGuiding::Slopes(slope_pos_istage, slope_mom_istage);
+   else {
+      slope_pos_istage = _vel;
+      slope_mom_istage = q * (_spdata.Evec + (_vel ^ _spdata.Bvec) / c_code);
+   };
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+void TrajectoryHybrid::PhysicalStep(void)
+{
+   if(gc_form) TrajectoryGuiding::PhysicalStep();
+
+// Same as "TrajectoryLorentz::PhysicalStep()"
+   else {
+      double Omega = fmax(CyclotronFrequency(_vel.Norm(), _spdata.Bmag, specie), sp_tiny);
+      dt_physical = M_2PI / Omega / steps_per_orbit;
+      dt_physical = fmin(dt_physical, cfl_adv_tl * _spdata.dmax / _vel.Norm());
+   };
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+void TrajectoryHybrid::MomentumCorrection(void)
+{
+#if PPERP_METHOD == 0
+   if(gc_form) _mom[0] = PerpMomentum(mag_mom, _spdata.Bmag, specie);
+#endif
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] mom_perp Perpendicular momentum
+\return Ratio of the Larmor radius to the length scale of |B|
+\note "CommonFields()" must be called prior to this function
+*/
+double TrajectoryHybrid::Adiabaticity(double mom_perp) const
+{
+   if(_spdata.Bmag < sp_tiny) return sp_large;
+   return LarmorRadius(mom_perp, _spdata.Bmag, specie) * _spdata.gradBmag.Norm() / _spdata.Bmag;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return Momentum in the (p_x,p_y,p_z) format
+\note "CommonFields()" must be called prior to this function
+*/
+GeoVector TrajectoryHybrid::CartesianMomentum(void) const
+{
+   GeoVector e1, e2;
+
+   e1 = GetSecondUnitVec(_spdata.bhat);
+   e2 = _spdata.bhat ^ e1;
+   return mom_gc[0] * (cos(gyro_phase) * e1 + sin(gyro_phase) * e2) + mom_gc[2] * _spdata.bhat;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\note "CommonFields()" must be called prior to this function
+*/
+void TrajectoryHybrid::SwitchToGuiding(void)
+{
+   double mom_para;
+   GeoVector e1, e2, mom_perp;
+
+   mom_para = _mom * _spdata.bhat;
+   mom_perp = _mom - mom_para * _spdata.bhat;
+   e1 = GetSecondUnitVec(_spdata.bhat);
+   e2 = _spdata.bhat ^ e1;
+   gyro_phase = atan2(mom_perp * e2, mom_perp * e1);
+
+// The guiding center is displaced from the particle by minus the Larmor radius vector "c (B x p) / (q B^2)"
+   _pos -= c_code * (_spdata.bhat ^ _mom) / (q * _spdata.Bmag);
+   CommonFields();
+
+   mom_gc = GeoVector(mom_perp.Norm(), 0.0, mom_para);
+   mag_mom = MagneticMoment(mom_gc[0], _spdata.Bmag, specie);
+   _mom = CartesianMomentum();
+   _vel = Vel(_mom, specie);
+
+// The adaptive step recommended for the full orbit is not relevant for the guiding center motion
+   dt_adaptive = sp_large * _spdata.dmax / c_code;
+   gc_mode = true;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\note "CommonFields()" must be called prior to this function
+*/
+void TrajectoryHybrid::SwitchToLorentz(void)
+{
+// The gyrophase is not resolved by the guiding center integration, so it is sampled uniformly
+   gyro_phase = M_2PI * rng->GetUniform();
+   _mom = CartesianMomentum();
+   _pos += c_code * (_spdata.bhat ^ _mom) / (q * _spdata.Bmag);
+   CommonFields();
+   _vel = Vel(_mom, specie);
+
+   dt_adaptive = sp_large * _spdata.dmax / c_code;
+   gc_mode = false;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return True if a step was taken
+
+The step follows "TrajectoryBase::RKAdvance()". In the guiding center mode the momentum is converted to the Cartesian format before the boundaries are handled, so that the boundaries and distributions see the same momentum as in the full orbit mode.
+*/
+bool TrajectoryHybrid::Advance(void)
+{
+   double t_start;
+
+// Retrieve latest point of the trajectory and store locally. In the guiding center mode the stored momentum is replaced with the exact guiding center momentum.
+   Load();
+   gc_form = gc_mode;
+   if(gc_mode) {
+      _mom = mom_gc;
+      _vel = Vel(_mom, specie);
+   };
+   StoreLocal();
+   t_start = _t;
+
+   Slopes(slope_pos[0], slope_mom[0]);
+   PhysicalStep();
+   dt = fmin(dt_physical, dt_adaptive);
+   TimeBoundaryProximityCheck();
+
+   if(RKSlopes()) return true;
+   if(RKStep()) return false;
+
+   if(gc_mode) {
+      mom_gc = _mom;
+      gyro_phase -= CyclotronFrequency(_vel.Norm(), _spdata.Bmag, specie) * (_t - t_start);
+      _mom = CartesianMomentum();
+      _vel = Vel(_mom, specie);
+      gc_form = false;
+   };
+
+// Handle boundaries
+   HandleBoundaries();
+
+// The mode is changed at the end of a step so that the new mode starts with fields at the switching point
+   if(BITS_LOWERED(_status, TRAJ_FINISH)) {
+      if(!TryCommonFields()) return true;
+
+      if(gc_mode) {
+         _mom = CartesianMomentum();
+         _vel = Vel(_mom, specie);
+         if(Adiabaticity(mom_gc[0]) > adiabatic_limit_fo) SwitchToLorentz();
+      }
+      else if(Adiabaticity((_mom - (_mom * _spdata.bhat) * _spdata.bhat).Norm()) < adiabatic_limit_gc) SwitchToGuiding();
+   };
+
+// Add the new point to the trajectory.
+   Store();
+
+   return true;
+};
+
+};
@@ -0,0 +1,136 @@
+/*!
+\file trajectory_hybrid.hh
+\brief Declares a class for trajectory switching between the Newton-Lorentz and guiding center equations
+\author Swati Sharma
+
+This file is part of the SPECTRUM suite of scientific numerical simulation codes. SPECTRUM stands for Space Plasma and Energetic Charged particle TRansport on Unstructured Meshes. The code simulates plasma or neutral particle flows using MHD equations on a grid, transport of cosmic rays using stochastic or grid based methods. The "unstructured" part refers to the use of a geodesic mesh providing a uniform coverage of the surface of a sphere.
+*/
+
+#ifndef SPECTRUM_TRAJECTORY_HYBRID_HH
+#define SPECTRUM_TRAJECTORY_HYBRID_HH
+
+#include "trajectory_lorentz.hh"
+#include "trajectory_guiding.hh"
+
+namespace Spectrum {
+
+//! Readable name of the TrajectoryHybrid class
+const std::string traj_name_hybrid = "TrajectoryHybrid";
+
+//! Default initial size
+const unsigned int defsize_hybrid = 100000;
+
+//! Adiabaticity below which the guiding center equations are used
+const double adiabatic_limit_gc = 0.02;
+
+//! Adiabaticity above which the full orbit equations are used (must be larger than "adiabatic_limit_gc" to prevent frequent switching)
+const double adiabatic_limit_fo = 0.05;
+
+/*!
+\brief Trajectory tracer switching between the full orbit and the guiding center equations
+\author Swati Sharma
+
+The adiabaticity parameter, the ratio of the Larmor radius to the scale of |B| variation, is evaluated at the end of each step. The particle is moved to its guiding center when the parameter falls below "adiabatic_limit_gc", and is placed on a gyro-orbit with a randomly sampled gyrophase when it exceeds "adiabatic_limit_fo".
+
+Components of "traj_mom" are: px (x), py (y), pz (z), as in "TrajectoryLorentz", so that the initial conditions, boundaries, and distributions are the same as for the full orbit model. While in the guiding center mode, the recorded position is that of the guiding center and the perpendicular momentum is given a gyrophase that advances with the cyclotron frequency. The guiding center momentum (p_perp, unused, p_para) is kept separately, so the conversion to Cartesian components does not introduce any error into the guiding center integration.
+*/
+class TrajectoryHybrid : public TrajectoryGuiding {
+
+protected:
+
+//! Whether the guiding center equations are used (transient)
+   bool gc_mode;
+
+//! Whether "_mom" is in the (p_perp,0,p_para) format (transient)
+   bool gc_form;
+
+//! Guiding center momentum at the last recorded point (transient)
+   GeoVector mom_gc;
+
+//! Gyrophase at the last recorded point (transient)
+   double gyro_phase;
+
+//! Conversion from (p_x,p_y,p_z) or (p_perp,0,p_para) to (p,mu,0)
+   GeoVector ConvertMomentum(void) const override;
+
+//! Momentum transformation on reflection at a boundary
+   void ReverseMomentum(void) override;
+
+//! Compute the RK slopes
+   void Slopes(GeoVector& slope_pos_istage, GeoVector& slope_mom_istage) override;
+
+//! Compute the physical time step
+   void PhysicalStep(void) override;
+
+//! Adjust perp momentum to conserve magnetic moment
+   void MomentumCorrection(void) override;
+
+//! Take a step
+   bool Advance(void) override;
+
+//! Compute the adiabaticity parameter at the current position
+   double Adiabaticity(double mom_perp) const;
+
+//! Convert the guiding center momentum to Cartesian components
+   GeoVector CartesianMomentum(void) const;
+
+//! Move the particle to its guiding center
+   void SwitchToGuiding(void);
+
+//! Place the particle on a gyro-orbit around the guiding center
+   void SwitchToLorentz(void);
+
+public:
+
+//! Default constructor
+   TrajectoryHybrid(void);
+
+//! Copy constructor (class not copyable)
+   TrajectoryHybrid(const TrajectoryHybrid& other) = delete;
+
+//! Destructor
+   ~TrajectoryHybrid() override = default;
+
+//! Clone function
+   CloneFunctionTrajectory(TrajectoryHybrid);
+
+//! Clear the trajectory and start a new one with specified position and momentum
+   void SetStart(void) override;
+
+//! Return whether the guiding center equations are in use
+   bool GuidingCenterMode(void) const;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// TrajectoryHybrid inline methods
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return A vector in the (p,mu,0) format
+*/
+inline GeoVector TrajectoryHybrid::ConvertMomentum(void) const
+{
+   if(gc_form) return TrajectoryGuiding::ConvertMomentum();
+   else return GeoVector(_mom.Norm(), (_mom * _spdata.bhat) / _mom.Norm(), 0.0);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return True if the guiding center equations are in use
+*/
+inline bool TrajectoryHybrid::GuidingCenterMode(void) const
+{
+   return gc_mode;
+};
+
+//! Trajectory type
+#if TRAJ_TYPE == TRAJ_HYBRID
+typedef TrajectoryHybrid TrajectoryType;
+#endif
+
+};
+
+#endif
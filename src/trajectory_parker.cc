@@ -30,9 +30,9 @@ TrajectoryParker::TrajectoryParker(void)
 \param[in] name_in   Readable name of the class
 \param[in] specie_in Particle's specie
 \param[in] status_in Initial status
-\param[in] presize_in Whether to pre-allocate memory for trajectory arrays
+\param[in] presize_in Initial lengths of the containers
 */
-TrajectoryParker::TrajectoryParker(const std::string& name_in, unsigned int specie_in, uint16_t status_in, bool presize_in)
+TrajectoryParker::TrajectoryParker(const std::string& name_in, unsigned int specie_in, uint16_t status_in, unsigned int presize_in)
                 : TrajectoryBase(name_in, specie_in, status_in, presize_in)
 {
 };
@@ -87,15 +87,17 @@ try {
 #if TRAJ_PARKER_DIVK_METHOD == 0
    GeoVector pos_tmp;
    SpatialData spdata_forw, spdata_back;
-   double Kperp_forw, Kperp_back, Kpara_forw, Kpara_back, Kappa_forw, Kappa_back;
+   double Kappa_forw, Kappa_back;
+   GeoVector K_forw, K_back, K_comp;
    double delta = fmin(LarmorRadius(_mom[0], _spdata.Bmag, specie), _spdata.dmax);
 
 // TODO: if the diffusion coefficients depend on more than just magnetic field, "spdata_xxxx._mask" should include more fields.
    spdata_forw._mask = BACKGROUND_B;
    spdata_back._mask = BACKGROUND_B;
 // Compute perpendicular and parallel diffusion coefficients and diffusion tensor.
-   Kperp = diffusion->GetComponent(0, _t, _pos, _mom, _spdata);
-   Kpara = diffusion->GetComponent(1, _t, _pos, _mom, _spdata);
+   K_comp = diffusion->GetComponents(_t, _pos, _mom, _spdata);
+   Kperp = K_comp[0];
+   Kpara = K_comp[1];
 
 // Loop over dimensions to find derivatives of Kappa.
    divK = gv_zeros;
@@ -104,16 +106,14 @@ try {
 // Forward evaluation
       pos_tmp = _pos + delta * cart_unit_vec[j];
       CommonFields(_t, pos_tmp, _mom, spdata_forw);
-      Kperp_forw = diffusion->GetComponent(0, _t, pos_tmp, _mom, spdata_forw);
-      Kpara_forw = diffusion->GetComponent(1, _t, pos_tmp, _mom, spdata_forw);
+      K_forw = diffusion->GetComponents(_t, pos_tmp, _mom, spdata_forw);
 // Backward evaluation
       pos_tmp[j] -= 2.0 * delta;
       CommonFields(_t, pos_tmp, _mom, spdata_back);
-      Kperp_back = diffusion->GetComponent(0, _t, pos_tmp, _mom, spdata_back);
-      Kpara_back = diffusion->GetComponent(1, _t, pos_tmp, _mom, spdata_back);
+      K_back = diffusion->GetComponents(_t, pos_tmp, _mom, spdata_back);
       for(i = 0; i < 3; i++) {
-         Kappa_forw = Kperp_forw * (i == j ? 1.0 : 0.0) + (Kpara_forw - Kperp_forw) * spdata_forw.bhat[j] * spdata_forw.bhat[i];
-         Kappa_back = Kperp_back * (i == j ? 1.0 : 0.0) + (Kpara_back - Kperp_back) * spdata_back.bhat[j] * spdata_back.bhat[i];
+         Kappa_forw = K_forw[0] * (i == j ? 1.0 : 0.0) + (K_forw[1] - K_forw[0]) * spdata_forw.bhat[j] * spdata_forw.bhat[i];
+         Kappa_back = K_back[0] * (i == j ? 1.0 : 0.0) + (K_back[1] - K_back[0]) * spdata_back.bhat[j] * spdata_back.bhat[i];
          divK[i] += 0.5 * (Kappa_forw - Kappa_back) / delta;
       };
    };
@@ -155,25 +155,20 @@ catch(ExFieldError& exception) {
 /*!
 \author Juan G Alonso Guzman
 \date 03/11/2024
+\note This must be called before "RKSlopes()", while "Kperp" and "Kpara" still hold the values computed by "Slopes()" at the beginning of the step.
 */
 void TrajectoryParker::EulerDiffSlopes(void)
 {
-   double dWx, dWy, dWz;
+   double dW[3];
    FieldAlignedFrame();
 
 // Generate stochastic factors
-   dWx = sqrt(dt) * rng->GetNormal();
-   dWy = sqrt(dt) * rng->GetNormal();
-   dWz = sqrt(dt) * rng->GetNormal();
-
-// Recompute Kperp and Kpara at the beginning of the step
-   Kperp = diffusion->GetComponent(0, _t, _pos, _mom, _spdata);
-   Kpara = diffusion->GetComponent(1, _t, _pos, _mom, _spdata);
+   rng->GetNormals(dW, 3);
 
 // Compute random displacement
-   dr_perp[0] = sqrt(2.0 * Kperp) * dWx;
-   dr_perp[1] = sqrt(2.0 * Kperp) * dWy;
-   dr_perp[2] = sqrt(2.0 * Kpara) * dWz;
+   dr_perp[0] = sqrt(2.0 * Kperp * dt) * dW[0];
+   dr_perp[1] = sqrt(2.0 * Kperp * dt) * dW[1];
+   dr_perp[2] = sqrt(2.0 * Kpara * dt) * dW[2];
 
 // Convert to global coordinates
    dr_perp.ChangeFromBasis(fa_basis);
@@ -297,7 +292,7 @@ bool TrajectoryParker::Advance(void)
    HandleBoundaries();
 
 // If trajectory is not finished (in particular, spatial boundary not crossed), the fields can be computed
-   if(BITS_LOWERED(_status, TRAJ_FINISH)) CommonFields();
+   if(BITS_LOWERED(_status, TRAJ_FINISH) && !TryCommonFields()) return true;
 
 // Add the new point to the trajectory.
    Store();
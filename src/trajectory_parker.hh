@@ -100,7 +100,7 @@ public:
    TrajectoryParker(void);
 
 //! Constructor with arguments (to speed up construction of derived classes)
-   TrajectoryParker(const std::string& name_in, unsigned int specie_in, uint16_t status_in, bool presize_in);
+   TrajectoryParker(const std::string& name_in, unsigned int specie_in, uint16_t status_in, unsigned int presize_in);
 
 //! Copy constructor (class not copyable)
    TrajectoryParker(const TrajectoryParker& other) = delete;
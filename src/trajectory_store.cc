@@ -0,0 +1,155 @@
+/*!
+\file trajectory_store.cc
+\brief Implements a class for binary append-only storage of trajectories
+\author Swati Sharma
+
+This file is part of the SPECTRUM suite of scientific numerical simulation codes. SPECTRUM stands for Space Plasma and Energetic Charged particle TRansport on Unstructured Meshes. The code simulates plasma or neutral particle flows using MHD equations on a grid, transport of cosmic rays using stochastic or grid based methods. The "unstructured" part refers to the use of a geodesic mesh providing a uniform coverage of the surface of a sphere.
+*/
+
+#include "trajectory_store.hh"
+#include <cstring>
+#include <algorithm>
+
+namespace Spectrum {
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// TrajectoryStore methods
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] file_name   Name of the file
+\param[in] output      Which columns to store
+\param[in] single_prec Store values in single precision
+\param[in] phys_units  Whether the values will be in physical units (recorded in the header)
+*/
+TrajectoryStore::TrajectoryStore(const std::string& file_name, unsigned int output, bool single_prec, bool phys_units)
+{
+   Open(file_name, output, single_prec, phys_units);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+TrajectoryStore::~TrajectoryStore(void)
+{
+   Close();
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] file_name   Name of the file
+\param[in] output      Which columns to store
+\param[in] single_prec Store values in single precision
+\param[in] phys_units  Whether the values will be in physical units (recorded in the header)
+*/
+void TrajectoryStore::Open(const std::string& file_name, unsigned int output, bool single_prec, bool phys_units)
+{
+   int bit;
+
+   Close();
+
+   std::memcpy(header.magic, traj_store_magic, sizeof(header.magic));
+   header.output = output;
+   header.value_size = (single_prec ? sizeof(float) : sizeof(double));
+   header.n_cols = 0;
+   for(bit = 0; bit < traj_output_bits; bit++) {
+      if(output & (1 << bit)) header.n_cols++;
+   };
+   header.phys_units = phys_units;
+   header.index_offset = 0;
+
+   index.clear();
+   store_file.open(file_name.c_str(), std::ios::binary | std::ios::trunc);
+   store_file.write((char*)&header, sizeof(TrajectoryStoreHeader));
+   file_pos = sizeof(TrajectoryStoreHeader);
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\param[in] traj_id Trajectory identifier
+\param[in] values  Row-major table of values with "NCols()" columns
+*/
+void TrajectoryStore::Append(int64_t traj_id, const std::vector<double>& values)
+{
+   if(!store_file.is_open() || !header.n_cols) return;
+
+   uint64_t n_points = values.size() / header.n_cols;
+   uint64_t n_bytes = n_points * header.n_cols * header.value_size;
+
+   index.push_back({traj_id, file_pos, n_points});
+
+// One write per trajectory; in single precision the values are converted in a reusable buffer
+   if(header.value_size == sizeof(double)) store_file.write((char*)values.data(), n_bytes);
+   else {
+      buffer.resize(n_points * header.n_cols);
+      std::copy(values.begin(), values.begin() + buffer.size(), buffer.begin());
+      store_file.write((char*)buffer.data(), n_bytes);
+   };
+   file_pos += n_bytes;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+*/
+void TrajectoryStore::Close(void)
+{
+   if(!store_file.is_open()) return;
+
+   uint64_t n_traj = index.size();
+
+// Index at the end of the file, then patch the header to point to it
+   header.index_offset = file_pos;
+   store_file.write((char*)&n_traj, sizeof(uint64_t));
+   store_file.write((char*)index.data(), n_traj * sizeof(TrajectoryStoreEntry));
+   store_file.seekp(0);
+   store_file.write((char*)&header, sizeof(TrajectoryStoreHeader));
+   store_file.close();
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return Column mask
+*/
+unsigned int TrajectoryStore::Output(void) const
+{
+   return header.output;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return True if the values are in physical units
+*/
+bool TrajectoryStore::PhysUnits(void) const
+{
+   return header.phys_units;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return Number of columns
+*/
+int TrajectoryStore::NCols(void) const
+{
+   return header.n_cols;
+};
+
+/*!
+\author Swati Sharma
+\date 10/17/2026
+\return Number of trajectories
+*/
+int TrajectoryStore::NTrajectories(void) const
+{
+   return index.size();
+};
+
+};
@@ -0,0 +1,130 @@
+/*!
+\file trajectory_store.hh
+\brief Declares a class for binary append-only storage of trajectories
+\author Swati Sharma
+
+This file is part of the SPECTRUM suite of scientific numerical simulation codes. SPECTRUM stands for Space Plasma and Energetic Charged particle TRansport on Unstructured Meshes. The code simulates plasma or neutral particle flows using MHD equations on a grid, transport of cosmic rays using stochastic or grid based methods. The "unstructured" part refers to the use of a geodesic mesh providing a uniform coverage of the surface of a sphere.
+*/
+
+#ifndef SPECTRUM_TRAJECTORY_STORE_HH
+#define SPECTRUM_TRAJECTORY_STORE_HH
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <fstream>
+
+namespace Spectrum {
+
+//! Identifier at the beginning of a trajectory store file
+const char traj_store_magic[8] = {'S', 'P', 'T', 'R', 'A', 'J', '0', '1'};
+
+//! Number of bits in the "output" mask of "TrajectoryBase::PrintTrajectory()"
+const int traj_output_bits = 8;
+
+/*!
+\brief File header of a trajectory store
+\author Swati Sharma
+*/
+struct TrajectoryStoreHeader {
+
+//! File identifier
+   char magic[8];
+
+//! Which columns are stored, same meaning as the "output" mask of "TrajectoryBase::PrintTrajectory()"
+   uint32_t output;
+
+//! Size of one stored value in bytes (4 or 8)
+   uint32_t value_size;
+
+//! Number of columns
+   uint32_t n_cols;
+
+//! Whether the values are in physical units
+   uint32_t phys_units;
+
+//! Offset of the index from the beginning of the file, zero if the file was not closed properly
+   uint64_t index_offset;
+};
+
+/*!
+\brief Entry of the trajectory index
+\author Swati Sharma
+*/
+struct TrajectoryStoreEntry {
+
+//! Trajectory identifier
+   int64_t traj_id;
+
+//! Offset of the first value from the beginning of the file
+   uint64_t offset;
+
+//! Number of stored points (rows)
+   uint64_t n_points;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+// TrajectoryStore class declaration
+//----------------------------------------------------------------------------------------------------------------------------------------------------
+
+/*!
+\brief Binary append-only file of trajectories
+\author Swati Sharma
+
+The file consists of a "TrajectoryStoreHeader", followed by the trajectories one after another, and the index. Each trajectory is a row-major table of "n_points" rows by "n_cols" columns in single or double precision. The index, written by "Close()", is the number of trajectories (uint64) followed by one "TrajectoryStoreEntry" per trajectory, and its position is recorded in the header. Each process should write its own file, e.g., "<base>_<rank>.trj", so no coordination is required.
+*/
+class TrajectoryStore {
+
+protected:
+
+//! Output stream
+   std::ofstream store_file;
+
+//! File header
+   TrajectoryStoreHeader header;
+
+//! Index of stored trajectories
+   std::vector<TrajectoryStoreEntry> index;
+
+//! Conversion buffer for single precision output
+   std::vector<float> buffer;
+
+//! Current write position
+   uint64_t file_pos;
+
+public:
+
+//! Default constructor
+   TrajectoryStore(void) = default;
+
+//! Constructor with arguments
+   TrajectoryStore(const std::string& file_name, unsigned int output, bool single_prec, bool phys_units);
+
+//! Destructor
+   ~TrajectoryStore(void);
+
+//! Create the file and write the header
+   void Open(const std::string& file_name, unsigned int output, bool single_prec, bool phys_units);
+
+//! Append one trajectory
+   void Append(int64_t traj_id, const std::vector<double>& values);
+
+//! Write the index and close the file
+   void Close(void);
+
+//! Return the column mask
+   unsigned int Output(void) const;
+
+//! Return whether the physical units are used
+   bool PhysUnits(void) const;
+
+//! Return the number of columns
+   int NCols(void) const;
+
+//! Return the number of trajectories stored so far
+   int NTrajectories(void) const;
+};
+
+};
+
+#endif
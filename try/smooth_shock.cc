@@ -86,6 +86,10 @@ int main(int argc, char** argv)
    double width_shock = 1.4e-2 * GSL_CONST_CGSM_ASTRONOMICAL_UNIT / unit_length_fluid;
    container.Insert(width_shock);
 
+//! Largest distance per time step at the shock as a fraction of the width (persistent)
+   double dmax_fraction = 0.1;
+   container.Insert(dmax_fraction);
+
    simulation->AddBackground(BackgroundSmoothShock(), container);
 
 //----------------------------------------------------------------------------------------------------------------------------------------------------